@@ -13,8 +13,19 @@
 /*********************************************************************************************************************
                                          << File Inclusions >>
 *********************************************************************************************************************/
+#define _POSIX_C_SOURCE 200809L
+#include <string.h>
 #include "linkedlist.h"
 #include "CustomArray.h"
+#include "dlinkedlist.h"
+#include "linkedlist_snapshot.h"
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static custarr_std_ret_t buffer_reserve(custarr_t *my_array, size_t element_count);
+static custarr_std_ret_t elements_free(custarr_t *my_array);
+static custarr_std_ret_t iter_insert_after(custarr_iter_t *my_iter, int data);
 
 /*********************************************************************************************************************
                                   << Public Function Definitions >>
@@ -44,27 +55,96 @@
 *********************************************************************************************************************/
 custarr_std_ret_t initArray(custarr_t *my_array, size_t initial_capacity)
 {
-    custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
-    static array_init_status_t current_init_status = ARRAY_UNINITIALIZED;
+    return initArray_backing(my_array, initial_capacity, CUSTARR_DEFAULT_BACKING);
+}
 
-    my_array->init_status = current_init_status;
 
-    if(ARRAY_UNINITIALIZED == my_array->init_status)
+/*********************************************************************************************************************
+** Function Name:
+*  initArray_backing
+*
+** Purpose:
+*  This function initializes the array, storing its elements in the selected list.
+*
+** Input Parameters:
+*  - array: CustomArray*
+*    A pointer to an object created of type CustomArray, which contains all the information for the array to be
+*    created.
+*  - initial_capacity: size_t
+*    Takes the size capacity of the array to be created, i.e. the maximum number of the elements that the array can
+*    store.
+*  - backing: custarr_backing_t
+*    List the elements of the array are stored in.
+*
+** Return Value:
+*  - custarr_std_ret_t
+*    Returns error code of the function:
+*    -- CUSTARR_OP_SUCCESS
+*    -- CUSTARR_OP_FAIL: the array is already initialized, or its first element couldn't be allocated.
+*********************************************************************************************************************/
+custarr_std_ret_t initArray_backing(custarr_t *my_array, size_t initial_capacity, custarr_backing_t backing)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
+
+    /** An array is only taken as initialized if it was initialized at its current address **/
+    if((my_array->self_ptr != (void*)my_array) || (ARRAY_INITIALIZED != my_array->init_status))
     {
-        /** Lock access to array **/
-        my_array->lock = ARRAY_LOCKED;
-        /** Initialize array structure elements **/
+        /** Initialize array structure elements. The array isn't shared yet, so it isn't locked. **/
         my_array->head_node.data = 0;
         my_array->head_node.next_node_address_ptr = NULL;
         my_array->size = 1;
         my_array->capacity = initial_capacity;
-        /** Unlock access to array **/
-        my_array->init_status = ARRAY_INITIALIZED;
-        current_init_status   = ARRAY_INITIALIZED;
-        ret_val = CUSTARR_OP_SUCCESS;
+        my_array->backing = backing;
+        my_array->init_status = ARRAY_UNINITIALIZED;
+        if(CUSTARR_BACKING_DLINKEDLIST == backing)
+        {
+            /** The first element is stored in a list node instead of the head node **/
+            (void)dlinkedlist_init(&my_array->dlist);
+            if(LINKEDLIST_OP_SUCCESS == dlinkedlist_insert_end(&my_array->dlist, 0))
+            {
+                ret_val = CUSTARR_OP_SUCCESS;
+            }
+        }
+        else if(CUSTARR_BACKING_BUFFER == backing)
+        {
+            /** The buffer starts small, whatever the capacity, and grows as elements are inserted **/
+            my_array->buffer_slots = (initial_capacity > CUSTARR_BUFFER_MIN_SLOTS) ? CUSTARR_BUFFER_MIN_SLOTS : 1u;
+            my_array->buffer_ptr = (int*)malloc(my_array->buffer_slots * sizeof(int));
+            if(NULL != my_array->buffer_ptr)
+            {
+                my_array->buffer_ptr[0] = 0;
+                ret_val = CUSTARR_OP_SUCCESS;
+            }
+        }
+        else
+        {
+            ret_val = CUSTARR_OP_SUCCESS;
+        }
 
+        if((CUSTARR_OP_SUCCESS == ret_val) && (0 != pthread_rwlock_init(&my_array->lock, NULL)))
+        {
+            /** The lock couldn't be created, give back the memory of the first element **/
+            if(CUSTARR_BACKING_DLINKEDLIST == backing)
+            {
+                (void)dlinkedlist_delete_end(&my_array->dlist);
+            }
+            else if(CUSTARR_BACKING_BUFFER == backing)
+            {
+                free(my_array->buffer_ptr);
+                my_array->buffer_ptr = NULL;
+            }
+            else
+            {
+                /** The first element is stored in the head node **/
+            }
+            ret_val = CUSTARR_OP_FAIL;
+        }
 
-        my_array->lock = ARRAY_UNLOCKED;
+        if(CUSTARR_OP_SUCCESS == ret_val)
+        {
+            my_array->init_status = ARRAY_INITIALIZED;
+            my_array->self_ptr = (void*)my_array;
+        }
     }
 
     return ret_val;
@@ -85,15 +165,15 @@ custarr_std_ret_t initArray(custarr_t *my_array, size_t initial_capacity)
 
 *
 ** Return Value:
-*  - pthread_mutex_t
+*  - custarr_lock_status_t
 *    Returns the status of the array lock
 *    -- ARRAY_UNLOCKED
 *    -- ARRAY_LOCKED
 
 *********************************************************************************************************************/
-pthread_mutex_t lock_getstatus(custarr_t *my_array)
+custarr_lock_status_t lock_getstatus(custarr_t *my_array)
 {
-    return my_array->lock;
+    return array_lockstatus(my_array);
 }
 
 
@@ -123,10 +203,25 @@ custarr_std_ret_t insertElement_atEnd(custarr_t *my_array, int data)
 {
     custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
     linkedlist_std_ret_t  linkedlist_ret_val = LINKEDLIST_OP_FAIL;
-    my_array->lock = ARRAY_LOCKED;
+    pthread_rwlock_wrlock(&my_array->lock);
     if((my_array->size) < (my_array->capacity))
     {
-        linkedlist_ret_val = linkedlist_insert_end(&my_array->head_node, data);
+        if(CUSTARR_BACKING_DLINKEDLIST == my_array->backing)
+        {
+            linkedlist_ret_val = dlinkedlist_insert_end(&my_array->dlist, data);
+        }
+        else if(CUSTARR_BACKING_BUFFER == my_array->backing)
+        {
+            if(CUSTARR_OP_SUCCESS == buffer_reserve(my_array, my_array->size + 1))
+            {
+                my_array->buffer_ptr[my_array->size] = data;
+                linkedlist_ret_val = LINKEDLIST_OP_SUCCESS;
+            }
+        }
+        else
+        {
+            linkedlist_ret_val = linkedlist_insert_end(&my_array->head_node, data);
+        }
         if(LINKEDLIST_OP_SUCCESS == linkedlist_ret_val)
         {
             my_array->size = my_array->size + 1; /** increment size **/
@@ -137,7 +232,7 @@ custarr_std_ret_t insertElement_atEnd(custarr_t *my_array, int data)
     {
         ret_val = CUSTARR_OP_FULL; /** Array capacity exceeded, so you can't add more elements. **/
     }
-    my_array->lock = ARRAY_UNLOCKED;
+    pthread_rwlock_unlock(&my_array->lock);
 
     return ret_val;
 }
@@ -169,12 +264,35 @@ custarr_std_ret_t insertElement_atEnd(custarr_t *my_array, int data)
 custarr_std_ret_t insertElement_atIndex(custarr_t *my_array, size_t index, int data)
 {
     custarr_std_ret_t custarr_ret_val = CUSTARR_OP_FAIL;
-    size_t array_new_size = my_array->size + 1;
+    size_t array_new_size = 0;
     linkedlist_std_ret_t  linkedlist_ret_val = LINKEDLIST_OP_FAIL;
-    my_array->lock = ARRAY_LOCKED;
+    pthread_rwlock_wrlock(&my_array->lock);
+    array_new_size = my_array->size + 1;
     if((array_new_size <= my_array->capacity) && (index < array_new_size))
     {
-         linkedlist_ret_val = linkedlist_insert_index(&my_array->head_node, index, data);
+         if(CUSTARR_BACKING_DLINKEDLIST == my_array->backing)
+         {
+             /** Like the head node, the first element can't be moved by an insertion **/
+             if(0u != index)
+             {
+                 linkedlist_ret_val = dlinkedlist_insert_index(&my_array->dlist, index, data);
+             }
+         }
+         else if(CUSTARR_BACKING_BUFFER == my_array->backing)
+         {
+             /** Like the head node, the first element can't be moved by an insertion **/
+             if((0u != index) && (CUSTARR_OP_SUCCESS == buffer_reserve(my_array, array_new_size)))
+             {
+                 memmove(&my_array->buffer_ptr[index + 1], &my_array->buffer_ptr[index],
+                         (my_array->size - index) * sizeof(int));
+                 my_array->buffer_ptr[index] = data;
+                 linkedlist_ret_val = LINKEDLIST_OP_SUCCESS;
+             }
+         }
+         else
+         {
+             linkedlist_ret_val = linkedlist_insert_index(&my_array->head_node, index, data);
+         }
 
          if(LINKEDLIST_OP_SUCCESS == linkedlist_ret_val)
          {
@@ -187,7 +305,7 @@ custarr_std_ret_t insertElement_atIndex(custarr_t *my_array, size_t index, int d
     {
         custarr_ret_val = CUSTARR_OP_OUTOFRANGE;
     }
-    my_array->lock = ARRAY_UNLOCKED;
+    pthread_rwlock_unlock(&my_array->lock);
     return custarr_ret_val;
 }
 
@@ -215,16 +333,38 @@ custarr_std_ret_t deleteElement_atEnd(custarr_t *my_array)
 {
     custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
     linkedlist_std_ret_t  linkedlist_ret_val = LINKEDLIST_OP_FAIL;
-    my_array->lock = ARRAY_LOCKED;
+    pthread_rwlock_wrlock(&my_array->lock);
 
-    if((ARRAY_INITIALIZED == my_array->init_status) && (NULL != my_array->head_node.next_node_address_ptr))
+    if((CUSTARR_BACKING_DLINKEDLIST == my_array->backing) && (ARRAY_INITIALIZED == my_array->init_status) &&
+       (1u < dlinkedlist_size(&my_array->dlist)))
+    {
+        linkedlist_ret_val =   dlinkedlist_delete_end(&my_array->dlist);
+        if(LINKEDLIST_OP_SUCCESS == linkedlist_ret_val)
+        {
+            ret_val = CUSTARR_OP_SUCCESS;
+        }
+        my_array->size = my_array->size - 1;
+    }
+    else if((CUSTARR_BACKING_BUFFER == my_array->backing) && (ARRAY_INITIALIZED == my_array->init_status) &&
+            (1u < my_array->size))
+    {
+        /** The element is only dropped, its slot is reused by the next insertion **/
+        ret_val = CUSTARR_OP_SUCCESS;
+        my_array->size = my_array->size - 1;
+    }
+    else if((CUSTARR_BACKING_LINKEDLIST == my_array->backing) && (ARRAY_INITIALIZED == my_array->init_status) &&
+            (NULL != my_array->head_node.next_node_address_ptr))
     {
         linkedlist_ret_val =   linkedlist_delete_end(&my_array->head_node);
         ret_val = linkedlist_ret_val;
         my_array->size = my_array->size - 1;
     }
+    else
+    {
+        /** Nothing to delete, the first element always stays **/
+    }
 
-    my_array->lock = ARRAY_UNLOCKED;
+    pthread_rwlock_unlock(&my_array->lock);
     return ret_val;
 
 }
@@ -255,10 +395,31 @@ custarr_std_ret_t deleteElement_atIndex(custarr_t *my_array, size_t index)
     custarr_std_ret_t custarr_ret_val = CUSTARR_OP_FAIL;
     linkedlist_std_ret_t  linkedlist_ret_val = LINKEDLIST_OP_FAIL;
 
-    my_array->lock = ARRAY_LOCKED;
+    pthread_rwlock_wrlock(&my_array->lock);
     if(index < my_array->size)
     {
-         linkedlist_ret_val = linkedlist_delete_index(&my_array->head_node, index);
+         if(CUSTARR_BACKING_DLINKEDLIST == my_array->backing)
+         {
+             /** Like the head node, the first element can't be deleted **/
+             if(0u != index)
+             {
+                 linkedlist_ret_val = dlinkedlist_delete_index(&my_array->dlist, index);
+             }
+         }
+         else if(CUSTARR_BACKING_BUFFER == my_array->backing)
+         {
+             /** Like the head node, the first element can't be deleted **/
+             if(0u != index)
+             {
+                 memmove(&my_array->buffer_ptr[index], &my_array->buffer_ptr[index + 1],
+                         (my_array->size - index - 1) * sizeof(int));
+                 linkedlist_ret_val = LINKEDLIST_OP_SUCCESS;
+             }
+         }
+         else
+         {
+             linkedlist_ret_val = linkedlist_delete_index(&my_array->head_node, index);
+         }
 
          if(LINKEDLIST_OP_SUCCESS == linkedlist_ret_val)
          {
@@ -271,7 +432,7 @@ custarr_std_ret_t deleteElement_atIndex(custarr_t *my_array, size_t index)
     {
         custarr_ret_val = CUSTARR_OP_OUTOFRANGE;
     }
-    my_array->lock = ARRAY_UNLOCKED;
+    pthread_rwlock_unlock(&my_array->lock);
     return custarr_ret_val;
 
 }
@@ -300,10 +461,24 @@ custarr_std_ret_t deleteElement_atIndex(custarr_t *my_array, size_t index)
 custarr_std_ret_t getElement_atEnd(custarr_t *my_array, int* data)
 {
     custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
+    linkedlist_std_ret_t linkedlist_ret_val = LINKEDLIST_OP_FAIL;
 
-    my_array->lock = ARRAY_LOCKED;
-    ret_val = linkedlist_get_end(&my_array->head_node, data);
-    my_array->lock = ARRAY_UNLOCKED;
+    pthread_rwlock_rdlock(&my_array->lock);
+    if(CUSTARR_BACKING_DLINKEDLIST == my_array->backing)
+    {
+        linkedlist_ret_val = dlinkedlist_get_end(&my_array->dlist, data);
+    }
+    else if(CUSTARR_BACKING_BUFFER == my_array->backing)
+    {
+        *data = my_array->buffer_ptr[my_array->size - 1];
+        linkedlist_ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+    else
+    {
+        linkedlist_ret_val = linkedlist_get_end(&my_array->head_node, data);
+    }
+    ret_val = linkedlist_ret_val;
+    pthread_rwlock_unlock(&my_array->lock);
     return ret_val;
 }
 
@@ -334,17 +509,28 @@ custarr_std_ret_t getElement_atIndex(custarr_t *my_array, size_t index, int* dat
 {
     custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
 
-    my_array->lock = ARRAY_LOCKED;
+    pthread_rwlock_rdlock(&my_array->lock);
     if(index < (my_array->size))
     {
-        linkedlist_get_index(&my_array->head_node, index, data);
+        if(CUSTARR_BACKING_DLINKEDLIST == my_array->backing)
+        {
+            dlinkedlist_get_index(&my_array->dlist, index, data);
+        }
+        else if(CUSTARR_BACKING_BUFFER == my_array->backing)
+        {
+            *data = my_array->buffer_ptr[index];
+        }
+        else
+        {
+            linkedlist_get_index(&my_array->head_node, index, data);
+        }
         ret_val = CUSTARR_OP_SUCCESS;
     }
     else
     {
         ret_val = CUSTARR_OP_OUTOFRANGE;
     }
-    my_array->lock = ARRAY_UNLOCKED;
+    pthread_rwlock_unlock(&my_array->lock);
     return ret_val;
 
 }
@@ -373,18 +559,69 @@ custarr_std_ret_t getElement_atIndex(custarr_t *my_array, size_t index, int* dat
 custarr_std_ret_t freeArray(custarr_t *my_array)
 {
     custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
-    linkedlist_std_ret_t linkedlist_ret_val = LINKEDLIST_OP_FAIL;
 
-    my_array->lock = ARRAY_LOCKED;
-    /** Only free if the array is initialized and it has dynamically allocated data **/
-    if((ARRAY_INITIALIZED == my_array->init_status) && (NULL != my_array->head_node.next_node_address_ptr))
+    /** Only free if the array is initialized, its lock doesn't exist otherwise **/
+    if(ARRAY_INITIALIZED == my_array->init_status)
     {
-        linkedlist_ret_val = linkedlist_delete_all(&my_array->head_node);
-        my_array->size = 1;
-        ret_val = linkedlist_ret_val;
+        pthread_rwlock_wrlock(&my_array->lock);
+        ret_val = elements_free(my_array);
+        pthread_rwlock_unlock(&my_array->lock);
+    }
+
+    return ret_val;
+}
+
 
+/*********************************************************************************************************************
+** Function Name:
+*  array_destroy
+*
+** Purpose:
+*  This function frees all the memory of the array, including the first element freeArray() keeps, destroys its
+*  lock and marks the array as uninitialized, so it can be initialized again. No other thread may use the array
+*  during or after the call.
+*
+** Input Parameters:
+*  - array: CustomArray*
+*    A pointer to an object created of type CustomArray, which contains all the information for the created array.
+*
+** Return Value:
+*  - custarr_std_ret_t
+*    Returns error code of the function:
+*    -- CUSTARR_OP_SUCCESS
+*    -- CUSTARR_OP_FAIL: the array isn't initialized.
+*********************************************************************************************************************/
+custarr_std_ret_t array_destroy(custarr_t *my_array)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
+
+    /** A copied or uninitialized array doesn't own any memory **/
+    if((my_array->self_ptr == (void*)my_array) && (ARRAY_INITIALIZED == my_array->init_status))
+    {
+        pthread_rwlock_wrlock(&my_array->lock);
+        (void)elements_free(my_array);
+        if(CUSTARR_BACKING_DLINKEDLIST == my_array->backing)
+        {
+            /** The node of the first element **/
+            (void)dlinkedlist_delete_all(&my_array->dlist);
+        }
+        else if(CUSTARR_BACKING_BUFFER == my_array->backing)
+        {
+            free(my_array->buffer_ptr);
+            my_array->buffer_ptr = NULL;
+            my_array->buffer_slots = 0;
+        }
+        else
+        {
+            /** The first element is stored in the head node, which isn't dynamically allocated **/
+        }
+        my_array->size = 0;
+        my_array->init_status = ARRAY_UNINITIALIZED;
+        my_array->self_ptr = NULL;
+        pthread_rwlock_unlock(&my_array->lock);
+        pthread_rwlock_destroy(&my_array->lock);
+        ret_val = CUSTARR_OP_SUCCESS;
     }
-    my_array->lock = ARRAY_UNLOCKED;
 
     return ret_val;
 }
@@ -408,7 +645,13 @@ custarr_std_ret_t freeArray(custarr_t *my_array)
 /** Returns array current size (total number of active nodes)**/
 size_t array_sizeGet(custarr_t *my_array)
 {
-    return my_array->size;
+    size_t array_size = 0;
+
+    pthread_rwlock_rdlock(&my_array->lock);
+    array_size = my_array->size;
+    pthread_rwlock_unlock(&my_array->lock);
+
+    return array_size;
 }
 
 
@@ -430,7 +673,13 @@ size_t array_sizeGet(custarr_t *my_array)
 /** Returns array current capacity (maximum number of elements(nodes) array can hold)**/
 size_t array_capacityGet(custarr_t *my_array)
 {
-    return my_array->capacity;
+    size_t array_capacity = 0;
+
+    pthread_rwlock_rdlock(&my_array->lock);
+    array_capacity = my_array->capacity;
+    pthread_rwlock_unlock(&my_array->lock);
+
+    return array_capacity;
 }
 
 
@@ -446,14 +695,24 @@ size_t array_capacityGet(custarr_t *my_array)
 *    A pointer to an object created of type CustomArray, which contains all the information for the created array.
 *
 ** Return Value:
-*  - pthread_mutex_t
+*  - custarr_lock_status_t
 *    Returns lock status of the function:
 *    -- ARRAY_UNLOCKED
-*    -- ARRAY_LOCKED
+*    -- ARRAY_LOCKED: another thread is reading or changing the array. The status can change as soon as it is
+*       returned, so it can only be used as a hint.
 *********************************************************************************************************************/
-pthread_mutex_t array_lockstatus(custarr_t *my_array)
+custarr_lock_status_t array_lockstatus(custarr_t *my_array)
 {
-    return my_array->lock;
+    custarr_lock_status_t ret_val = ARRAY_LOCKED;
+
+    /** The lock is free if it can be taken for writing right away **/
+    if(0 == pthread_rwlock_trywrlock(&my_array->lock))
+    {
+        pthread_rwlock_unlock(&my_array->lock);
+        ret_val = ARRAY_UNLOCKED;
+    }
+
+    return ret_val;
 }
 
 
@@ -481,6 +740,7 @@ pthread_mutex_t array_lockstatus(custarr_t *my_array)
 custarr_std_ret_t array_capacityUpdate(custarr_t *my_array, size_t new_capacity)
 {
     custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
+    pthread_rwlock_wrlock(&my_array->lock);
     if(new_capacity >= my_array->size)
     {
         my_array->capacity = new_capacity;
@@ -490,10 +750,543 @@ custarr_std_ret_t array_capacityUpdate(custarr_t *my_array, size_t new_capacity)
     {
         /** New capacity can't be smaller than current array size**/
     }
+    pthread_rwlock_unlock(&my_array->lock);
+
+    return ret_val;
+
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  array_iterInit
+*
+** Purpose:
+*  Places an iterator at the first element of the array.
+*
+** Input Parameters:
+*  - array: CustomArray*
+*    A pointer to an object created of type CustomArray, which contains all the information for the created array.
+*  - my_iter: custarr_iter_t*
+*    A pointer to the iterator to be initialized.
+*
+** Return Value:
+*  - custarr_std_ret_t
+*    Returns error code of the function:
+*    -- CUSTARR_OP_SUCCESS
+*    -- CUSTARR_OP_FAIL
+*********************************************************************************************************************/
+custarr_std_ret_t array_iterInit(custarr_t *my_array, custarr_iter_t *my_iter)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
+
+    if(ARRAY_INITIALIZED == my_array->init_status)
+    {
+        my_iter->array_ptr = my_array;
+        my_iter->dnode_current_ptr = NULL;
+        my_iter->element_index = 0;
+        if(CUSTARR_BACKING_DLINKEDLIST == my_array->backing)
+        {
+            my_iter->dnode_current_ptr = dlinkedlist_node_front(&my_array->dlist);
+            ret_val = CUSTARR_OP_SUCCESS;
+        }
+        else if(CUSTARR_BACKING_BUFFER == my_array->backing)
+        {
+            ret_val = CUSTARR_OP_SUCCESS;
+        }
+        else if(LINKEDLIST_OP_SUCCESS == linkedlist_cursor_init_chain(&my_iter->cursor, &my_array->head_node))
+        {
+            ret_val = CUSTARR_OP_SUCCESS;
+        }
+        else
+        {
+            /** Do nothing **/
+        }
+    }
 
     return ret_val;
+}
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  array_iterNext
+*
+** Purpose:
+*  Moves an iterator to the next element of the array.
+*
+** Input Parameters:
+*  - my_iter: custarr_iter_t*
+*    A pointer to the iterator.
+*
+** Return Value:
+*  - custarr_std_ret_t
+*    Returns error code of the function:
+*    -- CUSTARR_OP_SUCCESS
+*    -- CUSTARR_OP_OUTOFRANGE: the iterator already went past the last element.
+*********************************************************************************************************************/
+custarr_std_ret_t array_iterNext(custarr_iter_t *my_iter)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_OUTOFRANGE;
+
+    if(CUSTARR_BACKING_DLINKEDLIST == my_iter->array_ptr->backing)
+    {
+        if(NULL != my_iter->dnode_current_ptr)
+        {
+            my_iter->dnode_current_ptr = dlinkedlist_node_next(&my_iter->array_ptr->dlist, my_iter->dnode_current_ptr);
+            ret_val = CUSTARR_OP_SUCCESS;
+        }
+    }
+    else if(CUSTARR_BACKING_BUFFER == my_iter->array_ptr->backing)
+    {
+        if(my_iter->element_index < my_iter->array_ptr->size)
+        {
+            my_iter->element_index = my_iter->element_index + 1;
+            ret_val = CUSTARR_OP_SUCCESS;
+        }
+    }
+    else if(LINKEDLIST_OP_SUCCESS == linkedlist_cursor_next(&my_iter->cursor))
+    {
+        ret_val = CUSTARR_OP_SUCCESS;
+    }
+    else
+    {
+        /** Do nothing **/
+    }
 
+    return ret_val;
 }
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  array_iterGet
+*
+** Purpose:
+*  Returns the value of the element an iterator is at.
+*
+** Input Parameters:
+*  - my_iter: custarr_iter_t*
+*    A pointer to the iterator.
+*  - data: int*
+*    points to the variable in which the returned data will be stored.
+*
+** Return Value:
+*  - custarr_std_ret_t
+*    Returns error code of the function:
+*    -- CUSTARR_OP_SUCCESS
+*    -- CUSTARR_OP_OUTOFRANGE: the iterator went past the last element.
+*********************************************************************************************************************/
+custarr_std_ret_t array_iterGet(custarr_iter_t *my_iter, int* data)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_OUTOFRANGE;
+
+    if(CUSTARR_BACKING_DLINKEDLIST == my_iter->array_ptr->backing)
+    {
+        if(NULL != my_iter->dnode_current_ptr)
+        {
+            *data = my_iter->dnode_current_ptr->data;
+            ret_val = CUSTARR_OP_SUCCESS;
+        }
+    }
+    else if(CUSTARR_BACKING_BUFFER == my_iter->array_ptr->backing)
+    {
+        if(my_iter->element_index < my_iter->array_ptr->size)
+        {
+            *data = my_iter->array_ptr->buffer_ptr[my_iter->element_index];
+            ret_val = CUSTARR_OP_SUCCESS;
+        }
+    }
+    else if(LINKEDLIST_OP_SUCCESS == linkedlist_cursor_peek(&my_iter->cursor, data))
+    {
+        ret_val = CUSTARR_OP_SUCCESS;
+    }
+    else
+    {
+        /** Do nothing **/
+    }
+
+    return ret_val;
+}
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  array_iterInsertAfter
+*
+** Purpose:
+*  Inserts an element right after the element an iterator is at, or at the end of the array if the iterator went
+*  past the last element. The iterator stays at its element.
+*
+** Input Parameters:
+*  - my_iter: custarr_iter_t*
+*    A pointer to the iterator.
+*  - data: int
+*    Value to be stored in the created element.
+*
+** Return Value:
+*  - custarr_std_ret_t
+*    Returns error code of the function:
+*    -- CUSTARR_OP_SUCCESS
+*    -- CUSTARR_OP_FAIL
+*    -- CUSTARR_OP_FULL
+*********************************************************************************************************************/
+custarr_std_ret_t array_iterInsertAfter(custarr_iter_t *my_iter, int data)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
+
+    pthread_rwlock_wrlock(&my_iter->array_ptr->lock);
+    ret_val = iter_insert_after(my_iter, data);
+    pthread_rwlock_unlock(&my_iter->array_ptr->lock);
+
+    return ret_val;
+}
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  array_iterErase
+*
+** Purpose:
+*  Deletes the element an iterator is at. The iterator moves to the element after it. The first element of the array
+*  is stored in the array head node, so it can't be erased.
+*
+** Input Parameters:
+*  - my_iter: custarr_iter_t*
+*    A pointer to the iterator.
+*
+** Return Value:
+*  - custarr_std_ret_t
+*    Returns error code of the function:
+*    -- CUSTARR_OP_SUCCESS
+*    -- CUSTARR_OP_FAIL
+*********************************************************************************************************************/
+custarr_std_ret_t array_iterErase(custarr_iter_t *my_iter)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
+    custarr_t *my_array = my_iter->array_ptr;
+    linkedlist_std_ret_t linkedlist_ret_val = LINKEDLIST_OP_FAIL;
+    struct dnode_t* dnode_next = NULL;
+
+    pthread_rwlock_wrlock(&my_array->lock);
+    if(CUSTARR_BACKING_DLINKEDLIST == my_array->backing)
+    {
+        /** Like the head node, the first element can't be erased **/
+        if((NULL != my_iter->dnode_current_ptr) &&
+           (dlinkedlist_node_front(&my_array->dlist) != my_iter->dnode_current_ptr))
+        {
+            dnode_next = dlinkedlist_node_next(&my_array->dlist, my_iter->dnode_current_ptr);
+            linkedlist_ret_val = dlinkedlist_delete_node(&my_array->dlist, my_iter->dnode_current_ptr);
+            my_iter->dnode_current_ptr = dnode_next;
+        }
+    }
+    else if(CUSTARR_BACKING_BUFFER == my_array->backing)
+    {
+        /** Like the head node, the first element can't be erased. The element after it moves to its index, where the
+            iterator stays. **/
+        if((0u != my_iter->element_index) && (my_iter->element_index < my_array->size))
+        {
+            memmove(&my_array->buffer_ptr[my_iter->element_index], &my_array->buffer_ptr[my_iter->element_index + 1],
+                    (my_array->size - my_iter->element_index - 1) * sizeof(int));
+            linkedlist_ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+    }
+    else
+    {
+        linkedlist_ret_val = linkedlist_cursor_erase(&my_iter->cursor);
+    }
+
+    if(LINKEDLIST_OP_SUCCESS == linkedlist_ret_val)
+    {
+        my_array->size = my_array->size - 1;
+        ret_val = CUSTARR_OP_SUCCESS;
+    }
+    pthread_rwlock_unlock(&my_array->lock);
+
+    return ret_val;
+}
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  array_snapshotSave
+*
+** Purpose:
+*  Writes all the elements of the array to a binary snapshot file, see linkedlist_snapshot.h. The array can then be
+*  rebuilt with array_snapshotLoad() instead of inserting its elements one by one.
+*
+** Input Parameters:
+*  - array: CustomArray*
+*    A pointer to an object created of type CustomArray, which contains all the information for the created array.
+*  - file_path: const char*
+*    Path of the snapshot file.
+*
+** Return Value:
+*  - custarr_std_ret_t
+*    Returns error code of the function:
+*    -- CUSTARR_OP_SUCCESS
+*    -- CUSTARR_OP_FAIL: the array isn't initialized, or the file couldn't be written.
+*********************************************************************************************************************/
+custarr_std_ret_t array_snapshotSave(custarr_t *my_array, const char* file_path)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
+    linkedlist_snapshot_ret_t snapshot_ret_val = LINKEDLIST_SNAPSHOT_OP_FAIL;
+    linkedlist_snapshot_writer_t* my_writer = NULL;
+    custarr_iter_t my_iter;
+    int data = 0;
+
+    /** The writer holds a whole block of elements, so it is too large to be kept on the stack **/
+    my_writer = (linkedlist_snapshot_writer_t*)malloc(sizeof(linkedlist_snapshot_writer_t));
+    if((NULL != my_writer) && (CUSTARR_OP_SUCCESS == array_iterInit(my_array, &my_iter)))
+    {
+        /** Other threads can keep reading the array, but it can't be changed until all of it is written **/
+        pthread_rwlock_rdlock(&my_array->lock);
+        if(LINKEDLIST_SNAPSHOT_OP_SUCCESS == linkedlist_snapshot_writer_open(my_writer, file_path))
+        {
+            snapshot_ret_val = LINKEDLIST_SNAPSHOT_OP_SUCCESS;
+            while((LINKEDLIST_SNAPSHOT_OP_SUCCESS == snapshot_ret_val) &&
+                  (CUSTARR_OP_SUCCESS == array_iterGet(&my_iter, &data)))
+            {
+                snapshot_ret_val = linkedlist_snapshot_writer_put(my_writer, &data, 1u);
+                array_iterNext(&my_iter);
+            }
+            if((LINKEDLIST_SNAPSHOT_OP_SUCCESS == snapshot_ret_val) &&
+               (LINKEDLIST_SNAPSHOT_OP_SUCCESS == linkedlist_snapshot_writer_close(my_writer)))
+            {
+                ret_val = CUSTARR_OP_SUCCESS;
+            }
+        }
+        pthread_rwlock_unlock(&my_array->lock);
+    }
+    free(my_writer);
+
+    return ret_val;
+}
+
+
+/*********************************************************************************************************************
+** Function Name:
+*  array_snapshotLoad
+*
+** Purpose:
+*  Replaces all the elements of the array with the elements of a snapshot file written by array_snapshotSave(). The
+*  file is mapped to memory and checked completely first, so the array stays as it was if the file is rejected. The
+*  elements are then linked one after the other in O(n) in total, while inserting them at the end one by one takes
+*  O(n^2) with the singly linked backing. A buffer backed array copies them all with one memcpy().
+*
+** Input Parameters:
+*  - array: CustomArray*
+*    A pointer to an object created of type CustomArray, which contains all the information for the created array.
+*  - file_path: const char*
+*    Path of the snapshot file.
+*
+** Return Value:
+*  - custarr_std_ret_t
+*    Returns error code of the function:
+*    -- CUSTARR_OP_SUCCESS
+*    -- CUSTARR_OP_FAIL: the array isn't initialized, the file couldn't be read or is corrupt, or it holds no element.
+*       If memory runs out while loading, the array keeps the elements loaded so far.
+*    -- CUSTARR_OP_FULL: the file holds more elements than the array capacity.
+*********************************************************************************************************************/
+custarr_std_ret_t array_snapshotLoad(custarr_t *my_array, const char* file_path)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
+    linkedlist_snapshot_map_t my_map;
+    custarr_iter_t my_iter;
+    size_t loop_cntr = 0;
+
+    if((ARRAY_INITIALIZED == my_array->init_status) &&
+       (LINKEDLIST_SNAPSHOT_OP_SUCCESS == linkedlist_snapshot_map(&my_map, file_path)))
+    {
+        /** The array is locked for the whole load, so other threads never see it partly loaded **/
+        pthread_rwlock_wrlock(&my_array->lock);
+        if(my_map.element_count > my_array->capacity)
+        {
+            ret_val = CUSTARR_OP_FULL;
+        }
+        else if(0u != my_map.element_count)
+        {
+            /** The first element is kept by freeArray(), so it is overwritten instead of inserted **/
+            (void)elements_free(my_array);
+            if(CUSTARR_BACKING_BUFFER == my_array->backing)
+            {
+                /** The buffer is grown once, then all the elements are copied at once **/
+                ret_val = buffer_reserve(my_array, my_map.element_count);
+                if(CUSTARR_OP_SUCCESS == ret_val)
+                {
+                    memcpy(my_array->buffer_ptr, my_map.data_ptr, my_map.element_count * sizeof(int));
+                    my_array->size = my_map.element_count;
+                }
+            }
+            else
+            {
+                if(CUSTARR_BACKING_DLINKEDLIST == my_array->backing)
+                {
+                    dlinkedlist_node_front(&my_array->dlist)->data = my_map.data_ptr[0];
+                }
+                else
+                {
+                    my_array->head_node.data = my_map.data_ptr[0];
+                }
+
+                /** The iterator stays at the last element, so every insert is O(1) **/
+                ret_val = array_iterInit(my_array, &my_iter);
+                for(loop_cntr = 1; (loop_cntr < my_map.element_count) && (CUSTARR_OP_SUCCESS == ret_val);
+                    loop_cntr++)
+                {
+                    ret_val = iter_insert_after(&my_iter, my_map.data_ptr[loop_cntr]);
+                    array_iterNext(&my_iter);
+                }
+            }
+        }
+        else
+        {
+            /** An array always has its first element, it can't be loaded from an empty snapshot **/
+        }
+        pthread_rwlock_unlock(&my_array->lock);
+        linkedlist_snapshot_unmap(&my_map);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+/** Makes the buffer of the array hold at least element_count elements. The buffer doubles, or grows to element_count
+    if that is more, so n insertions at the end copy O(n) elements in total. It doesn't grow past the array capacity,
+    no element could be stored there. **/
+static custarr_std_ret_t buffer_reserve(custarr_t *my_array, size_t element_count)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_SUCCESS;
+    size_t slots_new = my_array->buffer_slots * 2u;
+    int* buffer_new = NULL;
+
+    if(element_count > my_array->buffer_slots)
+    {
+        if(slots_new < element_count)
+        {
+            slots_new = element_count;
+        }
+        if((slots_new > my_array->capacity) && (my_array->capacity >= element_count))
+        {
+            slots_new = my_array->capacity;
+        }
+
+        buffer_new = (int*)realloc(my_array->buffer_ptr, slots_new * sizeof(int));
+        if(NULL != buffer_new)
+        {
+            my_array->buffer_ptr   = buffer_new;
+            my_array->buffer_slots = slots_new;
+        }
+        else
+        {
+            /** Out of memory, the array keeps its buffer and its elements **/
+            ret_val = CUSTARR_OP_FAIL;
+        }
+    }
+
+    return ret_val;
+}
+
+/** Body of freeArray(), the caller holds the array lock for writing **/
+static custarr_std_ret_t elements_free(custarr_t *my_array)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
+    linkedlist_std_ret_t linkedlist_ret_val = LINKEDLIST_OP_FAIL;
+    int* buffer_new = NULL;
+
+    /** Only free if the array has dynamically allocated data **/
+    if((CUSTARR_BACKING_DLINKEDLIST == my_array->backing) && (1u < dlinkedlist_size(&my_array->dlist)))
+    {
+        /** Keep the node of the first element, as the head node is kept otherwise **/
+        while(1u < dlinkedlist_size(&my_array->dlist))
+        {
+            linkedlist_ret_val = dlinkedlist_delete_end(&my_array->dlist);
+        }
+        my_array->size = 1;
+        if(LINKEDLIST_OP_SUCCESS == linkedlist_ret_val)
+        {
+            ret_val = CUSTARR_OP_SUCCESS;
+        }
+    }
+    else if((CUSTARR_BACKING_BUFFER == my_array->backing) && (1u < my_array->size))
+    {
+        /** Keep the first element, and give back the memory the buffer grew to **/
+        my_array->size = 1;
+        if(my_array->buffer_slots > CUSTARR_BUFFER_MIN_SLOTS)
+        {
+            buffer_new = (int*)realloc(my_array->buffer_ptr, CUSTARR_BUFFER_MIN_SLOTS * sizeof(int));
+            if(NULL != buffer_new)
+            {
+                my_array->buffer_ptr = buffer_new;
+                my_array->buffer_slots = CUSTARR_BUFFER_MIN_SLOTS;
+            }
+        }
+        ret_val = CUSTARR_OP_SUCCESS;
+    }
+    else if((CUSTARR_BACKING_LINKEDLIST == my_array->backing) && (NULL != my_array->head_node.next_node_address_ptr))
+    {
+        linkedlist_ret_val = linkedlist_delete_all(&my_array->head_node);
+        my_array->size = 1;
+        ret_val = linkedlist_ret_val;
+
+    }
+
+    return ret_val;
+}
+
+/** Body of array_iterInsertAfter(), the caller holds the array lock for writing **/
+static custarr_std_ret_t iter_insert_after(custarr_iter_t *my_iter, int data)
+{
+    custarr_std_ret_t ret_val = CUSTARR_OP_FAIL;
+    custarr_t *my_array = my_iter->array_ptr;
+    linkedlist_std_ret_t linkedlist_ret_val = LINKEDLIST_OP_FAIL;
+    size_t element_index = 0;
+
+    if((my_array->size) < (my_array->capacity))
+    {
+        if(CUSTARR_BACKING_DLINKEDLIST == my_array->backing)
+        {
+            if(NULL != my_iter->dnode_current_ptr)
+            {
+                linkedlist_ret_val = dlinkedlist_insert_after(&my_array->dlist, my_iter->dnode_current_ptr, data);
+            }
+            else
+            {
+                linkedlist_ret_val = dlinkedlist_insert_end(&my_array->dlist, data);
+            }
+        }
+        else if(CUSTARR_BACKING_BUFFER == my_array->backing)
+        {
+            /** Past the last element, the new element goes to the end **/
+            element_index = (my_iter->element_index < my_array->size) ? (my_iter->element_index + 1) : my_array->size;
+            if(CUSTARR_OP_SUCCESS == buffer_reserve(my_array, my_array->size + 1))
+            {
+                memmove(&my_array->buffer_ptr[element_index + 1], &my_array->buffer_ptr[element_index],
+                        (my_array->size - element_index) * sizeof(int));
+                my_array->buffer_ptr[element_index] = data;
+                linkedlist_ret_val = LINKEDLIST_OP_SUCCESS;
+            }
+        }
+        else
+        {
+            linkedlist_ret_val = linkedlist_cursor_insert_after(&my_iter->cursor, data);
+        }
+
+        if(LINKEDLIST_OP_SUCCESS == linkedlist_ret_val)
+        {
+            my_array->size = my_array->size + 1;
+            ret_val = CUSTARR_OP_SUCCESS;
+        }
+    }
+    else
+    {
+        ret_val = CUSTARR_OP_FULL;
+    }
+
+    return ret_val;
+}
+
 /*********************************************************************************************************************
                                                << End of File >>
 *********************************************************************************************************************/
@@ -22,12 +22,25 @@
 /*********************************************************************************************************************
                                                << File Inclusions >>
 *********************************************************************************************************************/
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include "linkedlist.h"
+#include "dlinkedlist.h"
 /*********************************************************************************************************************
                                                << Public Constants >>
 *********************************************************************************************************************/
+/** Backing list used by initArray(). Can be overridden at build time, e.g. -DCUSTARR_DEFAULT_BACKING=1 selects the
+    doubly linked list and -DCUSTARR_DEFAULT_BACKING=2 the contiguous buffer. **/
+#ifndef CUSTARR_DEFAULT_BACKING
+#define CUSTARR_DEFAULT_BACKING     CUSTARR_BACKING_LINKEDLIST
+#endif
+
+/** Number of elements the buffer of a CUSTARR_BACKING_BUFFER array is allocated for at first, and never shrinks
+    below. The buffer doubles every time it is full, up to the array capacity. **/
+#ifndef CUSTARR_BUFFER_MIN_SLOTS
+#define CUSTARR_BUFFER_MIN_SLOTS    16u
+#endif
 
 
 /*********************************************************************************************************************
@@ -63,10 +76,10 @@ typedef enum
 
 /*********************************************************************************************************************
 ** Datatype Name:
-*  pthread_mutex_t
+*  custarr_lock_status_t
 *
 ** Description:
-*  Returns lock status of the function.
+*  Returns lock status of the array, see array_lockstatus().
 *
 ** Datatype Elements:
 *  [1] ARRAY_UNLOCKED
@@ -80,7 +93,7 @@ typedef enum
 {
     ARRAY_UNLOCKED = 0,
     ARRAY_LOCKED
-} pthread_mutex_t;
+} custarr_lock_status_t;
 
 /*********************************************************************************************************************
 ** Datatype Name:
@@ -104,12 +117,37 @@ typedef enum
 } array_init_status_t;
 
 
+/*********************************************************************************************************************
+** Datatype Name:
+*  custarr_backing_t
+*
+** Description:
+*  This is an ENUM datatype that selects the list the elements of an array are stored in.
+*
+** Datatype Elements:
+*  [1] CUSTARR_BACKING_LINKEDLIST
+*      Singly linked list. Operations at the end of the array take O(n).
+*  [2] CUSTARR_BACKING_DLINKEDLIST
+*      Doubly linked list. Operations at the end of the array take O(1), and indexes are reached from the closer end.
+*  [3] CUSTARR_BACKING_BUFFER
+*      Contiguous buffer growing geometrically. Reading any index takes O(1), inserting at the end takes amortized
+*      O(1), and inserting or deleting at an index moves the elements after it with one memmove().
+*********************************************************************************************************************/
+typedef enum
+{
+    CUSTARR_BACKING_LINKEDLIST  = 0,
+    CUSTARR_BACKING_DLINKEDLIST = 1,
+    CUSTARR_BACKING_BUFFER      = 2
+} custarr_backing_t;
+
+
 /*********************************************************************************************************************
 ** Datatype Name:
 *  custarr_t
 *
 ** Description:
-*  datatype for storing all the information for the array to be created.
+*  datatype for storing all the information for the array to be created. Once initialized, an array can be used by
+*  several threads at the same time; it must be initialized before it is shared.
 *
 ** Datatype Elements:
 *  [1] head_node: struct node_t
@@ -118,19 +156,71 @@ typedef enum
 *      Stores the current allocated size of the array
 *  [3] capacity: size_t
 *      maximum size that can be allocated for the array.
-*  [4] lock: pthread_mutex_t
-*      mutex to lock access to array while in use.
+*  [4] lock: pthread_rwlock_t
+*      reader-writer lock of the array. Functions only reading the array share it, so they don't block each other,
+*      functions changing the array hold it alone.
 *  [5] init_status: array_init_status_t
 *      stores the initializations status of the array.
+*  [6] self_ptr: void*
+*      stores the address of the array itself once it is initialized, so a copied or uninitialized array is never
+*      taken as initialized.
+*  [7] backing: custarr_backing_t
+*      list the elements of the array are stored in.
+*  [8] dlist: dlinkedlist_t
+*      list that stores the elements when the backing is CUSTARR_BACKING_DLINKEDLIST.
+*  [9] buffer_ptr: int*
+*      buffer that stores the elements when the backing is CUSTARR_BACKING_BUFFER, element i is at buffer_ptr[i].
+*  [10] buffer_slots: size_t
+*      number of elements the buffer is allocated for.
 *********************************************************************************************************************/
 typedef struct {
  struct node_t head_node;
  size_t size;
  size_t capacity;
- pthread_mutex_t lock;
+ pthread_rwlock_t lock;
  array_init_status_t init_status;
+ void* self_ptr;
+ custarr_backing_t backing;
+ dlinkedlist_t dlist;
+ int* buffer_ptr;
+ size_t buffer_slots;
 } custarr_t;
 
+/*********************************************************************************************************************
+** Datatype Name:
+*  custarr_iter_t
+*
+** Description:
+*  datatype for walking through the elements of an array one after the other. Reading every element through the
+*  iterator takes O(n) in total, while reading every element by index takes O(n^2). The iterator doesn't hold the
+*  array lock between calls, so other threads must not change the array while it is walked through.
+*
+** Datatype Elements:
+*  [1] array_ptr: custarr_t*
+*      points to the array the iterator walks through.
+*  [2] cursor: linkedlist_cursor_t
+*      linkedlist cursor at the current element of the array.
+*  [3] dnode_current_ptr: struct dnode_t*
+*      node of the current element when the array is backed by a doubly linked list, NULL past the last element.
+*  [4] element_index: size_t
+*      index of the current element when the array is backed by a buffer, the array size past the last element.
+*
+** Use Example: Sum all the elements of an array:
+*  custarr_iter_t my_iter;
+*  int data = 0, sum = 0;
+*  for(array_iterInit(&my_array, &my_iter); CUSTARR_OP_SUCCESS == array_iterGet(&my_iter, &data);
+*      array_iterNext(&my_iter))
+*  {
+*      sum = sum + data;
+*  }
+*********************************************************************************************************************/
+typedef struct {
+ custarr_t* array_ptr;
+ linkedlist_cursor_t cursor;
+ struct dnode_t* dnode_current_ptr;
+ size_t element_index;
+} custarr_iter_t;
+
 /*********************************************************************************************************************
                                           << Public Variable Declarations >>
 *********************************************************************************************************************/
@@ -140,6 +230,7 @@ typedef struct {
                                            << Public Function Declarations >>
 *********************************************************************************************************************/
 extern custarr_std_ret_t initArray(custarr_t *my_array, size_t initial_capacity);
+extern custarr_std_ret_t initArray_backing(custarr_t *my_array, size_t initial_capacity, custarr_backing_t backing);
 extern custarr_std_ret_t insertElement_atEnd(custarr_t *my_array, int element);
 extern custarr_std_ret_t insertElement_atIndex(custarr_t *my_array, size_t index, int element);
 extern custarr_std_ret_t deleteElement_atEnd(custarr_t *my_array);
@@ -147,10 +238,18 @@ extern custarr_std_ret_t deleteElement_atIndex(custarr_t *my_array, size_t index
 extern custarr_std_ret_t getElement_atEnd(custarr_t *my_array, int* data);
 extern custarr_std_ret_t getElement_atIndex(custarr_t *my_array, size_t index, int* data);
 extern custarr_std_ret_t freeArray(custarr_t *my_array);
+extern custarr_std_ret_t array_destroy(custarr_t *my_array);
 extern size_t array_sizeGet(custarr_t *my_array);
 extern size_t array_capacityGet(custarr_t *my_array);
-extern pthread_mutex_t array_lockstatus(custarr_t *my_array);
+extern custarr_lock_status_t array_lockstatus(custarr_t *my_array);
 extern custarr_std_ret_t array_capacityUpdate(custarr_t *my_array, size_t new_capacity);
+extern custarr_std_ret_t array_iterInit(custarr_t *my_array, custarr_iter_t *my_iter);
+extern custarr_std_ret_t array_iterNext(custarr_iter_t *my_iter);
+extern custarr_std_ret_t array_iterGet(custarr_iter_t *my_iter, int* data);
+extern custarr_std_ret_t array_iterInsertAfter(custarr_iter_t *my_iter, int data);
+extern custarr_std_ret_t array_iterErase(custarr_iter_t *my_iter);
+extern custarr_std_ret_t array_snapshotSave(custarr_t *my_array, const char* file_path);
+extern custarr_std_ret_t array_snapshotLoad(custarr_t *my_array, const char* file_path);
 
 #endif /** CUSTOMARRAY_H_INCLUDED **/
 /*********************************************************************************************************************
@@ -13,10 +13,42 @@
 /*********************************************************************************************************************
                                          << File Inclusions >>
 *********************************************************************************************************************/
+#define _POSIX_C_SOURCE 200809L
+#include <stdint.h>
 #include <stdio.h>
+#include <string.h>
+#include <pthread.h>
 #include "array_test.h"
 #include "CustomArray.h"
+#include "linkedlist_stats.h"
+#include "linkedlist_pool.h"
+#include "linkedlist_parallel.h"
+#include "unrolled_list.h"
+#include "skiplist.h"
+#include "intrusive_list.h"
+#include "lockfree_list.h"
+#include "hoh_list.h"
+#include "persistent_list.h"
+#include "linkedlist_generic.h"
 #define ARRAY_CAPACITY   20
+#define LOCK_TEST_THREADS   4
+#define LOCK_TEST_INSERTS   100
+#define POOL_TEST_SLAB_NODES   4
+#define POOL_TEST_NODES   10
+#define MODEL_TEST_ELEMENTS   1000
+#define MODEL_TEST_OPERATIONS   4000
+#define MODEL_TEST_SEED   1234u
+#define MODEL_TEST_RANGE   20
+#define MODEL_TEST_VALUE_RANGE   50 /** small enough for lists to hold repeated values **/
+#define LOCKFREE_TEST_KEY_RANGE   256
+#define LOCKFREE_TEST_KEYS   ((2 * MODEL_TEST_ELEMENTS) / LOCK_TEST_THREADS) /** keys of every thread **/
+#define PARALLEL_TEST_NODES   ((8u * LINKEDLIST_PARALLEL_PART_MIN) + 7u) /** cut into many uneven parts **/
+#define PARALLEL_TEST_TASKS   100u
+#define DLIST_TEST_NODES   100
+#define DLIST_TEST_SPLICES   500
+#define STATS_TEST_NODES   100u
+#define STATS_TEST_JSON_BYTES   32768u /** more than the JSON of all the counters takes **/
+#define STATS_TEST_MEMBER_BYTES   1024u
 
 /*********************************************************************************************************************
                                   << Private Datatypes >>
@@ -28,10 +60,50 @@ typedef enum
 
 }test_result_t;
 
+/** Record linked by the intrusive list through its embedded link **/
+typedef struct
+{
+    int record_id;
+    struct intrusive_link_t record_link;
+} test_record_t;
+
+/** Work given to every thread of the concurrent list tests **/
+typedef struct
+{
+    int thread_index;
+    test_result_t thread_result;
+} list_thread_arg_t;
+
+/** Elements collected by the visit function of the traversal test and the chunk function of the export test. The
+    chunk function also counts its calls, and fails the call_limit-th one unless call_limit is 0. **/
+typedef struct
+{
+    int data_array[MODEL_TEST_ELEMENTS];
+    size_t data_count;
+    size_t call_count;
+    size_t call_limit;
+} visit_context_t;
+
+/** Element of the list generated by LINKEDLIST_DEFINE(), larger than an int and holding a copied array **/
+typedef struct
+{
+    int point_id;
+    double point_weight;
+    char point_tag[8];
+} test_point_t;
+
+LINKEDLIST_DEFINE(test_pointlist, test_point_t)
+
 /*********************************************************************************************************************
                                   << Private Variable Declarations >>
 *********************************************************************************************************************/
 static custarr_t my_array;
+static custarr_t my_dlist_array; /** array backed by a doubly linked list **/
+static custarr_t my_buffer_array; /** array backed by a contiguous buffer **/
+static custarr_t my_shared_array; /** array used by several threads at the same time **/
+static lockfree_list_t my_lockfree_list; /** lock-free list used by several threads at the same time **/
+static hoh_list_t my_hoh_list; /** hand-over-hand locking list used by several threads at the same time **/
+static persistent_list_t my_persistent_list; /** persistent list read by several threads while it is appended to **/
 static FILE *fptr; /** pointer to the file that will be used for logging test results **/
 /*********************************************************************************************************************
                                   << Private Function Declarations >>
@@ -43,6 +115,62 @@ static void getElement_atEnd_test(void);
 static void insertElement_atIndex_test(void);
 static void deleteElement_atIndex_test(void);
 static void getElement_atIndex_test(void);
+static void iterator_test(void);
+static void generic_list_test(void);
+static void dlinkedlist_backing_test(void);
+static void dlinkedlist_test(void);
+static void buffer_backing_test(void);
+static void snapshot_test(void);
+static void lock_test(void);
+static void* lock_test_thread(void* thread_arg);
+static void pool_test(void);
+static void unrolled_list_test(void);
+static void skiplist_test(void);
+static void cursor_test(void);
+static void insert_range_test(void);
+static void delete_range_test(void);
+static void intrusive_list_test(void);
+static void lockfree_list_test(void);
+static void* lockfree_test_thread(void* thread_arg);
+static void hoh_list_test(void);
+static void* hoh_test_thread(void* thread_arg);
+static void* hoh_test_delete_thread(void* thread_arg);
+static void sort_test(void);
+static void merge_test(void);
+static void compact_test(void);
+static void traversal_test(void);
+static void traversal_test_visit(int data, void* context);
+static void head_insert_index_test(void);
+static void stats_test(void);
+static void parallel_test(void);
+static int parallel_test_divisible(int data, void* context);
+static int parallel_test_equal(int data, void* context);
+static void parallel_test_task(void* task_array, size_t task_index);
+static void search_test(void);
+static void persistent_list_test(void);
+static void splice_test(void);
+static void array_export_test(void);
+static linkedlist_std_ret_t export_test_chunk(const int* data_array, size_t data_count, void* context);
+static test_result_t stats_call_check(const linkedlist_stats_t* stats_before, const linkedlist_stats_t* stats_after,
+                                      linkedlist_stats_op_t stats_op, unsigned long long nodes_expected);
+static void array_destroy_test(void);
+static void* persistent_test_thread(void* thread_arg);
+/** Model Functions, a plain array holding what a list under test is expected to hold **/
+static void model_insert(int* model_array, size_t* model_count, size_t index, int data);
+static void model_delete(int* model_array, size_t* model_count, size_t index);
+static void model_splice(int* model_array, size_t* model_count, size_t index, int* source_array, size_t* source_count,
+                         size_t source_index, size_t node_count);
+static test_result_t list_model_check(linkedlist_t* list, const int* model_array, size_t model_count);
+static test_result_t unrolled_model_check(unrolled_list_t* list, const int* model_array, size_t model_count);
+static test_result_t skiplist_model_check(skiplist_t* list, const int* model_array, size_t model_count);
+static test_result_t intrusive_model_check(intrusive_list_t* list, const int* model_array, size_t model_count);
+static test_result_t dlist_model_check(dlinkedlist_t* list, const int* model_array, size_t model_count);
+static test_result_t generic_model_check(test_pointlist_t* list, const int* model_array, size_t model_count);
+static test_point_t generic_test_point(int point_id);
+static test_result_t generic_test_point_check(const test_point_t* point, int point_id);
+static test_result_t lockfree_model_check(lockfree_list_t* list, const int* model_array, size_t model_count);
+static test_result_t hoh_model_check(hoh_list_t* list, const int* model_array, size_t model_count);
+static int model_compare(const void* value_a, const void* value_b);
 /*********************************************************************************************************************
                                   << Public Function Definitions >>
 *********************************************************************************************************************/
@@ -60,6 +188,34 @@ void test_run(void)
   deleteElement_atIndex_test();
   insertElement_atIndex_test();
   getElement_atIndex_test();
+  iterator_test();
+  generic_list_test();
+  dlinkedlist_backing_test();
+  dlinkedlist_test();
+  buffer_backing_test();
+  snapshot_test();
+  lock_test();
+  pool_test();
+  unrolled_list_test();
+  skiplist_test();
+  cursor_test();
+  insert_range_test();
+  delete_range_test();
+  intrusive_list_test();
+  lockfree_list_test();
+  hoh_list_test();
+  sort_test();
+  merge_test();
+  compact_test();
+  traversal_test();
+  head_insert_index_test();
+  stats_test();
+  parallel_test();
+  search_test();
+  persistent_list_test();
+  splice_test();
+  array_export_test();
+  array_destroy_test();
 
    fclose(fptr);
 
@@ -308,3 +464,3428 @@ static void getElement_atIndex_test(void)
         fprintf(fptr, "\ngetElement_atIndex() test failed.");
     }
 }
+
+static void iterator_test(void)
+{
+    test_result_t test1_result = TEST_FAILED;
+    test_result_t test2_result = TEST_FAILED;
+    custarr_iter_t my_iter;
+    size_t visited_count = 0;
+    int data = 0;
+    int sum = 0;
+
+    freeArray(&my_array);
+    insertElement_atEnd(&my_array, 100);
+    insertElement_atEnd(&my_array, 200);
+    insertElement_atEnd(&my_array, 300);
+
+    /** Test1: walk through the whole array, every element is visited once **/
+    for(array_iterInit(&my_array, &my_iter); CUSTARR_OP_SUCCESS == array_iterGet(&my_iter, &data);
+        array_iterNext(&my_iter))
+    {
+        visited_count = visited_count + 1;
+        sum = sum + data;
+    }
+    getElement_atIndex(&my_array, 0, &data);
+    if((array_sizeGet(&my_array) == visited_count) && ((data + 600) == sum))
+    {
+        test1_result = TEST_PASSED;
+    }
+
+
+    /** Test2: erase 200 and insert 250 after 300 while walking through the array **/
+    for(array_iterInit(&my_array, &my_iter); CUSTARR_OP_SUCCESS == array_iterGet(&my_iter, &data);)
+    {
+        if(200 == data)
+        {
+            array_iterErase(&my_iter);
+        }
+        else
+        {
+            if(300 == data)
+            {
+                array_iterInsertAfter(&my_iter, 250);
+            }
+            array_iterNext(&my_iter);
+        }
+    }
+    getElement_atEnd(&my_array, &data);
+    if((visited_count == array_sizeGet(&my_array)) && (250 == data))
+    {
+        test2_result = TEST_PASSED;
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\niterator_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\niterator_test() test failed.");
+    }
+}
+
+static void generic_list_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    test_pointlist_t my_list;
+    test_point_t point = generic_test_point(-1);
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t index = 0;
+    size_t loop_cntr = 0;
+    int insert_kind = 0;
+
+    /** Test1: points inserted at the head, in the middle and at the tail and deleted at the end and at random indexes
+        keep the generated list equal to the model, every field copied **/
+    (void)test_pointlist_init(&my_list);
+    srand(MODEL_TEST_SEED);
+    for(loop_cntr = 0; (loop_cntr < MODEL_TEST_OPERATIONS) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        if((0u == model_count) || ((MODEL_TEST_ELEMENTS != model_count) && (0 != (rand() % 3))))
+        {
+            /** At the head, at the tail, in the middle through insert_index, or at the tail through insert_end **/
+            insert_kind = rand() % 4;
+            index = (0 == insert_kind) ? 0u : (2 == insert_kind) ? ((size_t)rand() % (model_count + 1u)) : model_count;
+            if(LINKEDLIST_OP_SUCCESS != ((3 == insert_kind) ?
+                                         test_pointlist_insert_end(&my_list, generic_test_point((int)loop_cntr)) :
+                                         test_pointlist_insert_index(&my_list, index,
+                                                                     generic_test_point((int)loop_cntr))))
+            {
+                test1_result = TEST_FAILED;
+            }
+            model_insert(model_array, &model_count, index, (int)loop_cntr);
+        }
+        else
+        {
+            index = (0 == (rand() % 2)) ? (model_count - 1u) : ((size_t)rand() % model_count);
+            if(LINKEDLIST_OP_SUCCESS != (((model_count - 1u) == index) ? test_pointlist_delete_end(&my_list) :
+                                                                         test_pointlist_delete_index(&my_list, index)))
+            {
+                test1_result = TEST_FAILED;
+            }
+            model_delete(model_array, &model_count, index);
+        }
+
+        if((TEST_FAILED == generic_model_check(&my_list, model_array, model_count)) ||
+           ((0u != model_count) &&
+            ((LINKEDLIST_OP_SUCCESS != test_pointlist_get_end(&my_list, &point)) ||
+             (TEST_PASSED != generic_test_point_check(&point, model_array[model_count - 1u])) ||
+             (LINKEDLIST_OP_SUCCESS != test_pointlist_get_index(&my_list, index % model_count, &point)) ||
+             (TEST_PASSED != generic_test_point_check(&point, model_array[index % model_count])))))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+    if((LINKEDLIST_OP_SUCCESS != test_pointlist_delete_all(&my_list)) ||
+       (TEST_PASSED != generic_model_check(&my_list, model_array, 0)))
+    {
+        test1_result = TEST_FAILED;
+    }
+
+
+    /** Test2: the empty list, out of range indexes, which fail without changing the list or the read point, and a
+        single point **/
+    point = generic_test_point(-1);
+    if((LINKEDLIST_OP_FAIL == test_pointlist_get_end(&my_list, &point)) &&
+       (LINKEDLIST_OP_FAIL == test_pointlist_get_index(&my_list, 0, &point)) &&
+       (LINKEDLIST_OP_FAIL == test_pointlist_delete_end(&my_list)) &&
+       (LINKEDLIST_OP_FAIL == test_pointlist_delete_index(&my_list, 0)) &&
+       (LINKEDLIST_OP_FAIL == test_pointlist_delete_all(&my_list)) &&
+       (LINKEDLIST_OP_FAIL == test_pointlist_insert_index(&my_list, 1, generic_test_point(7))) &&
+       (0u == test_pointlist_size(&my_list)) &&
+       (LINKEDLIST_OP_SUCCESS == test_pointlist_insert_index(&my_list, 0, generic_test_point(7))) &&
+       (LINKEDLIST_OP_FAIL == test_pointlist_insert_index(&my_list, 2, generic_test_point(8))) &&
+       (LINKEDLIST_OP_FAIL == test_pointlist_insert_index(&my_list, SIZE_MAX, generic_test_point(8))) &&
+       (LINKEDLIST_OP_FAIL == test_pointlist_get_index(&my_list, 1, &point)) &&
+       (LINKEDLIST_OP_FAIL == test_pointlist_delete_index(&my_list, 1)) &&
+       (TEST_PASSED == generic_test_point_check(&point, -1)) &&
+       (LINKEDLIST_OP_SUCCESS == test_pointlist_get_index(&my_list, 0, &point)) &&
+       (TEST_PASSED == generic_test_point_check(&point, 7)) &&
+       (1u == test_pointlist_size(&my_list)) &&
+       (LINKEDLIST_OP_SUCCESS == test_pointlist_delete_end(&my_list)) &&
+       (TEST_PASSED == generic_model_check(&my_list, model_array, 0)))
+    {
+        test2_result = TEST_PASSED;
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\ngeneric_list_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\ngeneric_list_test() test failed.");
+    }
+}
+
+static void dlinkedlist_backing_test(void)
+{
+    test_result_t test1_result = TEST_FAILED;
+    test_result_t test2_result = TEST_FAILED;
+    custarr_iter_t my_iter;
+    int data = 0;
+    int sum = 0;
+
+    /** Test1: a second array can be initialized, and it behaves like the singly linked one **/
+    if(CUSTARR_OP_SUCCESS == initArray_backing(&my_dlist_array, ARRAY_CAPACITY, CUSTARR_BACKING_DLINKEDLIST))
+    {
+        insertElement_atEnd(&my_dlist_array, 100);
+        insertElement_atEnd(&my_dlist_array, 300);
+        insertElement_atIndex(&my_dlist_array, 2, 200);
+        deleteElement_atEnd(&my_dlist_array);
+        getElement_atEnd(&my_dlist_array, &data);
+        if((3 == array_sizeGet(&my_dlist_array)) && (200 == data) &&
+           (CUSTARR_OP_FAIL == initArray(&my_dlist_array, ARRAY_CAPACITY)))
+        {
+            test1_result = TEST_PASSED;
+        }
+    }
+
+    /** Test2: erase 100 while walking through the array, then free it **/
+    for(array_iterInit(&my_dlist_array, &my_iter); CUSTARR_OP_SUCCESS == array_iterGet(&my_iter, &data);)
+    {
+        if(100 == data)
+        {
+            array_iterErase(&my_iter);
+        }
+        else
+        {
+            sum = sum + data;
+            array_iterNext(&my_iter);
+        }
+    }
+    if((200 == sum) && (2 == array_sizeGet(&my_dlist_array)) && (CUSTARR_OP_SUCCESS == freeArray(&my_dlist_array)) &&
+       (1 == array_sizeGet(&my_dlist_array)) && (CUSTARR_OP_FAIL == freeArray(&my_dlist_array)))
+    {
+        test2_result = TEST_PASSED;
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\ndlinkedlist_backing_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\ndlinkedlist_backing_test() test failed.");
+    }
+}
+
+static void dlinkedlist_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_PASSED;
+    test_result_t test3_result = TEST_FAILED;
+    static dlinkedlist_t my_lists[2];
+    static int model_arrays[2][2 * DLIST_TEST_NODES];
+    size_t model_counts[2] = {0, 0};
+    int run_array[2 * DLIST_TEST_NODES];
+    size_t run_count = 0;
+    dlinkedlist_t my_list;
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    struct dnode_t* node_position = NULL;
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    size_t list_index = 0;
+    size_t source_index = 0;
+    size_t node_count = 0;
+    size_t index = 0;
+    size_t loop_cntr = 0;
+    int data = 0;
+
+    /** Test1: pushes and pops at both ends, inserts and deletes at indexes and through node handles keep the list
+        equal to the model. Deleting from the empty list fails. **/
+    (void)dlinkedlist_init(&my_list);
+    srand(MODEL_TEST_SEED);
+    for(loop_cntr = 0; (loop_cntr < MODEL_TEST_OPERATIONS) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        data = (int)loop_cntr;
+        index = (size_t)rand() % (model_count + 1u);
+        if((MODEL_TEST_ELEMENTS != model_count) && (0 != (rand() % 3)))
+        {
+            switch(rand() % 4)
+            {
+                case 0:
+                    index = 0;
+                    ret_val = dlinkedlist_insert_front(&my_list, data);
+                    break;
+                case 1:
+                    index = model_count;
+                    ret_val = dlinkedlist_insert_end(&my_list, data);
+                    break;
+                case 2:
+                    ret_val = dlinkedlist_insert_index(&my_list, index, data);
+                    break;
+                default:
+                    /** Inserted after the node before index, or at the front through the first node **/
+                    ret_val = (0u == index) ? dlinkedlist_insert_front(&my_list, data) :
+                              dlinkedlist_insert_after(&my_list, dlinkedlist_node_index(&my_list, index - 1u), data);
+                    break;
+            }
+            model_insert(model_array, &model_count, index, data);
+        }
+        else
+        {
+            index = (0u == model_count) ? 0u : (index % model_count);
+            switch(rand() % 4)
+            {
+                case 0:
+                    index = 0;
+                    ret_val = dlinkedlist_delete_front(&my_list);
+                    break;
+                case 1:
+                    index = (0u == model_count) ? 0u : (model_count - 1u);
+                    ret_val = dlinkedlist_delete_end(&my_list);
+                    break;
+                case 2:
+                    ret_val = dlinkedlist_delete_index(&my_list, index);
+                    break;
+                default:
+                    ret_val = dlinkedlist_delete_node(&my_list, dlinkedlist_node_index(&my_list, index));
+                    break;
+            }
+            if(0u != model_count)
+            {
+                model_delete(model_array, &model_count, index);
+            }
+            else if(LINKEDLIST_OP_FAIL == ret_val)
+            {
+                ret_val = LINKEDLIST_OP_SUCCESS;
+            }
+            else
+            {
+                ret_val = LINKEDLIST_OP_FAIL;
+            }
+        }
+
+        if((LINKEDLIST_OP_SUCCESS != ret_val) || (TEST_FAILED == dlist_model_check(&my_list, model_array, model_count)))
+        {
+            test1_result = TEST_FAILED;
+        }
+        if((0u != model_count) &&
+           ((LINKEDLIST_OP_SUCCESS != dlinkedlist_get_front(&my_list, &data)) || (model_array[0] != data) ||
+            (LINKEDLIST_OP_SUCCESS != dlinkedlist_get_end(&my_list, &data)) ||
+            (model_array[model_count - 1u] != data) ||
+            (LINKEDLIST_OP_SUCCESS != dlinkedlist_get_index(&my_list, index % model_count, &data)) ||
+            (model_array[index % model_count] != data)))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+    (void)dlinkedlist_delete_all(&my_list);
+
+
+    /** Test2: runs spliced from one list to the other, and within one list to a position outside the run, keep both
+        lists equal to their models. Positions include the sentinel node, which links the run at the end. **/
+    for(list_index = 0; list_index < 2u; list_index++)
+    {
+        (void)dlinkedlist_init(&my_lists[list_index]);
+        for(loop_cntr = 0; loop_cntr < DLIST_TEST_NODES; loop_cntr++)
+        {
+            data = (int)((list_index * 1000u) + loop_cntr);
+            (void)dlinkedlist_insert_end(&my_lists[list_index], data);
+            model_insert(model_arrays[list_index], &model_counts[list_index], loop_cntr, data);
+        }
+    }
+    for(loop_cntr = 0; (loop_cntr < DLIST_TEST_SPLICES) && (TEST_PASSED == test2_result); loop_cntr++)
+    {
+        list_index = (size_t)rand() % 2u;
+        if(0u == model_counts[list_index])
+        {
+            list_index = 1u - list_index;
+        }
+        source_index = (size_t)rand() % model_counts[list_index];
+        node_count = 1u + ((size_t)rand() % (model_counts[list_index] - source_index));
+        if(0 == (rand() % 2))
+        {
+            /** Across lists, from list_index to the other list **/
+            index = (size_t)rand() % (model_counts[1u - list_index] + 1u);
+            node_position = (model_counts[1u - list_index] == index) ? &my_lists[1u - list_index].sentinel_node :
+                            dlinkedlist_node_index(&my_lists[1u - list_index], index);
+            ret_val = dlinkedlist_splice(&my_lists[1u - list_index], node_position, &my_lists[list_index],
+                                         dlinkedlist_node_index(&my_lists[list_index], source_index),
+                                         dlinkedlist_node_index(&my_lists[list_index], source_index + node_count - 1u),
+                                         node_count);
+            model_splice(model_arrays[1u - list_index], &model_counts[1u - list_index], index,
+                         model_arrays[list_index], &model_counts[list_index], source_index, node_count);
+        }
+        else
+        {
+            /** Within list_index, before a node outside the run or the sentinel node **/
+            index = (size_t)rand() % ((model_counts[list_index] - node_count) + 1u);
+            index = (index < source_index) ? index : (index + node_count);
+            node_position = (model_counts[list_index] == index) ? &my_lists[list_index].sentinel_node :
+                            dlinkedlist_node_index(&my_lists[list_index], index);
+            ret_val = dlinkedlist_splice(&my_lists[list_index], node_position, &my_lists[list_index],
+                                         dlinkedlist_node_index(&my_lists[list_index], source_index),
+                                         dlinkedlist_node_index(&my_lists[list_index], source_index + node_count - 1u),
+                                         node_count);
+            run_count = 0;
+            model_splice(run_array, &run_count, 0, model_arrays[list_index], &model_counts[list_index], source_index,
+                         node_count);
+            index = (index < source_index) ? index : (index - node_count);
+            model_splice(model_arrays[list_index], &model_counts[list_index], index, run_array, &run_count, 0,
+                         node_count);
+        }
+
+        if((LINKEDLIST_OP_SUCCESS != ret_val) ||
+           (TEST_FAILED == dlist_model_check(&my_lists[0], model_arrays[0], model_counts[0])) ||
+           (TEST_FAILED == dlist_model_check(&my_lists[1], model_arrays[1], model_counts[1])))
+        {
+            test2_result = TEST_FAILED;
+        }
+    }
+
+
+    /** Test3: splices without a position or a run, or longer than the source list, fail without changing the lists.
+        A whole list spliced at the sentinel node of an empty list leaves the source list empty. The sentinel node
+        can't be deleted. **/
+    run_count = 0;
+    list_index = (model_counts[0] < model_counts[1]) ? 1u : 0u;
+    (void)dlinkedlist_init(&my_list);
+    if((LINKEDLIST_OP_FAIL == dlinkedlist_splice(&my_lists[0], NULL, &my_lists[1], dlinkedlist_node_front(&my_lists[1]),
+                                                 dlinkedlist_node_front(&my_lists[1]), 1u)) &&
+       (LINKEDLIST_OP_FAIL == dlinkedlist_splice(&my_lists[0], &my_lists[0].sentinel_node, &my_lists[1], NULL, NULL,
+                                                 1u)) &&
+       (LINKEDLIST_OP_FAIL == dlinkedlist_splice(&my_lists[0], &my_lists[0].sentinel_node, &my_list,
+                                                 dlinkedlist_node_front(&my_lists[1]),
+                                                 dlinkedlist_node_front(&my_lists[1]), 1u)) &&
+       (LINKEDLIST_OP_FAIL == dlinkedlist_splice(&my_lists[0], &my_lists[0].sentinel_node, &my_lists[list_index],
+                                                 dlinkedlist_node_front(&my_lists[list_index]),
+                                                 dlinkedlist_node_front(&my_lists[list_index]), 0u)) &&
+       (TEST_PASSED == dlist_model_check(&my_lists[0], model_arrays[0], model_counts[0])) &&
+       (TEST_PASSED == dlist_model_check(&my_lists[1], model_arrays[1], model_counts[1])) &&
+       (LINKEDLIST_OP_SUCCESS == dlinkedlist_splice(&my_list, &my_list.sentinel_node, &my_lists[list_index],
+                                                    dlinkedlist_node_front(&my_lists[list_index]),
+                                                    dlinkedlist_node_end(&my_lists[list_index]),
+                                                    model_counts[list_index])) &&
+       (TEST_PASSED == dlist_model_check(&my_list, model_arrays[list_index], model_counts[list_index])) &&
+       (TEST_PASSED == dlist_model_check(&my_lists[list_index], run_array, 0)) &&
+       (NULL == dlinkedlist_node_front(&my_lists[list_index])) &&
+       (LINKEDLIST_OP_FAIL == dlinkedlist_get_front(&my_lists[list_index], &data)) &&
+       (LINKEDLIST_OP_FAIL == dlinkedlist_delete_node(&my_list, &my_list.sentinel_node)) &&
+       (LINKEDLIST_OP_FAIL == dlinkedlist_delete_node(&my_list, NULL)) &&
+       (LINKEDLIST_OP_FAIL == dlinkedlist_insert_after(&my_list, NULL, 0)) &&
+       (LINKEDLIST_OP_FAIL == dlinkedlist_insert_index(&my_list, model_counts[list_index] + 1u, 0)) &&
+       (LINKEDLIST_OP_FAIL == dlinkedlist_get_index(&my_list, model_counts[list_index], &data)) &&
+       (TEST_PASSED == dlist_model_check(&my_list, model_arrays[list_index], model_counts[list_index])))
+    {
+        test3_result = TEST_PASSED;
+    }
+    (void)dlinkedlist_delete_all(&my_list);
+    (void)dlinkedlist_delete_all(&my_lists[0]);
+    (void)dlinkedlist_delete_all(&my_lists[1]);
+    if(LINKEDLIST_OP_FAIL != dlinkedlist_delete_all(&my_list))
+    {
+        test3_result = TEST_FAILED;
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result) && (TEST_PASSED == test3_result))
+    {
+        fprintf(fptr, "\ndlinkedlist_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\ndlinkedlist_test() test failed.");
+    }
+}
+
+static void buffer_backing_test(void)
+{
+    test_result_t test1_result = TEST_FAILED;
+    test_result_t test2_result = TEST_FAILED;
+    custarr_iter_t my_iter;
+    size_t loop_cntr = 0;
+    int data = 0;
+    int sum = 0;
+
+    /** Test1: fill the array past the first buffer allocation, every element stays at its index **/
+    if(CUSTARR_OP_SUCCESS == initArray_backing(&my_buffer_array, 5 * CUSTARR_BUFFER_MIN_SLOTS, CUSTARR_BACKING_BUFFER))
+    {
+        for(loop_cntr = 1; loop_cntr < (5 * CUSTARR_BUFFER_MIN_SLOTS); loop_cntr++)
+        {
+            insertElement_atEnd(&my_buffer_array, (int)loop_cntr);
+        }
+        deleteElement_atIndex(&my_buffer_array, 10);
+        insertElement_atIndex(&my_buffer_array, 10, 10);
+        getElement_atIndex(&my_buffer_array, 30, &data);
+        sum = data;
+        getElement_atEnd(&my_buffer_array, &data);
+        if((30 == sum) && (((5 * CUSTARR_BUFFER_MIN_SLOTS) - 1) == (size_t)data) &&
+           (CUSTARR_OP_FULL == insertElement_atEnd(&my_buffer_array, 0)) &&
+           (CUSTARR_OP_FAIL == deleteElement_atIndex(&my_buffer_array, 0)) &&
+           (CUSTARR_OP_FAIL == initArray(&my_buffer_array, ARRAY_CAPACITY)))
+        {
+            test1_result = TEST_PASSED;
+        }
+    }
+
+    /** Test2: erase the odd elements and insert 1000 after 40 while walking through the array, then free it **/
+    for(array_iterInit(&my_buffer_array, &my_iter); CUSTARR_OP_SUCCESS == array_iterGet(&my_iter, &data);)
+    {
+        if(1 == (data % 2))
+        {
+            array_iterErase(&my_iter);
+        }
+        else
+        {
+            if(40 == data)
+            {
+                array_iterInsertAfter(&my_iter, 1000);
+            }
+            array_iterNext(&my_iter);
+        }
+    }
+    getElement_atIndex(&my_buffer_array, 21, &data);
+    if((((5 * CUSTARR_BUFFER_MIN_SLOTS) / 2) + 1 == array_sizeGet(&my_buffer_array)) && (1000 == data) &&
+       (CUSTARR_OP_SUCCESS == freeArray(&my_buffer_array)) && (1 == array_sizeGet(&my_buffer_array)) &&
+       (CUSTARR_OP_FAIL == freeArray(&my_buffer_array)))
+    {
+        test2_result = TEST_PASSED;
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nbuffer_backing_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nbuffer_backing_test() test failed.");
+    }
+}
+
+static void snapshot_test(void)
+{
+    test_result_t test1_result = TEST_FAILED;
+    test_result_t test2_result = TEST_FAILED;
+    FILE *snapshot_fptr = NULL;
+    int data = 0;
+    int first_data = 0;
+
+    /** Test1: save an array, change it, then load it back from the snapshot **/
+    freeArray(&my_array);
+    insertElement_atEnd(&my_array, 100);
+    insertElement_atEnd(&my_array, 200);
+    insertElement_atEnd(&my_array, 300);
+    getElement_atIndex(&my_array, 0, &first_data);
+    if(CUSTARR_OP_SUCCESS == array_snapshotSave(&my_array, "test_snapshot.bin"))
+    {
+        deleteElement_atEnd(&my_array);
+        insertElement_atEnd(&my_array, 400);
+        insertElement_atEnd(&my_array, 500);
+        if(CUSTARR_OP_SUCCESS == array_snapshotLoad(&my_array, "test_snapshot.bin"))
+        {
+            getElement_atIndex(&my_array, 0, &data);
+            if((4 == array_sizeGet(&my_array)) && (first_data == data) &&
+               (CUSTARR_OP_SUCCESS == getElement_atEnd(&my_array, &data)) && (300 == data))
+            {
+                test1_result = TEST_PASSED;
+            }
+        }
+    }
+
+
+    /** Test2: a corrupt snapshot is rejected and the array stays as it was **/
+    snapshot_fptr = fopen("test_snapshot.bin", "r+b");
+    if(NULL != snapshot_fptr)
+    {
+        fseek(snapshot_fptr, -1L, SEEK_END);
+        fputc(0x55, snapshot_fptr);
+        fclose(snapshot_fptr);
+        deleteElement_atEnd(&my_array);
+        if((CUSTARR_OP_FAIL == array_snapshotLoad(&my_array, "test_snapshot.bin")) && (3 == array_sizeGet(&my_array)))
+        {
+            test2_result = TEST_PASSED;
+        }
+    }
+    remove("test_snapshot.bin");
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nsnapshot_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nsnapshot_test() test failed.");
+    }
+}
+
+static void lock_test(void)
+{
+    test_result_t test1_result = TEST_FAILED;
+    test_result_t test2_result = TEST_FAILED;
+    pthread_t thread_id[LOCK_TEST_THREADS];
+    size_t thread_index = 0;
+    int data = 0;
+
+    /** Test1: an array no thread is using is unlocked **/
+    if((CUSTARR_OP_SUCCESS == initArray(&my_shared_array, 1 + (LOCK_TEST_THREADS * LOCK_TEST_INSERTS))) &&
+       (ARRAY_UNLOCKED == array_lockstatus(&my_shared_array)))
+    {
+        test1_result = TEST_PASSED;
+    }
+
+
+    /** Test2: threads inserting and reading at the same time don't lose any element **/
+    for(thread_index = 0; thread_index < LOCK_TEST_THREADS; thread_index++)
+    {
+        pthread_create(&thread_id[thread_index], NULL, lock_test_thread, NULL);
+    }
+    for(thread_index = 0; thread_index < LOCK_TEST_THREADS; thread_index++)
+    {
+        pthread_join(thread_id[thread_index], NULL);
+    }
+    getElement_atEnd(&my_shared_array, &data);
+    if(((1 + (LOCK_TEST_THREADS * LOCK_TEST_INSERTS)) == array_sizeGet(&my_shared_array)) &&
+       (LOCK_TEST_INSERTS == data) && (CUSTARR_OP_FULL == insertElement_atEnd(&my_shared_array, 0)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    freeArray(&my_shared_array);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nlock_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nlock_test() test failed.");
+    }
+}
+
+/** Inserts 1 ... LOCK_TEST_INSERTS at the end of the shared array, reading the last element after every insert **/
+static void* lock_test_thread(void* thread_arg)
+{
+    int loop_cntr = 0;
+    int data = 0;
+
+    (void)thread_arg;
+    for(loop_cntr = 1; loop_cntr <= LOCK_TEST_INSERTS; loop_cntr++)
+    {
+        insertElement_atEnd(&my_shared_array, loop_cntr);
+        getElement_atEnd(&my_shared_array, &data);
+    }
+
+    return NULL;
+}
+
+static void pool_test(void)
+{
+    test_result_t test1_result = TEST_FAILED;
+    test_result_t test2_result = TEST_FAILED;
+    linkedlist_pool_t my_pool;
+    linkedlist_pool_stats_t my_pool_stats;
+    linkedlist_t my_list;
+    int model_array[POOL_TEST_NODES];
+    size_t model_count = 0;
+    size_t loop_cntr = 0;
+
+    linkedlist_pool_init(&my_pool, POOL_TEST_SLAB_NODES);
+    linkedlist_handle_init(&my_list);
+    linkedlist_handle_pool_set(&my_list, &my_pool);
+
+    /** Test1: nodes deleted from a pool based list are recycled by the next inserts, no new slab is allocated **/
+    for(loop_cntr = 0; loop_cntr < POOL_TEST_NODES; loop_cntr++)
+    {
+        linkedlist_handle_insert_end(&my_list, (int)loop_cntr);
+        model_insert(model_array, &model_count, loop_cntr, (int)loop_cntr);
+    }
+    linkedlist_handle_delete_index(&my_list, 0);
+    model_delete(model_array, &model_count, 0);
+    linkedlist_handle_delete_index(&my_list, 4);
+    model_delete(model_array, &model_count, 4);
+    linkedlist_handle_delete_end(&my_list);
+    model_delete(model_array, &model_count, model_count - 1);
+    linkedlist_pool_stats_get(&my_pool, &my_pool_stats);
+    if((3u == my_pool_stats.slab_count) && (3u == my_pool_stats.free_node_count) &&
+       ((POOL_TEST_NODES - 3) == my_pool_stats.used_node_count))
+    {
+        linkedlist_handle_insert_index(&my_list, 0, 100);
+        model_insert(model_array, &model_count, 0, 100);
+        linkedlist_handle_insert_index(&my_list, 3, 200);
+        model_insert(model_array, &model_count, 3, 200);
+        linkedlist_handle_insert_end(&my_list, 300);
+        model_insert(model_array, &model_count, model_count, 300);
+        linkedlist_pool_stats_get(&my_pool, &my_pool_stats);
+        if((3u == my_pool_stats.slab_count) && (0u == my_pool_stats.free_node_count) &&
+           (POOL_TEST_NODES == my_pool_stats.used_node_count) &&
+           (LINKEDLIST_OP_FAIL == linkedlist_handle_pool_set(&my_list, NULL)))
+        {
+            test1_result = list_model_check(&my_list, model_array, model_count);
+        }
+    }
+
+
+    /** Test2: a run the pool can't allocate fails without changing the list or the pool, freed nodes go back to the
+        pool, and a reset pool hands out its slabs again **/
+    if((NULL == linkedlist_pool_alloc_run(&my_pool, 0)) &&
+       (NULL == linkedlist_pool_alloc_run(&my_pool, SIZE_MAX / 2u)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_insert_range(&my_list, 1, model_array, SIZE_MAX / 64u)) &&
+       (TEST_PASSED == list_model_check(&my_list, model_array, model_count)))
+    {
+        linkedlist_handle_delete_all(&my_list);
+        linkedlist_pool_stats_get(&my_pool, &my_pool_stats);
+        if((3u == my_pool_stats.slab_count) && (0u == my_pool_stats.used_node_count) &&
+           (POOL_TEST_NODES == my_pool_stats.free_node_count) && (0u == linkedlist_handle_size(&my_list)))
+        {
+            linkedlist_pool_reset(&my_pool);
+            linkedlist_pool_stats_get(&my_pool, &my_pool_stats);
+            if((my_pool_stats.node_capacity == my_pool_stats.untouched_node_count) &&
+               (&my_pool.first_slab_ptr->nodes[0] == linkedlist_pool_alloc(&my_pool)))
+            {
+                test2_result = TEST_PASSED;
+            }
+        }
+    }
+    linkedlist_pool_destroy(&my_pool);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\npool_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\npool_test() test failed.");
+    }
+}
+
+static void unrolled_list_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    unrolled_list_t my_list;
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t index = 0;
+    size_t loop_cntr = 0;
+    int data = 0;
+
+    unrolled_list_init(&my_list);
+
+    /** Test1: random inserts and deletes at random indexes keep the list equal to the model, with no empty node **/
+    srand(MODEL_TEST_SEED);
+    for(loop_cntr = 0; (loop_cntr < MODEL_TEST_OPERATIONS) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        if((0u == model_count) || ((model_count < MODEL_TEST_ELEMENTS) && (0 != (rand() % 3))))
+        {
+            index = (size_t)rand() % (model_count + 1u);
+            if(LINKEDLIST_OP_SUCCESS != unrolled_list_insert_index(&my_list, index, (int)loop_cntr))
+            {
+                test1_result = TEST_FAILED;
+            }
+            model_insert(model_array, &model_count, index, (int)loop_cntr);
+        }
+        else
+        {
+            index = (size_t)rand() % model_count;
+            if(LINKEDLIST_OP_SUCCESS != unrolled_list_delete_index(&my_list, index))
+            {
+                test1_result = TEST_FAILED;
+            }
+            model_delete(model_array, &model_count, index);
+        }
+
+        if((TEST_FAILED == unrolled_model_check(&my_list, model_array, model_count)) ||
+           ((0u != model_count) &&
+            ((LINKEDLIST_OP_SUCCESS != unrolled_list_get_index(&my_list, index % model_count, &data)) ||
+             (model_array[index % model_count] != data))))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+    unrolled_list_delete_all(&my_list);
+
+
+    /** Test2: empty list, single element and out of range indexes **/
+    if((LINKEDLIST_OP_FAIL == unrolled_list_get_end(&my_list, &data)) &&
+       (LINKEDLIST_OP_FAIL == unrolled_list_get_index(&my_list, 0, &data)) &&
+       (LINKEDLIST_OP_FAIL == unrolled_list_delete_end(&my_list)) &&
+       (LINKEDLIST_OP_FAIL == unrolled_list_delete_index(&my_list, 0)) &&
+       (LINKEDLIST_OP_FAIL == unrolled_list_delete_all(&my_list)) &&
+       (LINKEDLIST_OP_FAIL == unrolled_list_insert_index(&my_list, 1, 7)) &&
+       (LINKEDLIST_OP_SUCCESS == unrolled_list_insert_index(&my_list, 0, 7)) &&
+       (LINKEDLIST_OP_FAIL == unrolled_list_get_index(&my_list, 1, &data)) &&
+       (LINKEDLIST_OP_SUCCESS == unrolled_list_get_end(&my_list, &data)) && (7 == data) &&
+       (LINKEDLIST_OP_SUCCESS == unrolled_list_delete_end(&my_list)) &&
+       (NULL == my_list.head_node_ptr) && (NULL == my_list.tail_node_ptr) && (0u == my_list.node_count) &&
+       (0u == unrolled_list_size(&my_list)))
+    {
+        test2_result = TEST_PASSED;
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nunrolled_list_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nunrolled_list_test() test failed.");
+    }
+}
+
+static void skiplist_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    skiplist_t my_list;
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t index = 0;
+    size_t loop_cntr = 0;
+    int data = 0;
+
+    skiplist_init(&my_list);
+
+    /** Test1: random inserts and deletes at random indexes keep the list equal to the model, and every span equal to
+        the distance between the nodes it links **/
+    srand(MODEL_TEST_SEED);
+    for(loop_cntr = 0; (loop_cntr < MODEL_TEST_OPERATIONS) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        if((0u == model_count) || ((model_count < MODEL_TEST_ELEMENTS) && (0 != (rand() % 3))))
+        {
+            index = (size_t)rand() % (model_count + 1u);
+            if(LINKEDLIST_OP_SUCCESS != skiplist_insert_index(&my_list, index, (int)loop_cntr))
+            {
+                test1_result = TEST_FAILED;
+            }
+            model_insert(model_array, &model_count, index, (int)loop_cntr);
+        }
+        else
+        {
+            index = (size_t)rand() % model_count;
+            if(LINKEDLIST_OP_SUCCESS != skiplist_delete_index(&my_list, index))
+            {
+                test1_result = TEST_FAILED;
+            }
+            model_delete(model_array, &model_count, index);
+        }
+
+        if((TEST_FAILED == skiplist_model_check(&my_list, model_array, model_count)) ||
+           ((0u != model_count) &&
+            ((LINKEDLIST_OP_SUCCESS != skiplist_get_index(&my_list, index % model_count, &data)) ||
+             (model_array[index % model_count] != data))))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+
+    /** Every index is read through the spans, not only the ones just changed **/
+    for(index = 0; (index < model_count) && (TEST_PASSED == test1_result); index++)
+    {
+        if((LINKEDLIST_OP_SUCCESS != skiplist_get_index(&my_list, index, &data)) || (model_array[index] != data))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+    skiplist_delete_all(&my_list);
+
+
+    /** Test2: empty list, single element and out of range indexes **/
+    if((LINKEDLIST_OP_FAIL == skiplist_get_end(&my_list, &data)) &&
+       (LINKEDLIST_OP_FAIL == skiplist_get_index(&my_list, 0, &data)) &&
+       (LINKEDLIST_OP_FAIL == skiplist_delete_end(&my_list)) &&
+       (LINKEDLIST_OP_FAIL == skiplist_delete_index(&my_list, 0)) &&
+       (LINKEDLIST_OP_FAIL == skiplist_delete_all(&my_list)) &&
+       (LINKEDLIST_OP_FAIL == skiplist_insert_index(&my_list, 1, 7)) &&
+       (LINKEDLIST_OP_SUCCESS == skiplist_insert_end(&my_list, 7)) &&
+       (LINKEDLIST_OP_FAIL == skiplist_get_index(&my_list, 1, &data)) &&
+       (LINKEDLIST_OP_SUCCESS == skiplist_get_end(&my_list, &data)) && (7 == data) &&
+       (LINKEDLIST_OP_SUCCESS == skiplist_delete_end(&my_list)) &&
+       (TEST_PASSED == skiplist_model_check(&my_list, model_array, 0)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    skiplist_destroy(&my_list);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nskiplist_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nskiplist_test() test failed.");
+    }
+}
+
+static void cursor_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    linkedlist_t my_list;
+    linkedlist_cursor_t my_cursor;
+    struct node_t my_head_node = {1, NULL};
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t loop_cntr = 0;
+    int data = 0;
+    int data_next = 0;
+
+    linkedlist_handle_init(&my_list);
+    for(model_count = 0; model_count < (MODEL_TEST_ELEMENTS / 10u); model_count++)
+    {
+        linkedlist_handle_insert_end(&my_list, data_next);
+        model_array[model_count] = data_next;
+        data_next = data_next + 1;
+    }
+
+    /** Test1: passes of a cursor erasing, inserting after and stepping over random nodes keep the list equal to the
+        model, and the cursor index and data follow the model all the way **/
+    srand(MODEL_TEST_SEED);
+    for(loop_cntr = 0; (loop_cntr < (MODEL_TEST_OPERATIONS / 100u)) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        linkedlist_cursor_init(&my_cursor, &my_list);
+        while((my_cursor.node_index < model_count) && (TEST_PASSED == test1_result))
+        {
+            if((LINKEDLIST_OP_SUCCESS != linkedlist_cursor_peek(&my_cursor, &data)) ||
+               (model_array[my_cursor.node_index] != data))
+            {
+                test1_result = TEST_FAILED;
+            }
+            else if(0 == (rand() % 4))
+            {
+                model_delete(model_array, &model_count, my_cursor.node_index);
+                if(LINKEDLIST_OP_SUCCESS != linkedlist_cursor_erase(&my_cursor))
+                {
+                    test1_result = TEST_FAILED;
+                }
+            }
+            else if(((model_count + 1u) < MODEL_TEST_ELEMENTS) && (0 == (rand() % 3)))
+            {
+                model_insert(model_array, &model_count, my_cursor.node_index + 1u, data_next);
+                if(LINKEDLIST_OP_SUCCESS != linkedlist_cursor_insert_after(&my_cursor, data_next))
+                {
+                    test1_result = TEST_FAILED;
+                }
+                data_next = data_next + 1;
+            }
+            else
+            {
+                linkedlist_cursor_next(&my_cursor);
+            }
+        }
+
+        /** Past the last node nothing can be read or erased, and inserting appends with the cursor staying past it **/
+        model_insert(model_array, &model_count, model_count, data_next);
+        if((LINKEDLIST_OP_FAIL == linkedlist_cursor_peek(&my_cursor, &data)) &&
+           (LINKEDLIST_OP_FAIL == linkedlist_cursor_next(&my_cursor)) &&
+           (LINKEDLIST_OP_FAIL == linkedlist_cursor_erase(&my_cursor)) &&
+           (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_insert_after(&my_cursor, data_next)) &&
+           (model_count == my_cursor.node_index) && (NULL == my_cursor.node_current_ptr))
+        {
+            test1_result = list_model_check(&my_list, model_array, model_count);
+        }
+        else
+        {
+            test1_result = TEST_FAILED;
+        }
+        data_next = data_next + 1;
+    }
+    linkedlist_handle_delete_all(&my_list);
+
+
+    /** Test2: a cursor on an empty list appends to it and erases its single node, a cursor on a head node based list
+        can't erase the head node **/
+    linkedlist_cursor_init(&my_cursor, &my_list);
+    if((LINKEDLIST_OP_FAIL == linkedlist_cursor_peek(&my_cursor, &data)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_cursor_erase(&my_cursor)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_insert_after(&my_cursor, 7)) && (1u == my_cursor.node_index) &&
+       (my_list.head_node_ptr == my_list.tail_node_ptr) && (1u == linkedlist_handle_size(&my_list)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_init(&my_cursor, &my_list)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_erase(&my_cursor)) &&
+       (TEST_PASSED == list_model_check(&my_list, model_array, 0)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_init_chain(&my_cursor, &my_head_node)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_cursor_erase(&my_cursor)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_insert_after(&my_cursor, 2)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_next(&my_cursor)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_peek(&my_cursor, &data)) && (2 == data) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_erase(&my_cursor)) &&
+       (NULL == my_head_node.next_node_address_ptr) && (1 == my_head_node.data))
+    {
+        test2_result = TEST_PASSED;
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\ncursor_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\ncursor_test() test failed.");
+    }
+}
+
+static void insert_range_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    linkedlist_pool_t my_pool;
+    linkedlist_t my_list;
+    int model_array[MODEL_TEST_ELEMENTS];
+    int range_array[MODEL_TEST_RANGE];
+    size_t model_count = 0;
+    size_t range_count = 0;
+    size_t index = 0;
+    size_t loop_cntr = 0;
+    size_t range_index = 0;
+    int pool_used = 0;
+
+    linkedlist_pool_init(&my_pool, 0);
+
+    /** Test1: ranges of random length inserted at random indexes and appended keep the list equal to the model, for
+        a list using malloc() and for a pool based list **/
+    srand(MODEL_TEST_SEED);
+    for(pool_used = 0; (pool_used < 2) && (TEST_PASSED == test1_result); pool_used++)
+    {
+        linkedlist_handle_init(&my_list);
+        linkedlist_handle_pool_set(&my_list, (0 != pool_used) ? &my_pool : NULL);
+        model_count = 0;
+        for(loop_cntr = 0; (loop_cntr < (MODEL_TEST_ELEMENTS / MODEL_TEST_RANGE)) && (TEST_PASSED == test1_result);
+            loop_cntr++)
+        {
+            range_count = 1u + ((size_t)rand() % MODEL_TEST_RANGE);
+            index = (0u == (loop_cntr % 4u)) ? model_count : ((size_t)rand() % (model_count + 1u));
+            for(range_index = 0; range_index < range_count; range_index++)
+            {
+                range_array[range_index] = rand();
+                model_insert(model_array, &model_count, index + range_index, range_array[range_index]);
+            }
+
+            if((model_count == (linkedlist_handle_size(&my_list) + range_count)) &&
+               (LINKEDLIST_OP_SUCCESS == ((0u == (loop_cntr % 4u)) ?
+                                          linkedlist_append_array(&my_list, range_array, range_count) :
+                                          linkedlist_insert_range(&my_list, index, range_array, range_count))))
+            {
+                test1_result = list_model_check(&my_list, model_array, model_count);
+            }
+            else
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+        linkedlist_handle_delete_all(&my_list);
+    }
+    linkedlist_pool_destroy(&my_pool);
+
+
+    /** Test2: an empty range or an index past the end fails without changing the list, an empty list takes a range at
+        index 0 **/
+    linkedlist_handle_init(&my_list);
+    model_count = 0;
+    model_insert(model_array, &model_count, 0, range_array[0]);
+    if((LINKEDLIST_OP_FAIL == linkedlist_insert_range(&my_list, 1, range_array, 1)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_append_array(&my_list, range_array, 0)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_insert_range(&my_list, 0, range_array, 1)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_insert_range(&my_list, 0, range_array, 0)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_insert_range(&my_list, 2, range_array, 1)) &&
+       (TEST_PASSED == list_model_check(&my_list, model_array, model_count)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    linkedlist_handle_delete_all(&my_list);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\ninsert_range_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\ninsert_range_test() test failed.");
+    }
+}
+
+static void delete_range_test(void)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    linkedlist_pool_t my_pool;
+    linkedlist_pool_stats_t my_pool_stats;
+    linkedlist_t my_list;
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t range_count = 0;
+    size_t index = 0;
+    size_t range_index = 0;
+
+    linkedlist_pool_init(&my_pool, 0);
+    linkedlist_handle_init(&my_list);
+    linkedlist_handle_pool_set(&my_list, &my_pool);
+    for(model_count = 0; model_count < MODEL_TEST_ELEMENTS; model_count++)
+    {
+        model_array[model_count] = (int)model_count;
+    }
+    linkedlist_append_array(&my_list, model_array, model_count);
+
+    /** Test1: ranges of random length deleted at random indexes, some of them up to the end of the list, and
+        truncating the list keep it equal to the model, and every deleted node goes back to the pool **/
+    srand(MODEL_TEST_SEED);
+    while((MODEL_TEST_RANGE < model_count) && (TEST_PASSED == test1_result))
+    {
+        range_count = 1u + ((size_t)rand() % MODEL_TEST_RANGE);
+        index = (0 == (rand() % 4)) ? (model_count - range_count) : ((size_t)rand() % (model_count - range_count));
+        if(0 == (rand() % 8))
+        {
+            /** Truncate to index nodes **/
+            range_count = model_count - index;
+            ret_val = linkedlist_truncate(&my_list, index);
+        }
+        else
+        {
+            ret_val = linkedlist_delete_range(&my_list, index, range_count);
+        }
+
+        for(range_index = 0; range_index < range_count; range_index++)
+        {
+            model_delete(model_array, &model_count, index);
+        }
+        linkedlist_pool_stats_get(&my_pool, &my_pool_stats);
+        if((LINKEDLIST_OP_SUCCESS != ret_val) || (model_count != my_pool_stats.used_node_count) ||
+           (TEST_FAILED == list_model_check(&my_list, model_array, model_count)))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+
+
+    /** Test2: empty ranges, ranges going past the end and truncating to more nodes fail without changing the list,
+        truncating to the same length does nothing, and deleting the whole list empties it **/
+    if((LINKEDLIST_OP_FAIL == linkedlist_delete_range(&my_list, 0, 0)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_delete_range(&my_list, model_count, 1)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_delete_range(&my_list, 1, model_count)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_delete_range(&my_list, 1, SIZE_MAX)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_truncate(&my_list, model_count + 1u)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_truncate(&my_list, model_count)) &&
+       (TEST_PASSED == list_model_check(&my_list, model_array, model_count)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_delete_range(&my_list, 0, model_count)) &&
+       (TEST_PASSED == list_model_check(&my_list, model_array, 0)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_delete_range(&my_list, 0, 1)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_truncate(&my_list, 0)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    linkedlist_pool_destroy(&my_pool);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\ndelete_range_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\ndelete_range_test() test failed.");
+    }
+}
+
+static void intrusive_list_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    intrusive_list_t my_list;
+    struct intrusive_link_t* link_current = NULL;
+    test_record_t record_array[MODEL_TEST_ELEMENTS];
+    int record_unlinked[MODEL_TEST_ELEMENTS]; /** ids of the records not linked at the moment **/
+    size_t unlinked_count = MODEL_TEST_ELEMENTS;
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t index = 0;
+    size_t loop_cntr = 0;
+
+    for(loop_cntr = 0; loop_cntr < MODEL_TEST_ELEMENTS; loop_cntr++)
+    {
+        record_array[loop_cntr].record_id = (int)loop_cntr;
+        record_unlinked[loop_cntr] = (int)loop_cntr;
+    }
+    intrusive_list_init(&my_list);
+
+    /** Test1: records linked and unlinked at random indexes keep the list equal to the model, and every link leads
+        back to its own record **/
+    srand(MODEL_TEST_SEED);
+    for(loop_cntr = 0; (loop_cntr < MODEL_TEST_OPERATIONS) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        if((0u == model_count) || ((0u != unlinked_count) && (0 != (rand() % 3))))
+        {
+            index = (size_t)rand() % (model_count + 1u);
+            unlinked_count = unlinked_count - 1u;
+            model_insert(model_array, &model_count, index, record_unlinked[unlinked_count]);
+            if(LINKEDLIST_OP_SUCCESS != intrusive_list_insert_index(&my_list, index,
+                                                    &record_array[record_unlinked[unlinked_count]].record_link))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+        else
+        {
+            index = (size_t)rand() % model_count;
+            record_unlinked[unlinked_count] = model_array[index];
+            unlinked_count = unlinked_count + 1u;
+            model_delete(model_array, &model_count, index);
+            if(LINKEDLIST_OP_SUCCESS != intrusive_list_delete_index(&my_list, index))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+
+        if((TEST_FAILED == intrusive_model_check(&my_list, model_array, model_count)) ||
+           ((0u != model_count) &&
+            ((LINKEDLIST_OP_SUCCESS != intrusive_list_get_index(&my_list, index % model_count, &link_current)) ||
+             (model_array[index % model_count] !=
+              INTRUSIVE_LIST_CONTAINER_OF(link_current, test_record_t, record_link)->record_id))))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+    intrusive_list_delete_all(&my_list);
+
+
+    /** Test2: empty list, NULL links, out of range indexes and a single record. Unlinking never touches the record
+        data **/
+    if((LINKEDLIST_OP_FAIL == intrusive_list_get_end(&my_list, &link_current)) &&
+       (LINKEDLIST_OP_FAIL == intrusive_list_get_index(&my_list, 0, &link_current)) &&
+       (LINKEDLIST_OP_FAIL == intrusive_list_delete_end(&my_list)) &&
+       (LINKEDLIST_OP_FAIL == intrusive_list_delete_index(&my_list, 0)) &&
+       (LINKEDLIST_OP_FAIL == intrusive_list_delete_all(&my_list)) &&
+       (NULL == intrusive_list_first(&my_list)) &&
+       (LINKEDLIST_OP_FAIL == intrusive_list_insert_end(&my_list, NULL)) &&
+       (LINKEDLIST_OP_FAIL == intrusive_list_insert_index(&my_list, 0, NULL)) &&
+       (LINKEDLIST_OP_FAIL == intrusive_list_insert_index(&my_list, 1, &record_array[7].record_link)) &&
+       (LINKEDLIST_OP_SUCCESS == intrusive_list_insert_end(&my_list, &record_array[7].record_link)) &&
+       (LINKEDLIST_OP_SUCCESS == intrusive_list_get_end(&my_list, &link_current)) &&
+       (&record_array[7] == INTRUSIVE_LIST_CONTAINER_OF(link_current, test_record_t, record_link)) &&
+       (NULL == intrusive_list_next(link_current)) &&
+       (LINKEDLIST_OP_FAIL == intrusive_list_get_index(&my_list, 1, &link_current)) &&
+       (LINKEDLIST_OP_SUCCESS == intrusive_list_delete_end(&my_list)) &&
+       (TEST_PASSED == intrusive_model_check(&my_list, model_array, 0)) && (7 == record_array[7].record_id))
+    {
+        test2_result = TEST_PASSED;
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nintrusive_list_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nintrusive_list_test() test failed.");
+    }
+}
+
+static void lockfree_list_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    pthread_t thread_id[LOCK_TEST_THREADS];
+    list_thread_arg_t thread_arg[LOCK_TEST_THREADS];
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t thread_slot = 0;
+    size_t slot_cntr = 0;
+    size_t index = 0;
+    size_t loop_cntr = 0;
+    int key = 0;
+    int key_present = 0;
+
+    lockfree_list_init(&my_lockfree_list);
+
+    /** Test1: random inserts, deletes and lookups from one thread return what the sorted model expects, and the list
+        stays sorted and equal to it **/
+    lockfree_list_thread_attach(&my_lockfree_list, &thread_slot);
+    srand(MODEL_TEST_SEED);
+    for(loop_cntr = 0; (loop_cntr < MODEL_TEST_OPERATIONS) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        key = rand() % LOCKFREE_TEST_KEY_RANGE;
+        index = 0;
+        while((index < model_count) && (model_array[index] < key))
+        {
+            index = index + 1u;
+        }
+        key_present = (index < model_count) && (key == model_array[index]);
+
+        if(((0 != key_present) ? LINKEDLIST_OP_SUCCESS : LINKEDLIST_OP_FAIL) !=
+           lockfree_list_contains(&my_lockfree_list, thread_slot, key))
+        {
+            test1_result = TEST_FAILED;
+        }
+        else if(0 == (rand() % 2))
+        {
+            if(((0 != key_present) ? LINKEDLIST_OP_FAIL : LINKEDLIST_OP_SUCCESS) !=
+               lockfree_list_insert(&my_lockfree_list, thread_slot, key))
+            {
+                test1_result = TEST_FAILED;
+            }
+            else if(0 == key_present)
+            {
+                model_insert(model_array, &model_count, index, key);
+            }
+        }
+        else
+        {
+            if(((0 != key_present) ? LINKEDLIST_OP_SUCCESS : LINKEDLIST_OP_FAIL) !=
+               lockfree_list_delete(&my_lockfree_list, thread_slot, key))
+            {
+                test1_result = TEST_FAILED;
+            }
+            else if(0 != key_present)
+            {
+                model_delete(model_array, &model_count, index);
+            }
+        }
+
+        if(TEST_FAILED == lockfree_model_check(&my_lockfree_list, model_array, model_count))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+    lockfree_list_thread_detach(&my_lockfree_list, thread_slot);
+    lockfree_list_destroy(&my_lockfree_list);
+
+
+    /** Test2: threads inserting, looking up and deleting keys of their own at the same time leave exactly the keys
+        none of them deleted. All the slots can be taken, and one more thread can't attach. **/
+    lockfree_list_init(&my_lockfree_list);
+    for(loop_cntr = 0; loop_cntr < LOCK_TEST_THREADS; loop_cntr++)
+    {
+        thread_arg[loop_cntr].thread_index = (int)loop_cntr;
+        thread_arg[loop_cntr].thread_result = TEST_FAILED;
+        pthread_create(&thread_id[loop_cntr], NULL, lockfree_test_thread, &thread_arg[loop_cntr]);
+    }
+    test2_result = TEST_PASSED;
+    for(loop_cntr = 0; loop_cntr < LOCK_TEST_THREADS; loop_cntr++)
+    {
+        pthread_join(thread_id[loop_cntr], NULL);
+        if(TEST_PASSED != thread_arg[loop_cntr].thread_result)
+        {
+            test2_result = TEST_FAILED;
+        }
+    }
+
+    /** Every thread deleted its keys at even positions k, key k * LOCK_TEST_THREADS + thread index **/
+    model_count = 0;
+    for(key = 0; key < (LOCKFREE_TEST_KEYS * LOCK_TEST_THREADS); key++)
+    {
+        if(0 != ((key / LOCK_TEST_THREADS) % 2))
+        {
+            model_array[model_count] = key;
+            model_count = model_count + 1u;
+        }
+    }
+    if(TEST_FAILED == lockfree_model_check(&my_lockfree_list, model_array, model_count))
+    {
+        test2_result = TEST_FAILED;
+    }
+    for(slot_cntr = 0; slot_cntr < LOCKFREE_LIST_MAX_THREADS; slot_cntr++)
+    {
+        if(LINKEDLIST_OP_SUCCESS != lockfree_list_thread_attach(&my_lockfree_list, &thread_slot))
+        {
+            test2_result = TEST_FAILED;
+        }
+    }
+    if((LINKEDLIST_OP_FAIL != lockfree_list_thread_attach(&my_lockfree_list, &thread_slot)) ||
+       (LINKEDLIST_OP_FAIL != lockfree_list_thread_detach(&my_lockfree_list, LOCKFREE_LIST_MAX_THREADS)))
+    {
+        test2_result = TEST_FAILED;
+    }
+    lockfree_list_destroy(&my_lockfree_list);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nlockfree_list_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nlockfree_list_test() test failed.");
+    }
+}
+
+static void hoh_list_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    pthread_t thread_id[LOCK_TEST_THREADS];
+    list_thread_arg_t thread_arg[LOCK_TEST_THREADS];
+    struct hoh_node_t* node_current = NULL;
+    int data_next[LOCK_TEST_THREADS];
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t index = 0;
+    size_t loop_cntr = 0;
+    int data = 0;
+
+    hoh_list_init(&my_hoh_list);
+
+    /** Test1: random inserts and deletes at random indexes from one thread keep the list equal to the model **/
+    srand(MODEL_TEST_SEED);
+    for(loop_cntr = 0; (loop_cntr < MODEL_TEST_OPERATIONS) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        if((0u == model_count) || ((model_count < MODEL_TEST_ELEMENTS) && (0 != (rand() % 3))))
+        {
+            index = (size_t)rand() % (model_count + 1u);
+            model_insert(model_array, &model_count, index, (int)loop_cntr);
+            if(LINKEDLIST_OP_SUCCESS != hoh_list_insert_index(&my_hoh_list, index, (int)loop_cntr))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+        else
+        {
+            index = (size_t)rand() % model_count;
+            model_delete(model_array, &model_count, index);
+            if(LINKEDLIST_OP_SUCCESS != hoh_list_delete_index(&my_hoh_list, index))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+
+        if((TEST_FAILED == hoh_model_check(&my_hoh_list, model_array, model_count)) ||
+           ((0u != model_count) &&
+            ((LINKEDLIST_OP_SUCCESS != hoh_list_get_index(&my_hoh_list, index % model_count, &data)) ||
+             (model_array[index % model_count] != data) ||
+             (LINKEDLIST_OP_SUCCESS != hoh_list_get_end(&my_hoh_list, &data)) ||
+             (model_array[model_count - 1u] != data))))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+    hoh_list_delete_all(&my_hoh_list);
+
+
+    /** Test2: the empty list and out of range indexes fail, then threads appending, reading and deleting the first
+        node at the same time keep the order each thread appended in, and leave the list empty **/
+    if((LINKEDLIST_OP_FAIL == hoh_list_get_end(&my_hoh_list, &data)) &&
+       (LINKEDLIST_OP_FAIL == hoh_list_get_index(&my_hoh_list, 0, &data)) &&
+       (LINKEDLIST_OP_FAIL == hoh_list_delete_end(&my_hoh_list)) &&
+       (LINKEDLIST_OP_FAIL == hoh_list_delete_index(&my_hoh_list, 0)) &&
+       (LINKEDLIST_OP_FAIL == hoh_list_delete_all(&my_hoh_list)) &&
+       (LINKEDLIST_OP_FAIL == hoh_list_insert_index(&my_hoh_list, 1, 7)) &&
+       (LINKEDLIST_OP_SUCCESS == hoh_list_insert_index(&my_hoh_list, 0, 7)) &&
+       (LINKEDLIST_OP_FAIL == hoh_list_get_index(&my_hoh_list, 1, &data)) &&
+       (LINKEDLIST_OP_SUCCESS == hoh_list_delete_end(&my_hoh_list)) && (0u == hoh_list_size(&my_hoh_list)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    for(loop_cntr = 0; loop_cntr < LOCK_TEST_THREADS; loop_cntr++)
+    {
+        thread_arg[loop_cntr].thread_index = (int)loop_cntr;
+        pthread_create(&thread_id[loop_cntr], NULL, hoh_test_thread, &thread_arg[loop_cntr]);
+    }
+    for(loop_cntr = 0; loop_cntr < LOCK_TEST_THREADS; loop_cntr++)
+    {
+        pthread_join(thread_id[loop_cntr], NULL);
+        data_next[loop_cntr] = (int)loop_cntr * LOCK_TEST_INSERTS;
+        if(TEST_PASSED != thread_arg[loop_cntr].thread_result)
+        {
+            test2_result = TEST_FAILED;
+        }
+    }
+
+    /** The data of every thread is found in the order it was appended in **/
+    for(node_current = my_hoh_list.head_node.next_node_address_ptr; NULL != node_current;
+        node_current = node_current->next_node_address_ptr)
+    {
+        index = (size_t)(node_current->data / LOCK_TEST_INSERTS);
+        if((LOCK_TEST_THREADS <= index) || (data_next[index] != node_current->data))
+        {
+            test2_result = TEST_FAILED;
+        }
+        else
+        {
+            data_next[index] = data_next[index] + 1;
+        }
+    }
+    if((LOCK_TEST_THREADS * LOCK_TEST_INSERTS) != hoh_list_size(&my_hoh_list))
+    {
+        test2_result = TEST_FAILED;
+    }
+
+    for(loop_cntr = 0; loop_cntr < LOCK_TEST_THREADS; loop_cntr++)
+    {
+        pthread_create(&thread_id[loop_cntr], NULL, hoh_test_delete_thread, &thread_arg[loop_cntr]);
+    }
+    for(loop_cntr = 0; loop_cntr < LOCK_TEST_THREADS; loop_cntr++)
+    {
+        pthread_join(thread_id[loop_cntr], NULL);
+        if(TEST_PASSED != thread_arg[loop_cntr].thread_result)
+        {
+            test2_result = TEST_FAILED;
+        }
+    }
+    if(TEST_FAILED == hoh_model_check(&my_hoh_list, model_array, 0))
+    {
+        test2_result = TEST_FAILED;
+    }
+    hoh_list_destroy(&my_hoh_list);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nhoh_list_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nhoh_list_test() test failed.");
+    }
+}
+
+static void sort_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    linkedlist_pool_t my_pool;
+    linkedlist_t my_list;
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t list_size = 0;
+    size_t index = 0;
+    size_t loop_cntr = 0;
+
+    linkedlist_pool_init(&my_pool, 0);
+
+    /** Test1: lists of growing size holding repeated values, half of them pool based, are sorted like the model, and
+        dedup keeps only the first of equal values **/
+    srand(MODEL_TEST_SEED);
+    for(list_size = 0; (list_size <= MODEL_TEST_ELEMENTS) && (TEST_PASSED == test1_result);
+        list_size = (list_size * 2u) + 1u)
+    {
+        for(loop_cntr = 0; loop_cntr < 2u; loop_cntr++)
+        {
+            linkedlist_handle_init(&my_list);
+            linkedlist_handle_pool_set(&my_list, (0u != loop_cntr) ? &my_pool : NULL);
+            for(model_count = 0; model_count < list_size; model_count++)
+            {
+                model_array[model_count] = rand() % MODEL_TEST_VALUE_RANGE;
+                linkedlist_handle_insert_end(&my_list, model_array[model_count]);
+            }
+
+            qsort(model_array, model_count, sizeof(int), model_compare);
+            if((LINKEDLIST_OP_SUCCESS != linkedlist_sort(&my_list)) ||
+               (TEST_FAILED == list_model_check(&my_list, model_array, model_count)))
+            {
+                test1_result = TEST_FAILED;
+            }
+
+            index = 1;
+            while(index < model_count)
+            {
+                if(model_array[index] == model_array[index - 1u])
+                {
+                    model_delete(model_array, &model_count, index);
+                }
+                else
+                {
+                    index = index + 1u;
+                }
+            }
+            if((LINKEDLIST_OP_SUCCESS != linkedlist_dedup(&my_list)) ||
+               (TEST_FAILED == list_model_check(&my_list, model_array, model_count)))
+            {
+                test1_result = TEST_FAILED;
+            }
+            linkedlist_handle_delete_all(&my_list);
+        }
+    }
+    linkedlist_pool_destroy(&my_pool);
+
+
+    /** Test2: NULL lists fail, an already sorted list and a list of equal values are left as they are **/
+    linkedlist_handle_init(&my_list);
+    for(model_count = 0; model_count < MODEL_TEST_RANGE; model_count++)
+    {
+        model_array[model_count] = (int)(model_count / 2u);
+        linkedlist_handle_insert_end(&my_list, model_array[model_count]);
+    }
+    if((LINKEDLIST_OP_FAIL == linkedlist_sort(NULL)) && (LINKEDLIST_OP_FAIL == linkedlist_dedup(NULL)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_sort(&my_list)) &&
+       (TEST_PASSED == list_model_check(&my_list, model_array, model_count)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_truncate(&my_list, 1)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_append_array(&my_list, model_array, 1)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_dedup(&my_list)) &&
+       (TEST_PASSED == list_model_check(&my_list, model_array, 1)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    linkedlist_handle_delete_all(&my_list);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nsort_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nsort_test() test failed.");
+    }
+}
+
+static void merge_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    linkedlist_pool_t my_pool;
+    linkedlist_t my_list;
+    linkedlist_t my_source_list;
+    int model_array[MODEL_TEST_ELEMENTS];
+    int source_array[MODEL_TEST_ELEMENTS / 2u];
+    int merged_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t source_count = 0;
+    size_t merged_count = 0;
+    size_t index = 0;
+    size_t source_index = 0;
+    size_t loop_cntr = 0;
+
+    /** Test1: pairs of random lists, empty ones included, are merged like the model. Sorted lists give a sorted list,
+        and lists that aren't sorted still give a valid list ending with the right node. **/
+    srand(MODEL_TEST_SEED);
+    for(loop_cntr = 0; (loop_cntr < (MODEL_TEST_OPERATIONS / 100u)) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        linkedlist_handle_init(&my_list);
+        linkedlist_handle_init(&my_source_list);
+        model_count  = (size_t)rand() % (MODEL_TEST_ELEMENTS / 2u);
+        source_count = (size_t)rand() % (MODEL_TEST_ELEMENTS / 2u);
+        model_count  = (0u == (loop_cntr % 5u)) ? 0u : model_count;
+        source_count = (1u == (loop_cntr % 5u)) ? 0u : source_count;
+        for(index = 0; index < model_count; index++)
+        {
+            model_array[index] = rand() % MODEL_TEST_VALUE_RANGE;
+        }
+        for(index = 0; index < source_count; index++)
+        {
+            source_array[index] = rand() % MODEL_TEST_VALUE_RANGE;
+        }
+        if(0u != (loop_cntr % 4u))
+        {
+            qsort(model_array, model_count, sizeof(int), model_compare);
+            qsort(source_array, source_count, sizeof(int), model_compare);
+        }
+        linkedlist_from_array(&my_list, model_array, model_count);
+        linkedlist_from_array(&my_source_list, source_array, source_count);
+
+        /** Model merge, taking from the list first on equal values, then the rest of either one **/
+        index = 0;
+        source_index = 0;
+        merged_count = 0;
+        while((index < model_count) && (source_index < source_count))
+        {
+            if(model_array[index] <= source_array[source_index])
+            {
+                merged_array[merged_count] = model_array[index];
+                index = index + 1u;
+            }
+            else
+            {
+                merged_array[merged_count] = source_array[source_index];
+                source_index = source_index + 1u;
+            }
+            merged_count = merged_count + 1u;
+        }
+        memcpy(&merged_array[merged_count], &model_array[index], (model_count - index) * sizeof(int));
+        merged_count = merged_count + (model_count - index);
+        memcpy(&merged_array[merged_count], &source_array[source_index], (source_count - source_index) * sizeof(int));
+        merged_count = merged_count + (source_count - source_index);
+
+        if((LINKEDLIST_OP_SUCCESS != linkedlist_merge(&my_list, &my_source_list)) ||
+           (TEST_FAILED == list_model_check(&my_list, merged_array, merged_count)) ||
+           (TEST_FAILED == list_model_check(&my_source_list, merged_array, 0)))
+        {
+            test1_result = TEST_FAILED;
+        }
+        linkedlist_handle_delete_all(&my_list);
+    }
+
+
+    /** Test2: merging a list into itself, from a list using another pool, or NULL lists fails without changing
+        anything **/
+    linkedlist_pool_init(&my_pool, 0);
+    linkedlist_handle_init(&my_list);
+    linkedlist_handle_init(&my_source_list);
+    linkedlist_handle_pool_set(&my_source_list, &my_pool);
+    linkedlist_append_array(&my_list, model_array, 1);
+    linkedlist_append_array(&my_source_list, source_array, 1);
+    if((LINKEDLIST_OP_FAIL == linkedlist_merge(&my_list, &my_list)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_merge(&my_list, &my_source_list)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_merge(&my_list, NULL)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_merge(NULL, &my_list)) &&
+       (TEST_PASSED == list_model_check(&my_list, model_array, 1)) &&
+       (TEST_PASSED == list_model_check(&my_source_list, source_array, 1)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    linkedlist_handle_delete_all(&my_list);
+    linkedlist_handle_delete_all(&my_source_list);
+    linkedlist_pool_destroy(&my_pool);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nmerge_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nmerge_test() test failed.");
+    }
+}
+
+static void compact_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    linkedlist_pool_t my_pool;
+    linkedlist_pool_stats_t my_pool_stats;
+    linkedlist_t my_list;
+    struct node_t* node_current = NULL;
+    struct node_t* head_node_ptr = NULL;
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t index = 0;
+    int pool_used = 0;
+
+    linkedlist_pool_init(&my_pool, 0);
+
+    /** Test1: a list scattered by inserts at random indexes keeps its elements when it is compacted. A pool based
+        list then lies in one run of the pool and gives its old nodes back, a list using malloc() has its nodes in
+        increasing address order. **/
+    srand(MODEL_TEST_SEED);
+    for(pool_used = 0; (pool_used < 2) && (TEST_PASSED == test1_result); pool_used++)
+    {
+        linkedlist_handle_init(&my_list);
+        linkedlist_handle_pool_set(&my_list, (0 != pool_used) ? &my_pool : NULL);
+        model_count = 0;
+        while(model_count < MODEL_TEST_ELEMENTS)
+        {
+            index = (size_t)rand() % (model_count + 1u);
+            linkedlist_handle_insert_index(&my_list, index, (int)model_count);
+            model_insert(model_array, &model_count, index, (int)model_count);
+        }
+
+        if((LINKEDLIST_OP_SUCCESS != linkedlist_compact(&my_list)) ||
+           (TEST_FAILED == list_model_check(&my_list, model_array, model_count)))
+        {
+            test1_result = TEST_FAILED;
+        }
+        else if(0 != pool_used)
+        {
+            linkedlist_pool_stats_get(&my_pool, &my_pool_stats);
+            if((sizeof(struct node_t) != linkedlist_stride_average(&my_list)) ||
+               (model_count != my_pool_stats.used_node_count))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+        else
+        {
+            for(node_current = my_list.head_node_ptr; NULL != node_current->next_node_address_ptr;
+                node_current = node_current->next_node_address_ptr)
+            {
+                if((uintptr_t)node_current >= (uintptr_t)node_current->next_node_address_ptr)
+                {
+                    test1_result = TEST_FAILED;
+                }
+            }
+        }
+        linkedlist_handle_delete_all(&my_list);
+    }
+    linkedlist_pool_destroy(&my_pool);
+
+
+    /** Test2: NULL lists fail, empty and single node lists have nothing to compact, and a list is only compacted if
+        its stride is over the threshold **/
+    linkedlist_handle_init(&my_list);
+    if((LINKEDLIST_OP_FAIL == linkedlist_compact(NULL)) && (0.0 == linkedlist_stride_average(NULL)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_compact(&my_list)) && (0.0 == linkedlist_stride_average(&my_list)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_append_array(&my_list, model_array, 1)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_compact(&my_list)) && (0.0 == linkedlist_stride_average(&my_list)) &&
+       (TEST_PASSED == list_model_check(&my_list, model_array, 1)))
+    {
+        /** Under the threshold the nodes stay where they are, over it they are relinked keeping the list order **/
+        linkedlist_handle_insert_index(&my_list, 0, model_array[1]);
+        head_node_ptr = my_list.head_node_ptr;
+        if((LINKEDLIST_OP_SUCCESS == linkedlist_compact_if_fragmented(&my_list, 1e30)) &&
+           (head_node_ptr == my_list.head_node_ptr) &&
+           (LINKEDLIST_OP_SUCCESS == linkedlist_compact_if_fragmented(&my_list, 0.0)) &&
+           (model_array[1] == my_list.head_node_ptr->data) && (model_array[0] == my_list.tail_node_ptr->data))
+        {
+            test2_result = TEST_PASSED;
+        }
+    }
+    linkedlist_handle_delete_all(&my_list);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\ncompact_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\ncompact_test() test failed.");
+    }
+}
+
+static void traversal_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    static visit_context_t visit_context;
+    linkedlist_t my_list;
+    struct node_t* split_nodes[MODEL_TEST_RANGE];
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t index = 0;
+    size_t split_count = 0;
+    size_t loop_cntr = 0;
+    int traversal_mode = 0;
+    int data = 0;
+
+    /** Test1: in every traversal mode, inserts and deletes at random indexes and at the end keep reads by index,
+        full traversals and split points equal to the model **/
+    srand(MODEL_TEST_SEED);
+    for(traversal_mode = LINKEDLIST_TRAVERSAL_PLAIN; (traversal_mode <= LINKEDLIST_TRAVERSAL_JUMP) &&
+        (TEST_PASSED == test1_result); traversal_mode++)
+    {
+        linkedlist_handle_init(&my_list);
+        linkedlist_traversal_set(&my_list, (linkedlist_traversal_t)traversal_mode);
+        model_count = 0;
+        for(loop_cntr = 0; (loop_cntr < MODEL_TEST_OPERATIONS) && (TEST_PASSED == test1_result); loop_cntr++)
+        {
+            if((0u == model_count) || ((model_count < MODEL_TEST_ELEMENTS) && (0 != (rand() % 3))))
+            {
+                /** Every other insert appends, which keeps the jump table up to date **/
+                index = (0u == (loop_cntr % 2u)) ? model_count : ((size_t)rand() % (model_count + 1u));
+                model_insert(model_array, &model_count, index, (int)loop_cntr);
+                test1_result = (LINKEDLIST_OP_SUCCESS ==
+                                linkedlist_handle_insert_index(&my_list, index, (int)loop_cntr)) ? TEST_PASSED :
+                                                                                                   TEST_FAILED;
+            }
+            else
+            {
+                index = (0u == (loop_cntr % 2u)) ? (model_count - 1u) : ((size_t)rand() % model_count);
+                model_delete(model_array, &model_count, index);
+                test1_result = (LINKEDLIST_OP_SUCCESS == linkedlist_handle_delete_index(&my_list, index)) ?
+                               TEST_PASSED : TEST_FAILED;
+            }
+
+            index = (size_t)rand() % (model_count + 1u);
+            if((TEST_FAILED == list_model_check(&my_list, model_array, model_count)) ||
+               ((index < model_count) &&
+                ((LINKEDLIST_OP_SUCCESS != linkedlist_handle_get_index(&my_list, index, &data)) ||
+                 (model_array[index] != data))))
+            {
+                test1_result = TEST_FAILED;
+            }
+
+            /** Full traversals and split points every few operations **/
+            if(0u == (loop_cntr % 16u))
+            {
+                visit_context.data_count = 0;
+                split_count = 1u + ((size_t)rand() % MODEL_TEST_RANGE);
+                if((LINKEDLIST_OP_SUCCESS != linkedlist_for_each(&my_list, traversal_test_visit, &visit_context)) ||
+                   (model_count != visit_context.data_count) ||
+                   (0 != memcmp(model_array, visit_context.data_array, model_count * sizeof(int))))
+                {
+                    test1_result = TEST_FAILED;
+                }
+                if(split_count <= model_count)
+                {
+                    if(LINKEDLIST_OP_SUCCESS != linkedlist_split_points(&my_list, split_count, split_nodes))
+                    {
+                        test1_result = TEST_FAILED;
+                    }
+                    for(index = 0; index < split_count; index++)
+                    {
+                        if(model_array[(index * model_count) / split_count] != split_nodes[index]->data)
+                        {
+                            test1_result = TEST_FAILED;
+                        }
+                    }
+                }
+            }
+        }
+        linkedlist_handle_delete_all(&my_list);
+    }
+
+
+    /** Test2: invalid modes, NULL lists and functions, and split counts of 0 or over the node count fail. An empty
+        list is traversed without visiting anything, and leaving the jump mode frees the table. **/
+    linkedlist_handle_init(&my_list);
+    visit_context.data_count = 0;
+    if((LINKEDLIST_OP_FAIL == linkedlist_traversal_set(&my_list, (linkedlist_traversal_t)3)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_traversal_set(NULL, LINKEDLIST_TRAVERSAL_JUMP)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_for_each(NULL, traversal_test_visit, &visit_context)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_for_each(&my_list, NULL, &visit_context)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_traversal_set(&my_list, LINKEDLIST_TRAVERSAL_JUMP)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_for_each(&my_list, traversal_test_visit, &visit_context)) &&
+       (0u == visit_context.data_count) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_split_points(&my_list, 1, split_nodes)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_append_array(&my_list, model_array, model_count)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_split_points(&my_list, 0, split_nodes)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_split_points(&my_list, model_count + 1u, split_nodes)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_handle_get_index(&my_list, model_count / 2u, &data)) &&
+       (NULL != my_list.jump_table_ptr) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_traversal_set(&my_list, LINKEDLIST_TRAVERSAL_PLAIN)) &&
+       (NULL == my_list.jump_table_ptr) && (TEST_PASSED == list_model_check(&my_list, model_array, model_count)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    linkedlist_handle_delete_all(&my_list);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\ntraversal_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\ntraversal_test() test failed.");
+    }
+}
+
+static void head_insert_index_test(void)
+{
+    test_result_t test1_result = TEST_FAILED;
+    test_result_t test2_result = TEST_FAILED;
+    struct node_t head_node = {10, NULL};
+    linkedlist_stats_t stats_before;
+    linkedlist_stats_t stats_after;
+    const int model_array[] = {10, 15, 20, 25, 30};
+    size_t model_count = sizeof(model_array) / sizeof(model_array[0]);
+    size_t index = 0;
+    int data = 0;
+
+    /** Test1: indexes after the head node and before the last node are inserted at **/
+    (void)linkedlist_stats_get(&stats_before);
+    test1_result = TEST_PASSED;
+    if((LINKEDLIST_OP_SUCCESS != linkedlist_insert_end(&head_node, 20)) ||
+       (LINKEDLIST_OP_SUCCESS != linkedlist_insert_end(&head_node, 30)) ||
+       (LINKEDLIST_OP_SUCCESS != linkedlist_insert_index(&head_node, 1, 15)) ||
+       (LINKEDLIST_OP_SUCCESS != linkedlist_insert_index(&head_node, 3, 25)))
+    {
+        test1_result = TEST_FAILED;
+    }
+    for(index = 0; index < model_count; index++)
+    {
+        if((LINKEDLIST_OP_SUCCESS != linkedlist_get_index(&head_node, index, &data)) || (model_array[index] != data))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+
+
+    /** Test2: the head node index and indexes past the last node fail without changing the list, and the node
+        allocated for them is freed again **/
+    if((LINKEDLIST_OP_FAIL == linkedlist_insert_index(&head_node, 0, 99)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_insert_index(&head_node, model_count, 99)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_insert_index(&head_node, model_count + 1u, 99)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_insert_index(&head_node, SIZE_MAX, 99)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_get_end(&head_node, &data)) && (model_array[model_count - 1u] == data) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_get_index(&head_node, model_count, &data)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    (void)linkedlist_delete_all(&head_node);
+
+    /** With the counters built in, every counted allocation must have a counted free **/
+    if((LINKEDLIST_OP_SUCCESS == linkedlist_stats_get(&stats_after)) &&
+       ((stats_after.alloc_count - stats_before.alloc_count) != (stats_after.free_count - stats_before.free_count)))
+    {
+        test2_result = TEST_FAILED;
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nhead_insert_index_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nhead_insert_index_test() test failed.");
+    }
+}
+
+static void stats_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_PASSED;
+    const unsigned long long stats_enabled = (1 == LINKEDLIST_STATS_ENABLE) ? 1ull : 0ull;
+    const unsigned long long node_count = STATS_TEST_NODES;
+    unsigned long long calls_expected[LINKEDLIST_STATS_OP_COUNT] = {0};
+    unsigned long long nodes_expected[LINKEDLIST_STATS_OP_COUNT] = {0};
+    unsigned long long bins_total = 0;
+    linkedlist_stats_t stats_before;
+    linkedlist_stats_t stats_after;
+    linkedlist_t my_list;
+    static char json_buffer[STATS_TEST_JSON_BYTES];
+    char json_member[STATS_TEST_MEMBER_BYTES];
+    FILE* json_file = NULL;
+    size_t json_length = 0;
+    size_t member_length = 0;
+    size_t op_index = 0;
+    size_t bin_index = 0;
+    size_t match_count = 0;
+    size_t index = 0;
+    int data = 0;
+
+    /** Test1: every call of known operations on a list of known length is counted once, with the exact number of
+        nodes it visited and in exactly one latency bin. Without the counters built in, nothing is counted. **/
+    linkedlist_stats_reset();
+    if(LINKEDLIST_OP_SUCCESS != linkedlist_handle_init(&my_list))
+    {
+        test1_result = TEST_FAILED;
+    }
+    for(index = 0; index < STATS_TEST_NODES; index++)
+    {
+        (void)linkedlist_stats_get(&stats_before);
+        (void)linkedlist_handle_insert_end(&my_list, (int)index);
+        (void)linkedlist_stats_get(&stats_after);
+        if(TEST_PASSED != stats_call_check(&stats_before, &stats_after, LINKEDLIST_STATS_HANDLE_INSERT_END, 0))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+    /** A read walks from the head node to its index, except for the last node, which the handle points to **/
+    for(index = 0; index < STATS_TEST_NODES; index++)
+    {
+        (void)linkedlist_stats_get(&stats_before);
+        if((LINKEDLIST_OP_SUCCESS != linkedlist_handle_get_index(&my_list, index, &data)) || ((int)index != data))
+        {
+            test1_result = TEST_FAILED;
+        }
+        (void)linkedlist_stats_get(&stats_after);
+        if(TEST_PASSED != stats_call_check(&stats_before, &stats_after, LINKEDLIST_STATS_HANDLE_GET_INDEX,
+                                           ((STATS_TEST_NODES - 1u) == index) ? 0u : index))
+        {
+            test1_result = TEST_FAILED;
+        }
+        nodes_expected[LINKEDLIST_STATS_HANDLE_GET_INDEX] += ((STATS_TEST_NODES - 1u) == index) ? 0u : index;
+    }
+    (void)linkedlist_stats_get(&stats_before);
+    if((LINKEDLIST_OP_SUCCESS != linkedlist_count_of(&my_list, 0, &match_count)) || (1u != match_count))
+    {
+        test1_result = TEST_FAILED;
+    }
+    (void)linkedlist_stats_get(&stats_after);
+    if(TEST_PASSED != stats_call_check(&stats_before, &stats_after, LINKEDLIST_STATS_COUNT_OF, node_count))
+    {
+        test1_result = TEST_FAILED;
+    }
+    (void)linkedlist_stats_get(&stats_before);
+    if((LINKEDLIST_OP_SUCCESS != linkedlist_index_of(&my_list, (int)(STATS_TEST_NODES / 2u), &index)) ||
+       ((STATS_TEST_NODES / 2u) != index))
+    {
+        test1_result = TEST_FAILED;
+    }
+    (void)linkedlist_stats_get(&stats_after);
+    if(TEST_PASSED != stats_call_check(&stats_before, &stats_after, LINKEDLIST_STATS_INDEX_OF, node_count / 2u))
+    {
+        test1_result = TEST_FAILED;
+    }
+    (void)linkedlist_stats_get(&stats_before);
+    (void)linkedlist_handle_delete_all(&my_list);
+    (void)linkedlist_stats_get(&stats_after);
+    if(TEST_PASSED != stats_call_check(&stats_before, &stats_after, LINKEDLIST_STATS_HANDLE_DELETE_ALL, node_count))
+    {
+        test1_result = TEST_FAILED;
+    }
+
+    /** The counters add up all the calls since the reset, and every allocated node was freed **/
+    calls_expected[LINKEDLIST_STATS_HANDLE_INSERT_END] = node_count;
+    calls_expected[LINKEDLIST_STATS_HANDLE_GET_INDEX]  = node_count;
+    calls_expected[LINKEDLIST_STATS_COUNT_OF]          = 1u;
+    calls_expected[LINKEDLIST_STATS_INDEX_OF]          = 1u;
+    calls_expected[LINKEDLIST_STATS_HANDLE_DELETE_ALL] = 1u;
+    nodes_expected[LINKEDLIST_STATS_COUNT_OF]          = node_count;
+    nodes_expected[LINKEDLIST_STATS_INDEX_OF]          = node_count / 2u;
+    nodes_expected[LINKEDLIST_STATS_HANDLE_DELETE_ALL] = node_count;
+    if((((1 == LINKEDLIST_STATS_ENABLE) ? LINKEDLIST_OP_SUCCESS : LINKEDLIST_OP_FAIL) !=
+        linkedlist_stats_get(&stats_after)) ||
+       ((stats_enabled * node_count) != stats_after.alloc_count) ||
+       ((stats_enabled * node_count) != stats_after.free_count))
+    {
+        test1_result = TEST_FAILED;
+    }
+    for(op_index = 0; op_index < LINKEDLIST_STATS_OP_COUNT; op_index++)
+    {
+        bins_total = 0;
+        for(bin_index = 0; bin_index < LINKEDLIST_STATS_HISTOGRAM_BINS; bin_index++)
+        {
+            bins_total = bins_total + stats_after.op_entries[op_index].latency_histogram[bin_index];
+        }
+        if(((stats_enabled * calls_expected[op_index]) != stats_after.op_entries[op_index].call_count) ||
+           ((stats_enabled * nodes_expected[op_index]) != stats_after.op_entries[op_index].nodes_traversed) ||
+           (stats_after.op_entries[op_index].call_count != bins_total))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+
+
+    /** Test2: every counted function has a name, and the JSON holds every counter under it **/
+    if((0 != strcmp("linkedlist_insert_end", linkedlist_stats_op_name(LINKEDLIST_STATS_INSERT_END))) ||
+       (0 != strcmp("linkedlist_handle_insert_end", linkedlist_stats_op_name(LINKEDLIST_STATS_HANDLE_INSERT_END))) ||
+       (0 != strcmp("linkedlist_handle_get_index", linkedlist_stats_op_name(LINKEDLIST_STATS_HANDLE_GET_INDEX))) ||
+       (0 != strcmp("linkedlist_handle_delete_all", linkedlist_stats_op_name(LINKEDLIST_STATS_HANDLE_DELETE_ALL))) ||
+       (0 != strcmp("linkedlist_index_of", linkedlist_stats_op_name(LINKEDLIST_STATS_INDEX_OF))) ||
+       (0 != strcmp("linkedlist_count_of", linkedlist_stats_op_name(LINKEDLIST_STATS_COUNT_OF))) ||
+       (0 != strcmp("linkedlist_from_array", linkedlist_stats_op_name(LINKEDLIST_STATS_FROM_ARRAY))) ||
+       (NULL != linkedlist_stats_op_name(LINKEDLIST_STATS_OP_COUNT)))
+    {
+        test2_result = TEST_FAILED;
+    }
+    json_file = tmpfile();
+    if((NULL == json_file) || (LINKEDLIST_OP_SUCCESS != linkedlist_stats_dump_json(json_file)))
+    {
+        test2_result = TEST_FAILED;
+    }
+    else
+    {
+        rewind(json_file);
+        json_length = fread(json_buffer, 1, STATS_TEST_JSON_BYTES - 1u, json_file);
+        json_buffer[json_length] = '\0';
+        snprintf(json_member, STATS_TEST_MEMBER_BYTES, "{\n  \"enabled\": %s,\n  \"alloc_count\": %llu,\n"
+                 "  \"free_count\": %llu,\n  \"operations\": {", (0u != stats_enabled) ? "true" : "false",
+                 stats_enabled * node_count, stats_enabled * node_count);
+        if((0 != strncmp(json_buffer, json_member, strlen(json_member))) ||
+           (NULL == strstr(json_buffer, "\n  }\n}\n")) || ((STATS_TEST_JSON_BYTES - 1u) == json_length))
+        {
+            test2_result = TEST_FAILED;
+        }
+        for(op_index = 0; op_index < LINKEDLIST_STATS_OP_COUNT; op_index++)
+        {
+            member_length = (size_t)snprintf(json_member, STATS_TEST_MEMBER_BYTES, "\"%s\": {\"calls\": %llu, "
+                                             "\"nodes_traversed\": %llu, \"latency_total_ns\": %llu, "
+                                             "\"latency_histogram_log2_ns\": [",
+                                             linkedlist_stats_op_name((linkedlist_stats_op_t)op_index),
+                                             stats_after.op_entries[op_index].call_count,
+                                             stats_after.op_entries[op_index].nodes_traversed,
+                                             stats_after.op_entries[op_index].latency_total_ns);
+            for(bin_index = 0; bin_index < LINKEDLIST_STATS_HISTOGRAM_BINS; bin_index++)
+            {
+                member_length += (size_t)snprintf(&json_member[member_length], STATS_TEST_MEMBER_BYTES - member_length,
+                                                  "%s%llu", (0u == bin_index) ? "" : ", ",
+                                                  stats_after.op_entries[op_index].latency_histogram[bin_index]);
+            }
+            snprintf(&json_member[member_length], STATS_TEST_MEMBER_BYTES - member_length, "]}");
+            if(NULL == strstr(json_buffer, json_member))
+            {
+                test2_result = TEST_FAILED;
+            }
+        }
+        fclose(json_file);
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nstats_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nstats_test() test failed.");
+    }
+}
+
+static void parallel_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    static int model_array[PARALLEL_TEST_NODES];
+    const size_t model_counts[] = {PARALLEL_TEST_NODES, LINKEDLIST_PARALLEL_PART_MIN - 1u, 1u};
+    linkedlist_thread_pool_t my_pool;
+    linkedlist_thread_pool_t* pool_ptr = NULL;
+    linkedlist_t my_list;
+    int task_array[PARALLEL_TEST_TASKS];
+    size_t model_count = 0;
+    size_t count_index = 0;
+    size_t pass_index = 0;
+    size_t index = 0;
+    size_t match_count = 0;
+    size_t node_index = 0;
+    long long model_sum = 0;
+    long long data_sum = 0;
+    int model_min = 0;
+    int model_max = 0;
+    int data_min = 0;
+    int data_max = 0;
+    int divisor = 3;
+    int target = 0;
+
+    /** Test1: sums, minimums, maximums, counts and first matches of lists cut into many parts, into one part, and
+        of single nodes equal the ones of the model, with the pool threads and with the calling thread alone **/
+    srand(MODEL_TEST_SEED);
+    linkedlist_handle_init(&my_list);
+    if(LINKEDLIST_OP_SUCCESS != linkedlist_thread_pool_init(&my_pool, LOCK_TEST_THREADS))
+    {
+        test1_result = TEST_FAILED;
+    }
+    for(count_index = 0; (count_index < (sizeof(model_counts) / sizeof(model_counts[0]))) &&
+        (TEST_PASSED == test1_result); count_index++)
+    {
+        model_count = model_counts[count_index];
+        model_sum = 0;
+        match_count = 0;
+        for(index = 0; index < model_count; index++)
+        {
+            model_array[index] = (rand() % (2 * MODEL_TEST_VALUE_RANGE)) - MODEL_TEST_VALUE_RANGE;
+            model_sum = model_sum + model_array[index];
+            model_min = ((0u == index) || (model_array[index] < model_min)) ? model_array[index] : model_min;
+            model_max = ((0u == index) || (model_array[index] > model_max)) ? model_array[index] : model_max;
+            match_count = (0 == (model_array[index] % divisor)) ? (match_count + 1u) : match_count;
+        }
+
+        /** The searched data is first found in the last part of the list **/
+        target = model_array[model_count - 1u];
+        node_index = 0;
+        while(target != model_array[node_index])
+        {
+            node_index = node_index + 1u;
+        }
+
+        if(LINKEDLIST_OP_SUCCESS != linkedlist_append_array(&my_list, model_array, model_count))
+        {
+            test1_result = TEST_FAILED;
+        }
+        for(pass_index = 0; (pass_index < 2u) && (TEST_PASSED == test1_result); pass_index++)
+        {
+            pool_ptr = (0u == pass_index) ? &my_pool : NULL;
+            if((LINKEDLIST_OP_SUCCESS != linkedlist_parallel_sum(pool_ptr, &my_list, &data_sum)) ||
+               (model_sum != data_sum) ||
+               (LINKEDLIST_OP_SUCCESS != linkedlist_parallel_min(pool_ptr, &my_list, &data_min)) ||
+               (model_min != data_min) ||
+               (LINKEDLIST_OP_SUCCESS != linkedlist_parallel_max(pool_ptr, &my_list, &data_max)) ||
+               (model_max != data_max) ||
+               (LINKEDLIST_OP_SUCCESS != linkedlist_parallel_count_if(pool_ptr, &my_list, parallel_test_divisible,
+                                                                      &divisor, &index)) ||
+               (match_count != index) ||
+               (LINKEDLIST_OP_SUCCESS != linkedlist_parallel_find_first(pool_ptr, &my_list, parallel_test_equal,
+                                                                        &target, &index)) ||
+               (node_index != index))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+        linkedlist_handle_delete_all(&my_list);
+    }
+
+
+    /** Test2: every task of a batch is run once. Empty lists have a sum and a count of 0 but no minimum, maximum or
+        match, and invalid pools, lists, functions and thread counts fail. **/
+    memset(task_array, 0, sizeof(task_array));
+    target = MODEL_TEST_VALUE_RANGE;
+    if((LINKEDLIST_OP_SUCCESS == linkedlist_thread_pool_run(&my_pool, parallel_test_task, task_array,
+                                                             PARALLEL_TEST_TASKS)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_thread_pool_run(&my_pool, NULL, task_array, PARALLEL_TEST_TASKS)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_parallel_sum(&my_pool, &my_list, &data_sum)) && (0 == data_sum) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_parallel_count_if(&my_pool, &my_list, parallel_test_divisible, &divisor,
+                                                              &index)) && (0u == index) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_parallel_min(&my_pool, &my_list, &data_min)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_parallel_max(&my_pool, &my_list, &data_max)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_parallel_find_first(&my_pool, &my_list, parallel_test_equal, &target,
+                                                             &index)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_append_array(&my_list, model_array, model_count)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_parallel_find_first(&my_pool, &my_list, parallel_test_equal, &target,
+                                                             &index)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_parallel_count_if(&my_pool, &my_list, NULL, &divisor, &index)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_parallel_sum(&my_pool, NULL, &data_sum)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_parallel_sum(&my_pool, &my_list, NULL)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_thread_pool_destroy(&my_pool)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_thread_pool_init(&my_pool, 0)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_thread_pool_init(&my_pool, LINKEDLIST_PARALLEL_MAX_THREADS + 1u)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    for(index = 0; index < PARALLEL_TEST_TASKS; index++)
+    {
+        if((int)(index + 1u) != task_array[index])
+        {
+            test2_result = TEST_FAILED;
+        }
+    }
+    linkedlist_handle_delete_all(&my_list);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nparallel_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nparallel_test() test failed.");
+    }
+}
+
+static void search_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    linkedlist_t my_list;
+    unrolled_list_t my_unrolled_list;
+    int model_array[MODEL_TEST_ELEMENTS];
+    size_t model_count = 0;
+    size_t model_index = 0;
+    size_t match_count = 0;
+    size_t index = 0;
+    size_t count = 0;
+    size_t loop_cntr = 0;
+    int data = 0;
+
+    /** Test1: random inserts and deletes leave nodes of every fill, the first index, the count and the presence of
+        values found in the list and of values it never holds equal the ones of the model **/
+    srand(MODEL_TEST_SEED);
+    linkedlist_handle_init(&my_list);
+    unrolled_list_init(&my_unrolled_list);
+    for(loop_cntr = 0; (loop_cntr < MODEL_TEST_OPERATIONS) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        if((0u == model_count) || ((model_count < MODEL_TEST_ELEMENTS) && (0 != (rand() % 3))))
+        {
+            index = (size_t)rand() % (model_count + 1u);
+            data = rand() % MODEL_TEST_VALUE_RANGE;
+            model_insert(model_array, &model_count, index, data);
+            if((LINKEDLIST_OP_SUCCESS != linkedlist_handle_insert_index(&my_list, index, data)) ||
+               (LINKEDLIST_OP_SUCCESS != unrolled_list_insert_index(&my_unrolled_list, index, data)))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+        else
+        {
+            index = (size_t)rand() % model_count;
+            model_delete(model_array, &model_count, index);
+            if((LINKEDLIST_OP_SUCCESS != linkedlist_handle_delete_index(&my_list, index)) ||
+               (LINKEDLIST_OP_SUCCESS != unrolled_list_delete_index(&my_unrolled_list, index)))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+
+        /** Some of the searched values are above the range of the inserted ones **/
+        data = rand() % (MODEL_TEST_VALUE_RANGE + 5);
+        model_index = model_count;
+        match_count = 0;
+        for(index = 0; index < model_count; index++)
+        {
+            model_index = ((model_count == model_index) && (data == model_array[index])) ? index : model_index;
+            match_count = (data == model_array[index]) ? (match_count + 1u) : match_count;
+        }
+
+        if((LINKEDLIST_OP_SUCCESS != linkedlist_count_of(&my_list, data, &count)) || (match_count != count) ||
+           (LINKEDLIST_OP_SUCCESS != unrolled_list_count_of(&my_unrolled_list, data, &count)) ||
+           (match_count != count))
+        {
+            test1_result = TEST_FAILED;
+        }
+        if(model_count == model_index)
+        {
+            if((LINKEDLIST_OP_FAIL != linkedlist_index_of(&my_list, data, &index)) ||
+               (LINKEDLIST_OP_FAIL != linkedlist_contains(&my_list, data)) ||
+               (LINKEDLIST_OP_FAIL != unrolled_list_index_of(&my_unrolled_list, data, &index)) ||
+               (LINKEDLIST_OP_FAIL != unrolled_list_contains(&my_unrolled_list, data)))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+        else if((LINKEDLIST_OP_SUCCESS != linkedlist_index_of(&my_list, data, &index)) || (model_index != index) ||
+                (LINKEDLIST_OP_SUCCESS != linkedlist_contains(&my_list, data)) ||
+                (LINKEDLIST_OP_SUCCESS != unrolled_list_index_of(&my_unrolled_list, data, &index)) ||
+                (model_index != index) || (LINKEDLIST_OP_SUCCESS != unrolled_list_contains(&my_unrolled_list, data)))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+    linkedlist_handle_delete_all(&my_list);
+    unrolled_list_delete_all(&my_unrolled_list);
+
+
+    /** Test2: empty lists hold no value, and NULL lists and pointers fail **/
+    if((LINKEDLIST_OP_SUCCESS == linkedlist_count_of(&my_list, 0, &count)) && (0u == count) &&
+       (LINKEDLIST_OP_SUCCESS == unrolled_list_count_of(&my_unrolled_list, 0, &count)) && (0u == count) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_index_of(&my_list, 0, &index)) &&
+       (LINKEDLIST_OP_FAIL == unrolled_list_index_of(&my_unrolled_list, 0, &index)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_contains(&my_list, 0)) &&
+       (LINKEDLIST_OP_FAIL == unrolled_list_contains(&my_unrolled_list, 0)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_count_of(NULL, 0, &count)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_count_of(&my_list, 0, NULL)) &&
+       (LINKEDLIST_OP_FAIL == unrolled_list_count_of(&my_unrolled_list, 0, NULL)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_index_of(&my_list, 0, NULL)) &&
+       (LINKEDLIST_OP_FAIL == unrolled_list_index_of(NULL, 0, &index)))
+    {
+        test2_result = TEST_PASSED;
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nsearch_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nsearch_test() test failed.");
+    }
+}
+
+static void persistent_list_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    test_result_t test3_result = TEST_PASSED;
+    static int model_array[MODEL_TEST_ELEMENTS];
+    static int snapshot_models[MODEL_TEST_RANGE][MODEL_TEST_ELEMENTS];
+    static int data_array[MODEL_TEST_ELEMENTS];
+    persistent_snapshot_t my_snapshots[MODEL_TEST_RANGE];
+    size_t snapshot_counts[MODEL_TEST_RANGE];
+    persistent_snapshot_t my_snapshot;
+    pthread_t thread_ids[LOCK_TEST_THREADS];
+    list_thread_arg_t thread_args[LOCK_TEST_THREADS];
+    size_t model_count = 0;
+    size_t slot_index = 0;
+    size_t index = 0;
+    size_t loop_cntr = 0;
+    int data = 0;
+
+    /** Test1: random appends, changes and deletes at the end make new versions, while snapshots of older versions
+        keep reading what the list held when they were taken **/
+    srand(MODEL_TEST_SEED);
+    persistent_list_init(&my_persistent_list);
+    for(slot_index = 0; slot_index < MODEL_TEST_RANGE; slot_index++)
+    {
+        persistent_list_snapshot(&my_persistent_list, &my_snapshots[slot_index]);
+        snapshot_counts[slot_index] = 0;
+    }
+    for(loop_cntr = 0; (loop_cntr < MODEL_TEST_OPERATIONS) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        data = rand() % MODEL_TEST_VALUE_RANGE;
+        if((0u == model_count) || ((model_count < MODEL_TEST_ELEMENTS) && (0 == (rand() % 3))))
+        {
+            model_array[model_count] = data;
+            model_count = model_count + 1u;
+            test1_result = (LINKEDLIST_OP_SUCCESS == persistent_list_insert_end(&my_persistent_list, data)) ?
+                           TEST_PASSED : TEST_FAILED;
+        }
+        else if(0 == (rand() % 2))
+        {
+            index = (size_t)rand() % model_count;
+            model_array[index] = data;
+            test1_result = (LINKEDLIST_OP_SUCCESS == persistent_list_set_index(&my_persistent_list, index, data)) ?
+                           TEST_PASSED : TEST_FAILED;
+        }
+        else
+        {
+            model_count = model_count - 1u;
+            test1_result = (LINKEDLIST_OP_SUCCESS == persistent_list_delete_end(&my_persistent_list)) ?
+                           TEST_PASSED : TEST_FAILED;
+        }
+
+        /** Replace a random snapshot with one of the new version, then read it and an older one in full **/
+        slot_index = (size_t)rand() % MODEL_TEST_RANGE;
+        persistent_snapshot_release(&my_snapshots[slot_index]);
+        persistent_list_snapshot(&my_persistent_list, &my_snapshots[slot_index]);
+        memcpy(snapshot_models[slot_index], model_array, model_count * sizeof(int));
+        snapshot_counts[slot_index] = model_count;
+        for(index = 0; index < 2u; index++)
+        {
+            slot_index = (0u == index) ? slot_index : ((size_t)rand() % MODEL_TEST_RANGE);
+            if((snapshot_counts[slot_index] != persistent_snapshot_size(&my_snapshots[slot_index])) ||
+               (LINKEDLIST_OP_SUCCESS != persistent_snapshot_to_array(&my_snapshots[slot_index], data_array)) ||
+               (0 != memcmp(snapshot_models[slot_index], data_array, snapshot_counts[slot_index] * sizeof(int))))
+            {
+                test1_result = TEST_FAILED;
+            }
+            if((0u != snapshot_counts[slot_index]) &&
+               ((LINKEDLIST_OP_SUCCESS != persistent_snapshot_get_end(&my_snapshots[slot_index], &data)) ||
+                (snapshot_models[slot_index][snapshot_counts[slot_index] - 1u] != data) ||
+                (LINKEDLIST_OP_SUCCESS != persistent_snapshot_get_index(&my_snapshots[slot_index],
+                                                                        loop_cntr % snapshot_counts[slot_index],
+                                                                        &data)) ||
+                (snapshot_models[slot_index][loop_cntr % snapshot_counts[slot_index]] != data)))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+    }
+
+    /** Snapshots stay readable after the list is destroyed, until they are released **/
+    persistent_list_destroy(&my_persistent_list);
+    for(slot_index = 0; slot_index < MODEL_TEST_RANGE; slot_index++)
+    {
+        if((LINKEDLIST_OP_SUCCESS != persistent_snapshot_to_array(&my_snapshots[slot_index], data_array)) ||
+           (0 != memcmp(snapshot_models[slot_index], data_array, snapshot_counts[slot_index] * sizeof(int))))
+        {
+            test1_result = TEST_FAILED;
+        }
+        persistent_snapshot_release(&my_snapshots[slot_index]);
+    }
+
+
+    /** Test2: empty versions have no element, and out of range indexes and NULL arguments fail **/
+    persistent_list_init(&my_persistent_list);
+    if((LINKEDLIST_OP_SUCCESS == persistent_list_snapshot(&my_persistent_list, &my_snapshot)) &&
+       (0u == persistent_snapshot_size(&my_snapshot)) &&
+       (LINKEDLIST_OP_FAIL == persistent_snapshot_get_end(&my_snapshot, &data)) &&
+       (LINKEDLIST_OP_FAIL == persistent_snapshot_get_index(&my_snapshot, 0, &data)) &&
+       (LINKEDLIST_OP_FAIL == persistent_list_delete_end(&my_persistent_list)) &&
+       (LINKEDLIST_OP_FAIL == persistent_list_set_index(&my_persistent_list, 0, 1)) &&
+       (LINKEDLIST_OP_SUCCESS == persistent_list_insert_end(&my_persistent_list, 1)) &&
+       (LINKEDLIST_OP_FAIL == persistent_list_set_index(&my_persistent_list, 1, 2)) &&
+       (LINKEDLIST_OP_SUCCESS == persistent_snapshot_release(&my_snapshot)) &&
+       (LINKEDLIST_OP_SUCCESS == persistent_list_snapshot(&my_persistent_list, &my_snapshot)) &&
+       (1u == persistent_snapshot_size(&my_snapshot)) &&
+       (LINKEDLIST_OP_FAIL == persistent_snapshot_get_index(&my_snapshot, 1, &data)) &&
+       (LINKEDLIST_OP_SUCCESS == persistent_list_delete_end(&my_persistent_list)) &&
+       (LINKEDLIST_OP_SUCCESS == persistent_snapshot_get_end(&my_snapshot, &data)) && (1 == data) &&
+       (LINKEDLIST_OP_SUCCESS == persistent_snapshot_release(&my_snapshot)) &&
+       (LINKEDLIST_OP_FAIL == persistent_list_delete_all(NULL)) &&
+       (LINKEDLIST_OP_FAIL == persistent_list_snapshot(&my_persistent_list, NULL)) &&
+       (LINKEDLIST_OP_FAIL == persistent_snapshot_release(NULL)) &&
+       (LINKEDLIST_OP_FAIL == persistent_snapshot_to_array(&my_snapshot, NULL)))
+    {
+        test2_result = TEST_PASSED;
+    }
+
+
+    /** Test3: readers taking snapshots while the list is appended to always see a version holding the appended
+        values in order, and never one older than the version they saw before. Values are also set to what they
+        already hold, so the readers run into the grace periods of the writer. **/
+    for(loop_cntr = 0; loop_cntr < LOCK_TEST_THREADS; loop_cntr++)
+    {
+        thread_args[loop_cntr].thread_index = (int)loop_cntr;
+        if(0 != pthread_create(&thread_ids[loop_cntr], NULL, persistent_test_thread, &thread_args[loop_cntr]))
+        {
+            test3_result = TEST_FAILED;
+        }
+    }
+    for(data = 0; data < MODEL_TEST_ELEMENTS; data++)
+    {
+        if((LINKEDLIST_OP_SUCCESS != persistent_list_insert_end(&my_persistent_list, data)) ||
+           (LINKEDLIST_OP_SUCCESS != persistent_list_set_index(&my_persistent_list, (size_t)data / 2u, data / 2)))
+        {
+            test3_result = TEST_FAILED;
+        }
+    }
+    for(loop_cntr = 0; loop_cntr < LOCK_TEST_THREADS; loop_cntr++)
+    {
+        if((0 != pthread_join(thread_ids[loop_cntr], NULL)) || (TEST_PASSED != thread_args[loop_cntr].thread_result))
+        {
+            test3_result = TEST_FAILED;
+        }
+    }
+    persistent_list_destroy(&my_persistent_list);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result) && (TEST_PASSED == test3_result))
+    {
+        fprintf(fptr, "\npersistent_list_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\npersistent_list_test() test failed.");
+    }
+}
+
+static void splice_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    static int model_arrays[2][MODEL_TEST_ELEMENTS];
+    size_t model_counts[2] = {MODEL_TEST_ELEMENTS, 0};
+    linkedlist_t my_lists[2];
+    linkedlist_t my_tail_list;
+    linkedlist_t my_pool_list;
+    linkedlist_pool_t my_pool;
+    linkedlist_cursor_t my_cursor;
+    linkedlist_cursor_t my_source_cursor;
+    struct node_t head_node = {0, NULL};
+    size_t list_index = 0;
+    size_t source_list = 0;
+    size_t index = 0;
+    size_t source_index = 0;
+    size_t node_count = 0;
+    size_t loop_cntr = 0;
+    int operation = 0;
+    int data = 0;
+
+    /** Test1: random concatenations, splits, splices at indexes and at cursors, and reversals move the nodes
+        between two lists like the moves of elements between two models **/
+    srand(MODEL_TEST_SEED);
+    linkedlist_handle_init(&my_lists[0]);
+    linkedlist_handle_init(&my_lists[1]);
+    linkedlist_handle_init(&my_tail_list);
+    for(index = 0; index < MODEL_TEST_ELEMENTS; index++)
+    {
+        model_arrays[0][index] = (int)index;
+    }
+    linkedlist_append_array(&my_lists[0], model_arrays[0], model_counts[0]);
+    for(loop_cntr = 0; (loop_cntr < MODEL_TEST_OPERATIONS) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        list_index = (size_t)rand() % 2u;
+        source_list = 1u - list_index;
+        index = (size_t)rand() % (model_counts[list_index] + 1u);
+        source_index = (size_t)rand() % (model_counts[source_list] + 1u);
+        node_count = (size_t)rand() % (model_counts[source_list] - source_index + 1u);
+        operation = rand() % 5;
+        if(0 == operation)
+        {
+            model_splice(model_arrays[list_index], &model_counts[list_index], model_counts[list_index],
+                         model_arrays[source_list], &model_counts[source_list], 0, model_counts[source_list]);
+            test1_result = (LINKEDLIST_OP_SUCCESS == linkedlist_concat(&my_lists[list_index],
+                                                                       &my_lists[source_list])) ? TEST_PASSED :
+                                                                                                  TEST_FAILED;
+        }
+        else if(1 == operation)
+        {
+            /** The split off nodes are appended to the other list, so both lists keep all the elements **/
+            model_splice(model_arrays[list_index], &model_counts[list_index], model_counts[list_index],
+                         model_arrays[source_list], &model_counts[source_list], source_index,
+                         model_counts[source_list] - source_index);
+            if((LINKEDLIST_OP_SUCCESS != linkedlist_split(&my_lists[source_list], source_index, &my_tail_list)) ||
+               (LINKEDLIST_OP_SUCCESS != linkedlist_concat(&my_lists[list_index], &my_tail_list)) ||
+               (0u != my_tail_list.node_count))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+        else if(2 == operation)
+        {
+            model_splice(model_arrays[list_index], &model_counts[list_index], index, model_arrays[source_list],
+                         &model_counts[source_list], source_index, node_count);
+            test1_result = (LINKEDLIST_OP_SUCCESS == linkedlist_splice(&my_lists[list_index], index,
+                                                                       &my_lists[source_list], source_index,
+                                                                       node_count)) ? TEST_PASSED : TEST_FAILED;
+        }
+        else if(3 == operation)
+        {
+            for(index = 0; index < (model_counts[list_index] / 2u); index++)
+            {
+                data = model_arrays[list_index][index];
+                model_arrays[list_index][index] = model_arrays[list_index][model_counts[list_index] - index - 1u];
+                model_arrays[list_index][model_counts[list_index] - index - 1u] = data;
+            }
+            test1_result = (LINKEDLIST_OP_SUCCESS == linkedlist_reverse(&my_lists[list_index])) ? TEST_PASSED :
+                                                                                                 TEST_FAILED;
+        }
+        else
+        {
+            /** Both cursors stay valid: the cursor moves with its node past the range, the source cursor is at the
+                node after the range, at the same index **/
+            linkedlist_cursor_init(&my_cursor, &my_lists[list_index]);
+            linkedlist_cursor_init(&my_source_cursor, &my_lists[source_list]);
+            while(my_cursor.node_index < index)
+            {
+                linkedlist_cursor_next(&my_cursor);
+            }
+            while(my_source_cursor.node_index < source_index)
+            {
+                linkedlist_cursor_next(&my_source_cursor);
+            }
+            model_splice(model_arrays[list_index], &model_counts[list_index], index, model_arrays[source_list],
+                         &model_counts[source_list], source_index, node_count);
+            if((LINKEDLIST_OP_SUCCESS != linkedlist_splice_cursor(&my_cursor, &my_source_cursor, node_count)) ||
+               ((index + node_count) != my_cursor.node_index) || (source_index != my_source_cursor.node_index) ||
+               (((index + node_count) < model_counts[list_index]) &&
+                ((LINKEDLIST_OP_SUCCESS != linkedlist_cursor_peek(&my_cursor, &data)) ||
+                 (model_arrays[list_index][index + node_count] != data))) ||
+               ((0u != (index + node_count)) &&
+                (model_arrays[list_index][index + node_count - 1u] != my_cursor.node_previous_ptr->data)) ||
+               ((source_index < model_counts[source_list]) &&
+                ((LINKEDLIST_OP_SUCCESS != linkedlist_cursor_peek(&my_source_cursor, &data)) ||
+                 (model_arrays[source_list][source_index] != data))) ||
+               ((source_index == model_counts[source_list]) && (NULL != my_source_cursor.node_current_ptr)))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+
+        if((TEST_FAILED == list_model_check(&my_lists[0], model_arrays[0], model_counts[0])) ||
+           (TEST_FAILED == list_model_check(&my_lists[1], model_arrays[1], model_counts[1])))
+        {
+            test1_result = TEST_FAILED;
+        }
+    }
+    linkedlist_handle_delete_all(&my_lists[0]);
+    linkedlist_handle_delete_all(&my_lists[1]);
+
+
+    /** Test2: empty and single node lists are reversed and moved as they are, and invalid indexes, counts, lists
+        moved into themselves, lists of another node pool and cursors of head node based lists fail **/
+    linkedlist_pool_init(&my_pool, POOL_TEST_SLAB_NODES);
+    linkedlist_handle_init(&my_pool_list);
+    linkedlist_handle_pool_set(&my_pool_list, &my_pool);
+    linkedlist_handle_insert_end(&my_pool_list, 1);
+    linkedlist_handle_insert_end(&my_lists[1], 7);
+    model_arrays[1][0] = 7;
+    linkedlist_cursor_init(&my_cursor, &my_lists[0]);
+    linkedlist_cursor_init(&my_source_cursor, &my_pool_list);
+    if((LINKEDLIST_OP_SUCCESS == linkedlist_reverse(&my_lists[0])) &&
+       (TEST_PASSED == list_model_check(&my_lists[0], model_arrays[0], 0)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_reverse(&my_lists[1])) &&
+       (TEST_PASSED == list_model_check(&my_lists[1], model_arrays[1], 1)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_concat(&my_lists[1], &my_lists[0])) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_splice(&my_lists[0], 0, &my_lists[1], 1, 0)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_concat(&my_lists[1], &my_lists[1])) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_splice(&my_lists[0], 1, &my_lists[1], 0, 1)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_splice(&my_lists[0], 0, &my_lists[1], 2, 0)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_splice(&my_lists[0], 0, &my_lists[1], 0, 2)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_split(&my_lists[1], 2, &my_lists[0])) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_split(&my_lists[0], 0, &my_lists[1])) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_concat(&my_lists[0], &my_pool_list)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_splice_cursor(&my_cursor, &my_source_cursor, 1)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_init(&my_source_cursor, &my_lists[1])) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_splice_cursor(&my_cursor, &my_source_cursor, 2)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_splice_cursor(&my_source_cursor, &my_source_cursor, 0)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_splice_cursor(NULL, &my_source_cursor, 0)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_init_chain(&my_cursor, &head_node)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_splice_cursor(&my_cursor, &my_source_cursor, 1)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_cursor_init(&my_cursor, &my_lists[0])) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_splice_cursor(&my_cursor, &my_source_cursor, 0)) &&
+       (TEST_PASSED == list_model_check(&my_lists[1], model_arrays[1], 1)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_splice_cursor(&my_cursor, &my_source_cursor, 1)) &&
+       (TEST_PASSED == list_model_check(&my_lists[0], model_arrays[1], 1)) &&
+       (TEST_PASSED == list_model_check(&my_lists[1], model_arrays[1], 0)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_splice_cursor(&my_cursor, &my_source_cursor, 1)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    linkedlist_handle_delete_all(&my_lists[0]);
+    linkedlist_handle_delete_all(&my_lists[1]);
+    linkedlist_handle_delete_all(&my_pool_list);
+    linkedlist_pool_destroy(&my_pool);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\nsplice_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\nsplice_test() test failed.");
+    }
+}
+
+static void array_export_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    static visit_context_t visit_context;
+    static int model_array[MODEL_TEST_ELEMENTS];
+    static int data_array[MODEL_TEST_ELEMENTS];
+    int chunk_buffer[MODEL_TEST_RANGE];
+    linkedlist_t my_lists[2];
+    linkedlist_pool_t my_pool;
+    linkedlist_traversal_t traversal_mode = LINKEDLIST_TRAVERSAL_PLAIN;
+    size_t model_count = 0;
+    size_t chunk_size = 0;
+    size_t list_index = 0;
+    size_t index = 0;
+    size_t loop_cntr = 0;
+
+    /** Test1: a list taking its nodes from malloc() and one taking them from a pool are loaded from arrays that are
+        longer, shorter or as long as they are, in every traversal mode. Both lists hold the loaded array, and are
+        copied back whole and in chunks of every size. **/
+    srand(MODEL_TEST_SEED);
+    linkedlist_pool_init(&my_pool, POOL_TEST_SLAB_NODES);
+    linkedlist_handle_init(&my_lists[0]);
+    linkedlist_handle_init(&my_lists[1]);
+    linkedlist_handle_pool_set(&my_lists[1], &my_pool);
+    for(loop_cntr = 0; (loop_cntr < (MODEL_TEST_OPERATIONS / 8u)) && (TEST_PASSED == test1_result); loop_cntr++)
+    {
+        model_count = (0u == (loop_cntr % 4u)) ? model_count : ((size_t)rand() % (MODEL_TEST_ELEMENTS + 1u));
+        for(index = 0; index < model_count; index++)
+        {
+            model_array[index] = rand() % MODEL_TEST_VALUE_RANGE;
+        }
+        traversal_mode = (linkedlist_traversal_t)(rand() % 3);
+        chunk_size = 1u + ((size_t)rand() % MODEL_TEST_RANGE);
+
+        for(list_index = 0; list_index < 2u; list_index++)
+        {
+            visit_context.data_count = 0;
+            visit_context.call_count = 0;
+            visit_context.call_limit = 0;
+            if((LINKEDLIST_OP_SUCCESS != linkedlist_traversal_set(&my_lists[list_index], traversal_mode)) ||
+               (LINKEDLIST_OP_SUCCESS != linkedlist_from_array(&my_lists[list_index], model_array, model_count)) ||
+               (TEST_FAILED == list_model_check(&my_lists[list_index], model_array, model_count)) ||
+               (LINKEDLIST_OP_SUCCESS != linkedlist_to_array(&my_lists[list_index], data_array)) ||
+               (0 != memcmp(model_array, data_array, model_count * sizeof(int))) ||
+               (LINKEDLIST_OP_SUCCESS != linkedlist_to_chunks(&my_lists[list_index], chunk_buffer, chunk_size,
+                                                              export_test_chunk, &visit_context)) ||
+               (model_count != visit_context.data_count) ||
+               (((model_count + chunk_size - 1u) / chunk_size) != visit_context.call_count) ||
+               (0 != memcmp(model_array, visit_context.data_array, model_count * sizeof(int))))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+    }
+
+
+    /** Test2: the walk ends at the first chunk the function fails on, empty lists are copied without any array or
+        call, invalid arguments fail, and a list taking its nodes from a pool without enough memory stays as it was **/
+    visit_context.data_count = 0;
+    visit_context.call_count = 0;
+    visit_context.call_limit = 2;
+    if((LINKEDLIST_OP_SUCCESS == linkedlist_from_array(&my_lists[1], model_array, MODEL_TEST_RANGE)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_to_chunks(&my_lists[1], chunk_buffer, 1, export_test_chunk,
+                                                   &visit_context)) &&
+       (2u == visit_context.call_count) && (2u == visit_context.data_count) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_from_array(&my_lists[1], model_array, SIZE_MAX / 2u)) &&
+       (TEST_PASSED == list_model_check(&my_lists[1], model_array, MODEL_TEST_RANGE)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_from_array(&my_lists[1], NULL, 1)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_to_array(&my_lists[1], NULL)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_to_chunks(&my_lists[1], chunk_buffer, 0, export_test_chunk,
+                                                   &visit_context)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_to_chunks(&my_lists[1], NULL, 1, export_test_chunk, &visit_context)) &&
+       (LINKEDLIST_OP_FAIL == linkedlist_to_chunks(&my_lists[1], chunk_buffer, 1, NULL, &visit_context)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_from_array(&my_lists[1], NULL, 0)) &&
+       (TEST_PASSED == list_model_check(&my_lists[1], model_array, 0)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_to_array(&my_lists[1], NULL)) &&
+       (LINKEDLIST_OP_SUCCESS == linkedlist_to_chunks(&my_lists[1], chunk_buffer, 1, export_test_chunk,
+                                                      &visit_context)) &&
+       (2u == visit_context.call_count) && (LINKEDLIST_OP_FAIL == linkedlist_from_array(NULL, model_array, 1)))
+    {
+        test2_result = TEST_PASSED;
+    }
+    linkedlist_handle_delete_all(&my_lists[0]);
+    linkedlist_handle_delete_all(&my_lists[1]);
+    linkedlist_pool_destroy(&my_pool);
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\narray_export_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\narray_export_test() test failed.");
+    }
+}
+
+static void array_destroy_test(void)
+{
+    test_result_t test1_result = TEST_PASSED;
+    test_result_t test2_result = TEST_FAILED;
+    static custarr_t my_local_array;
+    int backing = 0;
+    int loop_cntr = 0;
+    int data = 0;
+
+    /** Test1: arrays of every backing, with one and with several elements, are destroyed once, and can be
+        initialized again afterwards **/
+    for(backing = CUSTARR_BACKING_LINKEDLIST; backing <= CUSTARR_BACKING_BUFFER; backing++)
+    {
+        for(loop_cntr = 0; loop_cntr < 2; loop_cntr++)
+        {
+            if(CUSTARR_OP_SUCCESS != initArray_backing(&my_local_array, 5 * CUSTARR_BUFFER_MIN_SLOTS,
+                                                       (custarr_backing_t)backing))
+            {
+                test1_result = TEST_FAILED;
+            }
+            for(data = 0; data < (loop_cntr * 3 * (int)CUSTARR_BUFFER_MIN_SLOTS); data++)
+            {
+                insertElement_atEnd(&my_local_array, data);
+            }
+            if((CUSTARR_OP_SUCCESS != array_destroy(&my_local_array)) ||
+               (CUSTARR_OP_FAIL != array_destroy(&my_local_array)) ||
+               (CUSTARR_OP_FAIL != freeArray(&my_local_array)))
+            {
+                test1_result = TEST_FAILED;
+            }
+        }
+    }
+
+
+    /** Test2: the arrays used by the other tests are destroyed **/
+    if((CUSTARR_OP_SUCCESS == array_destroy(&my_array)) && (CUSTARR_OP_SUCCESS == array_destroy(&my_dlist_array)) &&
+       (CUSTARR_OP_SUCCESS == array_destroy(&my_buffer_array)) &&
+       (CUSTARR_OP_SUCCESS == array_destroy(&my_shared_array)))
+    {
+        test2_result = TEST_PASSED;
+    }
+
+    /** Print test results **/
+    if((TEST_PASSED == test1_result) && (TEST_PASSED == test2_result))
+    {
+        fprintf(fptr, "\narray_destroy_test() test passed.");
+    }
+    else
+    {
+        fprintf(fptr, "\narray_destroy_test() test failed.");
+    }
+}
+
+/** Inserts data at index of the model, shifting the elements after it **/
+static void model_insert(int* model_array, size_t* model_count, size_t index, int data)
+{
+    memmove(&model_array[index + 1u], &model_array[index], (*model_count - index) * sizeof(int));
+    model_array[index] = data;
+    *model_count = *model_count + 1u;
+}
+
+/** Deletes the element at index of the model, shifting the elements after it **/
+static void model_delete(int* model_array, size_t* model_count, size_t index)
+{
+    memmove(&model_array[index], &model_array[index + 1u], (*model_count - index - 1u) * sizeof(int));
+    *model_count = *model_count - 1u;
+}
+
+/** Moves node_count elements of the source model starting at source_index to index of the model **/
+static void model_splice(int* model_array, size_t* model_count, size_t index, int* source_array, size_t* source_count,
+                         size_t source_index, size_t node_count)
+{
+    memmove(&model_array[index + node_count], &model_array[index], (*model_count - index) * sizeof(int));
+    memcpy(&model_array[index], &source_array[source_index], node_count * sizeof(int));
+    memmove(&source_array[source_index], &source_array[source_index + node_count],
+            (*source_count - source_index - node_count) * sizeof(int));
+    *model_count = *model_count + node_count;
+    *source_count = *source_count - node_count;
+}
+
+/** Checks that the list holds exactly the model both forward and backward, and that every node links back to the
+    node before it **/
+static test_result_t dlist_model_check(dlinkedlist_t* list, const int* model_array, size_t model_count)
+{
+    test_result_t ret_val = TEST_PASSED;
+    struct dnode_t* node_current = list->sentinel_node.next_node_address_ptr;
+    size_t loop_cntr = 0;
+
+    while((&list->sentinel_node != node_current) && (loop_cntr < model_count))
+    {
+        if((model_array[loop_cntr] != node_current->data) ||
+           (node_current != node_current->next_node_address_ptr->prev_node_address_ptr))
+        {
+            ret_val = TEST_FAILED;
+        }
+        node_current = node_current->next_node_address_ptr;
+        loop_cntr = loop_cntr + 1u;
+    }
+    if((&list->sentinel_node != node_current) || (model_count != loop_cntr) ||
+       (&list->sentinel_node != list->sentinel_node.next_node_address_ptr->prev_node_address_ptr) ||
+       (model_count != dlinkedlist_size(list)))
+    {
+        ret_val = TEST_FAILED;
+    }
+
+    node_current = list->sentinel_node.prev_node_address_ptr;
+    while((&list->sentinel_node != node_current) && (0u != loop_cntr))
+    {
+        loop_cntr = loop_cntr - 1u;
+        if(model_array[loop_cntr] != node_current->data)
+        {
+            ret_val = TEST_FAILED;
+        }
+        node_current = node_current->prev_node_address_ptr;
+    }
+    if((&list->sentinel_node != node_current) || (0u != loop_cntr))
+    {
+        ret_val = TEST_FAILED;
+    }
+
+    return ret_val;
+}
+
+/** Checks that the generated list holds the points of exactly the model ids, and that its node count and last node
+    agree with its nodes **/
+static test_result_t generic_model_check(test_pointlist_t* list, const int* model_array, size_t model_count)
+{
+    test_result_t ret_val = TEST_PASSED;
+    struct test_pointlist_node_t* node_current = list->head_node_ptr;
+    struct test_pointlist_node_t* node_last = NULL;
+    size_t loop_cntr = 0;
+
+    while(NULL != node_current)
+    {
+        if((model_count <= loop_cntr) ||
+           (TEST_PASSED != generic_test_point_check(&node_current->data, model_array[loop_cntr])))
+        {
+            ret_val = TEST_FAILED;
+        }
+        node_last = node_current;
+        node_current = node_current->next_node_address_ptr;
+        loop_cntr = loop_cntr + 1u;
+    }
+
+    if((model_count != loop_cntr) || (model_count != test_pointlist_size(list)) || (node_last != list->tail_node_ptr))
+    {
+        ret_val = TEST_FAILED;
+    }
+
+    return ret_val;
+}
+
+/** Returns the point the generic list test stores for an id, every field derived from the id **/
+static test_point_t generic_test_point(int point_id)
+{
+    test_point_t point;
+
+    memset(&point, 0, sizeof(point));
+    point.point_id = point_id;
+    point.point_weight = (double)point_id * 0.5;
+    snprintf(point.point_tag, sizeof(point.point_tag), "p%d", point_id % 100000);
+
+    return point;
+}
+
+/** Checks every field of a point against the point of an id **/
+static test_result_t generic_test_point_check(const test_point_t* point, int point_id)
+{
+    test_point_t point_expected = generic_test_point(point_id);
+
+    return ((point_expected.point_id == point->point_id) && (point_expected.point_weight == point->point_weight) &&
+            (0 == strcmp(point_expected.point_tag, point->point_tag))) ? TEST_PASSED : TEST_FAILED;
+}
+
+/** Checks that the list holds exactly the model, and that its node count and last node agree with its nodes **/
+static test_result_t list_model_check(linkedlist_t* list, const int* model_array, size_t model_count)
+{
+    test_result_t ret_val = TEST_PASSED;
+    struct node_t* node_current = list->head_node_ptr;
+    struct node_t* node_last = NULL;
+    size_t loop_cntr = 0;
+
+    for(loop_cntr = 0; (loop_cntr < model_count) && (TEST_PASSED == ret_val); loop_cntr++)
+    {
+        if((NULL == node_current) || (model_array[loop_cntr] != node_current->data))
+        {
+            ret_val = TEST_FAILED;
+        }
+        else
+        {
+            node_last = node_current;
+            node_current = node_current->next_node_address_ptr;
+        }
+    }
+
+    if((NULL != node_current) || (model_count != list->node_count) || (node_last != list->tail_node_ptr))
+    {
+        ret_val = TEST_FAILED;
+    }
+
+    return ret_val;
+}
+
+/** Checks that the unrolled list holds exactly the model, that no node is empty or overfull, and that its counts and
+    last node agree with its nodes **/
+static test_result_t unrolled_model_check(unrolled_list_t* list, const int* model_array, size_t model_count)
+{
+    test_result_t ret_val = TEST_PASSED;
+    struct unrolled_node_t* node_current = list->head_node_ptr;
+    struct unrolled_node_t* node_last = NULL;
+    size_t element_total = 0;
+    size_t node_total = 0;
+    unsigned int element_index = 0;
+
+    while((NULL != node_current) && (TEST_PASSED == ret_val))
+    {
+        if((0u == node_current->element_count) || (UNROLLED_LIST_NODE_CAPACITY < node_current->element_count) ||
+           (model_count < (element_total + node_current->element_count)))
+        {
+            ret_val = TEST_FAILED;
+        }
+        for(element_index = 0; (element_index < node_current->element_count) && (TEST_PASSED == ret_val);
+            element_index++)
+        {
+            if(model_array[element_total + element_index] != node_current->data[element_index])
+            {
+                ret_val = TEST_FAILED;
+            }
+        }
+        element_total = element_total + node_current->element_count;
+        node_total = node_total + 1u;
+        node_last = node_current;
+        node_current = node_current->next_node_address_ptr;
+    }
+
+    if((model_count != element_total) || (model_count != unrolled_list_size(list)) ||
+       (node_total != list->node_count) || (node_last != list->tail_node_ptr))
+    {
+        ret_val = TEST_FAILED;
+    }
+
+    return ret_val;
+}
+
+/** Checks that the skip list holds exactly the model on level 0, and that on every level in use each node links to
+    the next node as high as that level, with a span equal to the number of positions between them. The span of the
+    last link of a level reaches the end of the list. **/
+static test_result_t skiplist_model_check(skiplist_t* list, const int* model_array, size_t model_count)
+{
+    test_result_t ret_val = TEST_PASSED;
+    struct skiplist_node_t* node_array[MODEL_TEST_ELEMENTS];
+    struct skiplist_node_t* node_current = list->header_node_ptr->levels[0].next_node_address_ptr;
+    size_t node_total = 0;
+    size_t node_rank = 0;
+    size_t rank_next = 0;
+    unsigned int level_index = 0;
+
+    /** Level 0, node_array[i] is the node at position i + 1 **/
+    while((NULL != node_current) && (node_total < model_count) && (TEST_PASSED == ret_val))
+    {
+        if((model_array[node_total] != node_current->data) || (0u == node_current->level_count) ||
+           (list->level_count < node_current->level_count))
+        {
+            ret_val = TEST_FAILED;
+        }
+        node_array[node_total] = node_current;
+        node_total = node_total + 1u;
+        node_current = node_current->levels[0].next_node_address_ptr;
+    }
+    if((NULL != node_current) || (model_count != node_total) || (model_count != skiplist_size(list)) ||
+       (list->tail_node_ptr != ((0u == model_count) ? NULL : node_array[model_count - 1u])) ||
+       ((1u < list->level_count) &&
+        (NULL == list->header_node_ptr->levels[list->level_count - 1u].next_node_address_ptr)))
+    {
+        ret_val = TEST_FAILED;
+    }
+
+    for(level_index = 0; (level_index < list->level_count) && (TEST_PASSED == ret_val); level_index++)
+    {
+        node_current = list->header_node_ptr;
+        node_rank = 0;
+        while((NULL != node_current) && (TEST_PASSED == ret_val))
+        {
+            /** Position of the next node as high as this level **/
+            rank_next = node_rank + 1u;
+            while((rank_next <= model_count) && (node_array[rank_next - 1u]->level_count <= level_index))
+            {
+                rank_next = rank_next + 1u;
+            }
+
+            if(rank_next > model_count)
+            {
+                if((NULL != node_current->levels[level_index].next_node_address_ptr) ||
+                   ((model_count - node_rank) != node_current->levels[level_index].span))
+                {
+                    ret_val = TEST_FAILED;
+                }
+                node_current = NULL;
+            }
+            else if((node_array[rank_next - 1u] != node_current->levels[level_index].next_node_address_ptr) ||
+                    ((rank_next - node_rank) != node_current->levels[level_index].span))
+            {
+                ret_val = TEST_FAILED;
+            }
+            else
+            {
+                node_current = node_array[rank_next - 1u];
+                node_rank = rank_next;
+            }
+        }
+    }
+
+    return ret_val;
+}
+
+/** Checks that the intrusive list links exactly the records whose ids are in the model, in the model order, and that
+    its link count and last link agree with its links **/
+static test_result_t intrusive_model_check(intrusive_list_t* list, const int* model_array, size_t model_count)
+{
+    test_result_t ret_val = TEST_PASSED;
+    struct intrusive_link_t* link_current = NULL;
+    struct intrusive_link_t* link_last = NULL;
+    test_record_t* record_ptr = NULL;
+    size_t link_total = 0;
+
+    INTRUSIVE_LIST_FOR_EACH(link_current, list)
+    {
+        record_ptr = INTRUSIVE_LIST_CONTAINER_OF(link_current, test_record_t, record_link);
+        if((model_count <= link_total) || (model_array[link_total] != record_ptr->record_id))
+        {
+            ret_val = TEST_FAILED;
+        }
+        link_last = link_current;
+        link_total = link_total + 1u;
+    }
+
+    if((model_count != link_total) || (model_count != intrusive_list_size(list)) || (link_last != list->tail_link_ptr))
+    {
+        ret_val = TEST_FAILED;
+    }
+
+    return ret_val;
+}
+
+/** Inserts the keys k * LOCK_TEST_THREADS + thread index for k below LOCKFREE_TEST_KEYS, then deletes the ones at even
+    k, checking every key of the thread is found exactly while it is in the list **/
+static void* lockfree_test_thread(void* thread_arg)
+{
+    list_thread_arg_t* test_arg = (list_thread_arg_t*)thread_arg;
+    size_t thread_slot = 0;
+    int key_index = 0;
+    int key = 0;
+
+    test_arg->thread_result = TEST_FAILED;
+    if(LINKEDLIST_OP_SUCCESS == lockfree_list_thread_attach(&my_lockfree_list, &thread_slot))
+    {
+        test_arg->thread_result = TEST_PASSED;
+        for(key_index = 0; key_index < LOCKFREE_TEST_KEYS; key_index++)
+        {
+            key = (key_index * LOCK_TEST_THREADS) + test_arg->thread_index;
+            if((LINKEDLIST_OP_FAIL != lockfree_list_contains(&my_lockfree_list, thread_slot, key)) ||
+               (LINKEDLIST_OP_SUCCESS != lockfree_list_insert(&my_lockfree_list, thread_slot, key)) ||
+               (LINKEDLIST_OP_FAIL != lockfree_list_insert(&my_lockfree_list, thread_slot, key)) ||
+               (LINKEDLIST_OP_SUCCESS != lockfree_list_contains(&my_lockfree_list, thread_slot, key)))
+            {
+                test_arg->thread_result = TEST_FAILED;
+            }
+        }
+        for(key_index = 0; key_index < LOCKFREE_TEST_KEYS; key_index = key_index + 2)
+        {
+            key = (key_index * LOCK_TEST_THREADS) + test_arg->thread_index;
+            /** The next key of the thread stays in the list **/
+            if((LINKEDLIST_OP_SUCCESS != lockfree_list_delete(&my_lockfree_list, thread_slot, key)) ||
+               (LINKEDLIST_OP_FAIL != lockfree_list_delete(&my_lockfree_list, thread_slot, key)) ||
+               (LINKEDLIST_OP_FAIL != lockfree_list_contains(&my_lockfree_list, thread_slot, key)) ||
+               (LINKEDLIST_OP_SUCCESS != lockfree_list_contains(&my_lockfree_list, thread_slot,
+                                                                key + LOCK_TEST_THREADS)))
+            {
+                test_arg->thread_result = TEST_FAILED;
+            }
+        }
+        lockfree_list_thread_detach(&my_lockfree_list, thread_slot);
+    }
+
+    return NULL;
+}
+
+/** Checks that the lock-free list holds exactly the keys of the sorted model, in increasing order with no node marked
+    as deleted, and that its element count agrees. It must not be used while other threads change the list. **/
+static test_result_t lockfree_model_check(lockfree_list_t* list, const int* model_array, size_t model_count)
+{
+    test_result_t ret_val = TEST_PASSED;
+    uintptr_t node_next = atomic_load(&list->head_node.next_node_address);
+    struct lockfree_node_t* node_current = NULL;
+    size_t node_total = 0;
+
+    while((0u != node_next) && (TEST_PASSED == ret_val))
+    {
+        node_current = (struct lockfree_node_t*)(node_next & ~(uintptr_t)1u);
+        node_next = atomic_load(&node_current->next_node_address);
+        if((model_count <= node_total) || (model_array[node_total] != node_current->key) || (0u != (node_next & 1u)))
+        {
+            ret_val = TEST_FAILED;
+        }
+        node_total = node_total + 1u;
+    }
+
+    if((model_count != node_total) || (model_count != lockfree_list_size(list)))
+    {
+        ret_val = TEST_FAILED;
+    }
+
+    return ret_val;
+}
+
+/** Appends thread index * LOCK_TEST_INSERTS + k for k below LOCK_TEST_INSERTS, reading the first node after every
+    append **/
+static void* hoh_test_thread(void* thread_arg)
+{
+    list_thread_arg_t* test_arg = (list_thread_arg_t*)thread_arg;
+    int data_first = test_arg->thread_index * LOCK_TEST_INSERTS;
+    int loop_cntr = 0;
+    int data = 0;
+
+    test_arg->thread_result = TEST_PASSED;
+    for(loop_cntr = 0; loop_cntr < LOCK_TEST_INSERTS; loop_cntr++)
+    {
+        if((LINKEDLIST_OP_SUCCESS != hoh_list_insert_end(&my_hoh_list, data_first + loop_cntr)) ||
+           (LINKEDLIST_OP_SUCCESS != hoh_list_get_index(&my_hoh_list, 0, &data)))
+        {
+            test_arg->thread_result = TEST_FAILED;
+        }
+    }
+
+    return NULL;
+}
+
+/** Deletes LOCK_TEST_INSERTS first nodes, reading the last node before every delete. Every thread deletes as many
+    nodes as it appended, so none of the deletes can find the list empty. **/
+static void* hoh_test_delete_thread(void* thread_arg)
+{
+    list_thread_arg_t* test_arg = (list_thread_arg_t*)thread_arg;
+    int loop_cntr = 0;
+    int data = 0;
+
+    test_arg->thread_result = TEST_PASSED;
+    for(loop_cntr = 0; loop_cntr < LOCK_TEST_INSERTS; loop_cntr++)
+    {
+        if((LINKEDLIST_OP_SUCCESS != hoh_list_get_end(&my_hoh_list, &data)) ||
+           (LINKEDLIST_OP_SUCCESS != hoh_list_delete_index(&my_hoh_list, 0)))
+        {
+            test_arg->thread_result = TEST_FAILED;
+        }
+    }
+
+    return NULL;
+}
+
+/** Checks that the list holds exactly the model and agrees with its node count. It must not be used while other
+    threads change the list. **/
+static test_result_t hoh_model_check(hoh_list_t* list, const int* model_array, size_t model_count)
+{
+    test_result_t ret_val = TEST_PASSED;
+    struct hoh_node_t* node_current = list->head_node.next_node_address_ptr;
+    size_t node_total = 0;
+
+    while((NULL != node_current) && (TEST_PASSED == ret_val))
+    {
+        if((model_count <= node_total) || (model_array[node_total] != node_current->data))
+        {
+            ret_val = TEST_FAILED;
+        }
+        node_total = node_total + 1u;
+        node_current = node_current->next_node_address_ptr;
+    }
+
+    if((model_count != node_total) || (model_count != hoh_list_size(list)))
+    {
+        ret_val = TEST_FAILED;
+    }
+
+    return ret_val;
+}
+
+/** Compares two int values for qsort() **/
+static int model_compare(const void* value_a, const void* value_b)
+{
+    int data_a = *(const int*)value_a;
+    int data_b = *(const int*)value_b;
+
+    return (data_a > data_b) - (data_a < data_b);
+}
+
+/** Appends data to the visit_context_t given as context **/
+static void traversal_test_visit(int data, void* context)
+{
+    visit_context_t* visit_context = (visit_context_t*)context;
+
+    if(visit_context->data_count < MODEL_TEST_ELEMENTS)
+    {
+        visit_context->data_array[visit_context->data_count] = data;
+    }
+    visit_context->data_count = visit_context->data_count + 1u;
+}
+
+/** Matches data divisible by the int given as context **/
+static int parallel_test_divisible(int data, void* context)
+{
+    return (0 == (data % *(const int*)context)) ? 1 : 0;
+}
+
+/** Matches data equal to the int given as context **/
+static int parallel_test_equal(int data, void* context)
+{
+    return (data == *(const int*)context) ? 1 : 0;
+}
+
+/** Adds 1 to the task index and stores it in the int array given as tasks, so a task run twice is noticed **/
+static void parallel_test_task(void* task_array, size_t task_index)
+{
+    ((int*)task_array)[task_index] = ((int*)task_array)[task_index] + (int)task_index + 1;
+}
+
+/** Takes snapshots of the persistent list until one holds all the MODEL_TEST_ELEMENTS values appended by the test,
+    checking the size never goes back and the first, last and one more element of every snapshot **/
+static void* persistent_test_thread(void* thread_arg)
+{
+    list_thread_arg_t* test_arg = (list_thread_arg_t*)thread_arg;
+    persistent_snapshot_t my_snapshot;
+    size_t snapshot_size = 0;
+    size_t size_previous = 0;
+    size_t index = 0;
+    int data_first = 0;
+    int data_last = 0;
+    int data = 0;
+
+    test_arg->thread_result = TEST_PASSED;
+    while((MODEL_TEST_ELEMENTS != snapshot_size) && (TEST_PASSED == test_arg->thread_result))
+    {
+        persistent_list_snapshot(&my_persistent_list, &my_snapshot);
+        snapshot_size = persistent_snapshot_size(&my_snapshot);
+        index = (snapshot_size * (size_t)(test_arg->thread_index + 1)) / (LOCK_TEST_THREADS + 1u);
+        if((snapshot_size < size_previous) ||
+           ((0u != snapshot_size) &&
+            ((LINKEDLIST_OP_SUCCESS != persistent_snapshot_get_index(&my_snapshot, 0, &data_first)) ||
+             (0 != data_first) ||
+             (LINKEDLIST_OP_SUCCESS != persistent_snapshot_get_end(&my_snapshot, &data_last)) ||
+             ((int)(snapshot_size - 1u) != data_last) ||
+             (LINKEDLIST_OP_SUCCESS != persistent_snapshot_get_index(&my_snapshot, index, &data)) ||
+             ((int)index != data))))
+        {
+            test_arg->thread_result = TEST_FAILED;
+        }
+        size_previous = snapshot_size;
+        persistent_snapshot_release(&my_snapshot);
+    }
+
+    return NULL;
+}
+
+/** Appends a chunk to the visit_context_t given as context, and fails if it is the call_limit-th call **/
+static linkedlist_std_ret_t export_test_chunk(const int* data_array, size_t data_count, void* context)
+{
+    visit_context_t* visit_context = (visit_context_t*)context;
+
+    if((visit_context->data_count + data_count) <= MODEL_TEST_ELEMENTS)
+    {
+        memcpy(&visit_context->data_array[visit_context->data_count], data_array, data_count * sizeof(int));
+    }
+    visit_context->data_count = visit_context->data_count + data_count;
+    visit_context->call_count = visit_context->call_count + 1u;
+
+    return (visit_context->call_count == visit_context->call_limit) ? LINKEDLIST_OP_FAIL : LINKEDLIST_OP_SUCCESS;
+}
+
+/** Checks that the counters only changed by one call of stats_op, which visited nodes_expected nodes and was counted
+    in the latency bin of its own latency. Without the counters built in, they must not change at all. **/
+static test_result_t stats_call_check(const linkedlist_stats_t* stats_before, const linkedlist_stats_t* stats_after,
+                                      linkedlist_stats_op_t stats_op, unsigned long long nodes_expected)
+{
+    test_result_t ret_val = TEST_PASSED;
+    const unsigned long long stats_enabled = (1 == LINKEDLIST_STATS_ENABLE) ? 1ull : 0ull;
+    const linkedlist_stats_entry_t* entry_before = NULL;
+    const linkedlist_stats_entry_t* entry_after = NULL;
+    unsigned long long latency_ns = stats_after->op_entries[stats_op].latency_total_ns -
+                                    stats_before->op_entries[stats_op].latency_total_ns;
+    size_t latency_bin = 0;
+    size_t op_index = 0;
+    size_t bin_index = 0;
+
+    while((latency_ns > 1u) && (latency_bin < (LINKEDLIST_STATS_HISTOGRAM_BINS - 1u)))
+    {
+        latency_ns = latency_ns >> 1;
+        latency_bin = latency_bin + 1u;
+    }
+
+    for(op_index = 0; op_index < LINKEDLIST_STATS_OP_COUNT; op_index++)
+    {
+        entry_before = &stats_before->op_entries[op_index];
+        entry_after = &stats_after->op_entries[op_index];
+        if((op_index == (size_t)stats_op) ?
+           (((entry_before->call_count + stats_enabled) != entry_after->call_count) ||
+            ((entry_before->nodes_traversed + (stats_enabled * nodes_expected)) != entry_after->nodes_traversed)) :
+           (0 != memcmp(entry_before, entry_after, sizeof(linkedlist_stats_entry_t))))
+        {
+            ret_val = TEST_FAILED;
+        }
+        for(bin_index = 0; (op_index == (size_t)stats_op) && (bin_index < LINKEDLIST_STATS_HISTOGRAM_BINS);
+            bin_index++)
+        {
+            if((entry_before->latency_histogram[bin_index] + ((latency_bin == bin_index) ? stats_enabled : 0u)) !=
+               entry_after->latency_histogram[bin_index])
+            {
+                ret_val = TEST_FAILED;
+            }
+        }
+    }
+
+    return ret_val;
+}
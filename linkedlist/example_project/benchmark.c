@@ -0,0 +1,2068 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: benchmark.c
+* File Description: This file contains the benchmarks of the linkedlist function library and its variants. Build and
+* run all of them with "make bench", or run a single one with "./linkedlist_benchmark <benchmark name> [option]".
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#define _POSIX_C_SOURCE 200809L
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <pthread.h>
+#include "linkedlist.h"
+#include "linkedlist_pool.h"
+#include "linkedlist_generic.h"
+#include "unrolled_list.h"
+#include "skiplist.h"
+#include "intrusive_list.h"
+#include "lockfree_list.h"
+#include "hoh_list.h"
+#include "linkedlist_snapshot.h"
+#include "linkedlist_stats.h"
+#include "linkedlist_parallel.h"
+#include "persistent_list.h"
+#include "CustomArray.h"
+
+/*********************************************************************************************************************
+                                  << Private Constants >>
+*********************************************************************************************************************/
+#define BENCH_UNROLLED_ELEMENTS     1000000u
+#define BENCH_UNROLLED_PASSES       20u
+#define BENCH_BULK_BATCH            100000u
+#define BENCH_BULK_BATCHES          10u
+#define BENCH_LARGE_DEFAULT_LIMIT   10000000u
+#define BENCH_LARGE_FIRST_SIZE      1000u
+#define BENCH_LARGE_SAMPLES         20u
+#define BENCH_GENERIC_ELEMENTS      1000000u
+#define BENCH_GENERIC_SAMPLES       200u
+#define BENCH_INTRUSIVE_RECORDS     1000000u
+#define BENCH_LOCKFREE_OPERATIONS   200000u
+#define BENCH_LOCKFREE_KEY_RANGE    1024u
+#define BENCH_LOCKFREE_MAX_THREADS  32u
+#define BENCH_HOH_OPERATIONS        20000u
+#define BENCH_HOH_ELEMENTS          1000u
+#define BENCH_HOH_DEFAULT_THREADS   8u
+#define BENCH_SORT_FIRST_SIZE       1000000u
+#define BENCH_SORT_DEFAULT_LIMIT    10000000u
+#define BENCH_COMPACT_ELEMENTS      1000000u
+#define BENCH_COMPACT_PASSES        10u
+#define BENCH_TRAVERSAL_ELEMENTS    2000000u
+#define BENCH_TRAVERSAL_LOOKUPS     20u
+#define BENCH_SNAPSHOT_ELEMENTS     5000000u
+#define BENCH_STATS_ELEMENTS        1000000u
+#define BENCH_STATS_LOOKUPS         1000u
+#define BENCH_STATS_LOOKUP_RANGE    10000u
+#define BENCH_PARALLEL_ELEMENTS     4000000u
+#define BENCH_PARALLEL_PASSES       5u
+#define BENCH_PARALLEL_MAX_THREADS  8u
+#define BENCH_SEARCH_ELEMENTS       1000000u
+#define BENCH_SEARCH_PASSES         20u
+#define BENCH_SEARCH_VALUE_RANGE    1000u
+#define BENCH_PERSISTENT_FIRST_SIZE 1000u
+#define BENCH_PERSISTENT_LAST_SIZE  1000000u
+#define BENCH_PERSISTENT_SNAPSHOTS  100u
+#define BENCH_PERSISTENT_APPENDS    200000u
+#define BENCH_PERSISTENT_READERS    2u
+#define BENCH_PERSISTENT_MAX_READERS 16u
+#define BENCH_SPLICE_ELEMENTS       1000000u
+#define BENCH_SPLICE_RUN            100000u
+#define BENCH_ARRAY_ELEMENTS        1000000u
+#define BENCH_ARRAY_INDEXED         20000u
+#define BENCH_ARRAY_CHUNK           4096u
+#define BENCH_RWLOCK_ELEMENTS       100000u
+#define BENCH_RWLOCK_MILLISECONDS   200u
+#define BENCH_RWLOCK_MAX_WRITERS    2u
+#define BENCH_RWLOCK_DEFAULT_READERS 8u
+#define BENCH_SKIPLIST_FIRST_SIZE   1000u
+#define BENCH_SKIPLIST_DEFAULT_LIMIT 1000000u
+#define BENCH_SKIPLIST_SAMPLES      200u
+
+/*********************************************************************************************************************
+                                  << Private Datatypes >>
+*********************************************************************************************************************/
+typedef struct
+{
+    const char* bench_name;
+    void (*bench_function)(void);
+} bench_entry_t;
+
+/** Record already stored in an array, linked by the intrusive list through its embedded link **/
+typedef struct
+{
+    int record_id;
+    int record_payload[7];
+    struct intrusive_link_t record_link;
+} bench_record_t;
+
+/** Work given to every thread of the multi-threaded benchmarks **/
+typedef struct
+{
+    lockfree_list_t* list_ptr;
+    pthread_mutex_t* global_lock_ptr; /** NULL when the list is used without a lock **/
+    unsigned int operation_count;
+    unsigned int random_state;
+} bench_thread_arg_t;
+
+/** Work given to every thread of the hand-over-hand locking benchmark. Exactly one of the lists is used. **/
+typedef struct
+{
+    hoh_list_t* hoh_list_ptr;
+    linkedlist_t* node_list_ptr;      /** used behind global_lock_ptr **/
+    pthread_mutex_t* global_lock_ptr;
+    unsigned int operation_count;
+    unsigned int write_percent;
+    unsigned int random_state;
+} bench_hoh_arg_t;
+
+/** Work given to every reader thread of the persistent list benchmark. Exactly one of the lists is used. **/
+typedef struct
+{
+    persistent_list_t* persistent_list_ptr;
+    linkedlist_t* node_list_ptr;      /** copied behind global_lock_ptr **/
+    pthread_mutex_t* global_lock_ptr;
+    atomic_int* writer_done_ptr;
+    unsigned long snapshot_count;
+    unsigned long snapshot_errors;
+} bench_persistent_arg_t;
+
+/** Work given to every thread of the CustomArray reader-writer lock benchmark **/
+typedef struct
+{
+    custarr_t* array_ptr;
+    pthread_mutex_t* global_lock_ptr; /** NULL when only the array lock is used **/
+    atomic_int* stop_ptr;
+    int is_writer;
+    unsigned int random_state;
+    unsigned long operation_count;
+} bench_rwlock_arg_t;
+
+/** int list generated from the generic linkedlist, compared against the int handle based functions **/
+LINKEDLIST_DEFINE(bench_intlist, int)
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static double bench_time_now(void);
+static void bench_unrolled(void);
+static void bench_bulk(void);
+static void bench_large(void);
+static void bench_generic(void);
+static void bench_intrusive(void);
+static void bench_lockfree(void);
+static void* bench_lockfree_thread(void* thread_arg);
+static void bench_hoh(void);
+static void* bench_hoh_thread(void* thread_arg);
+static void bench_sort(void);
+static int bench_int_compare(const void* value_a, const void* value_b);
+static void bench_compact(void);
+static double bench_traversal_time(linkedlist_t* list);
+static void bench_traversal(void);
+static void bench_traversal_visit(int data, void* context);
+static void bench_snapshot(void);
+static void bench_stats(void);
+static void bench_parallel(void);
+static int bench_parallel_odd(int data, void* context);
+static void bench_search(void);
+static void bench_persistent(void);
+static void* bench_persistent_reader(void* thread_arg);
+static void bench_persistent_copy(linkedlist_t* list_source, linkedlist_t* list_copy);
+static void bench_splice(void);
+static void bench_array(void);
+static linkedlist_std_ret_t bench_array_chunk(const int* data_array, size_t data_count, void* context);
+static void bench_rwlock(void);
+static void* bench_rwlock_thread(void* thread_arg);
+static void bench_skiplist(void);
+
+/*********************************************************************************************************************
+                                  << Private Variable Definitions >>
+*********************************************************************************************************************/
+static const bench_entry_t bench_table[] =
+{
+    {"unrolled",  bench_unrolled},
+    {"bulk",      bench_bulk},
+    {"large",     bench_large},
+    {"generic",   bench_generic},
+    {"intrusive", bench_intrusive},
+    {"lockfree",  bench_lockfree},
+    {"hoh",       bench_hoh},
+    {"sort",      bench_sort},
+    {"compact",   bench_compact},
+    {"traversal", bench_traversal},
+    {"snapshot",  bench_snapshot},
+    {"stats",     bench_stats},
+    {"parallel",  bench_parallel},
+    {"search",    bench_search},
+    {"persistent", bench_persistent},
+    {"splice",    bench_splice},
+    {"array",     bench_array},
+    {"rwlock",    bench_rwlock},
+    {"skiplist",  bench_skiplist},
+};
+
+static volatile long long bench_sink; /** Keeps the compiler from optimizing the measured loops away **/
+static const char* bench_option = NULL; /** Optional argument given after the benchmark name **/
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+int main(int argc, char* argv[])
+{
+    size_t bench_index = 0;
+    int bench_found = 0;
+
+    if(argc > 2)
+    {
+        bench_option = argv[2];
+    }
+
+    for(bench_index = 0; bench_index < (sizeof(bench_table) / sizeof(bench_table[0])); bench_index++)
+    {
+        if((argc < 2) || (0 == strcmp(argv[1], bench_table[bench_index].bench_name)))
+        {
+            printf("\n== %s ==\n", bench_table[bench_index].bench_name);
+            bench_table[bench_index].bench_function();
+            bench_found = 1;
+        }
+    }
+
+    if(0 == bench_found)
+    {
+        printf("Unknown benchmark: %s\n", argv[1]);
+    }
+
+    return (0 == bench_found);
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+/** Returns a monotonic time stamp in seconds **/
+static double bench_time_now(void)
+{
+    struct timespec time_stamp;
+
+    clock_gettime(CLOCK_MONOTONIC, &time_stamp);
+    return (double)time_stamp.tv_sec + ((double)time_stamp.tv_nsec * 1e-9);
+}
+
+/** Compares a full traversal and the node memory of a linkedlist and an unrolled list holding the same elements **/
+static void bench_unrolled(void)
+{
+    linkedlist_t node_list;
+    unrolled_list_t block_list;
+    struct node_t* node_current = NULL;
+    struct unrolled_node_t* block_current = NULL;
+    unsigned int element_index = 0;
+    unsigned int pass_index = 0;
+    long long element_sum = 0;
+    double time_start = 0.0;
+    double node_time = 0.0;
+    double block_time = 0.0;
+    size_t node_bytes = 0;
+    size_t block_bytes = 0;
+
+    linkedlist_handle_init(&node_list);
+    unrolled_list_init(&block_list);
+    for(element_index = 0; element_index < BENCH_UNROLLED_ELEMENTS; element_index++)
+    {
+        linkedlist_handle_insert_end(&node_list, (int)element_index);
+        unrolled_list_insert_end(&block_list, (int)element_index);
+    }
+
+    time_start = bench_time_now();
+    for(pass_index = 0; pass_index < BENCH_UNROLLED_PASSES; pass_index++)
+    {
+        for(node_current = node_list.head_node_ptr; NULL != node_current;
+            node_current = node_current->next_node_address_ptr)
+        {
+            element_sum += node_current->data;
+        }
+    }
+    node_time = bench_time_now() - time_start;
+
+    time_start = bench_time_now();
+    for(pass_index = 0; pass_index < BENCH_UNROLLED_PASSES; pass_index++)
+    {
+        for(block_current = block_list.head_node_ptr; NULL != block_current;
+            block_current = block_current->next_node_address_ptr)
+        {
+            for(element_index = 0; element_index < block_current->element_count; element_index++)
+            {
+                element_sum += block_current->data[element_index];
+            }
+        }
+    }
+    block_time = bench_time_now() - time_start;
+    bench_sink = element_sum;
+
+    node_bytes  = linkedlist_handle_size(&node_list) * sizeof(struct node_t);
+    block_bytes = unrolled_list_memory_usage(&block_list);
+
+    printf("elements: %u, unrolled node capacity: %u\n", BENCH_UNROLLED_ELEMENTS,
+           (unsigned int)UNROLLED_LIST_NODE_CAPACITY);
+    printf("traversal  linkedlist: %8.3f ns/element   unrolled: %8.3f ns/element   speedup: %.2fx\n",
+           (node_time * 1e9) / ((double)BENCH_UNROLLED_ELEMENTS * BENCH_UNROLLED_PASSES),
+           (block_time * 1e9) / ((double)BENCH_UNROLLED_ELEMENTS * BENCH_UNROLLED_PASSES),
+           node_time / block_time);
+    printf("memory     linkedlist: %8.2f B/element    unrolled: %8.2f B/element    saving: %.1f%%\n",
+           (double)node_bytes / BENCH_UNROLLED_ELEMENTS, (double)block_bytes / BENCH_UNROLLED_ELEMENTS,
+           100.0 * (1.0 - ((double)block_bytes / (double)node_bytes)));
+
+    linkedlist_handle_delete_all(&node_list);
+    unrolled_list_delete_all(&block_list);
+}
+
+/** Compares loading batches of values one element at a time and in bulk, against copying them with memcpy() **/
+static void bench_bulk(void)
+{
+    linkedlist_t node_list;
+    linkedlist_pool_t node_pool;
+    int* batch_data = (int*)malloc(BENCH_BULK_BATCH * sizeof(int));
+    int* batch_copy = (int*)malloc(BENCH_BULK_BATCH * BENCH_BULK_BATCHES * sizeof(int));
+    unsigned int element_index = 0;
+    unsigned int batch_index = 0;
+    double time_start = 0.0;
+    double copy_time = 0.0;
+    double single_time = 0.0;
+    double bulk_time = 0.0;
+    double pool_time = 0.0;
+    const double element_total = (double)BENCH_BULK_BATCH * BENCH_BULK_BATCHES;
+
+    for(element_index = 0; element_index < BENCH_BULK_BATCH; element_index++)
+    {
+        batch_data[element_index] = (int)element_index;
+    }
+
+    time_start = bench_time_now();
+    for(batch_index = 0; batch_index < BENCH_BULK_BATCHES; batch_index++)
+    {
+        memcpy(&batch_copy[batch_index * BENCH_BULK_BATCH], batch_data, BENCH_BULK_BATCH * sizeof(int));
+    }
+    copy_time = bench_time_now() - time_start;
+    bench_sink = batch_copy[BENCH_BULK_BATCH - 1u];
+
+    linkedlist_handle_init(&node_list);
+    time_start = bench_time_now();
+    for(batch_index = 0; batch_index < BENCH_BULK_BATCHES; batch_index++)
+    {
+        for(element_index = 0; element_index < BENCH_BULK_BATCH; element_index++)
+        {
+            linkedlist_handle_insert_end(&node_list, batch_data[element_index]);
+        }
+    }
+    single_time = bench_time_now() - time_start;
+    linkedlist_handle_delete_all(&node_list);
+
+    time_start = bench_time_now();
+    for(batch_index = 0; batch_index < BENCH_BULK_BATCHES; batch_index++)
+    {
+        linkedlist_append_array(&node_list, batch_data, BENCH_BULK_BATCH);
+    }
+    bulk_time = bench_time_now() - time_start;
+    linkedlist_handle_delete_all(&node_list);
+
+    linkedlist_pool_init(&node_pool, BENCH_BULK_BATCH);
+    linkedlist_handle_pool_set(&node_list, &node_pool);
+    time_start = bench_time_now();
+    for(batch_index = 0; batch_index < BENCH_BULK_BATCHES; batch_index++)
+    {
+        linkedlist_append_array(&node_list, batch_data, BENCH_BULK_BATCH);
+    }
+    pool_time = bench_time_now() - time_start;
+    linkedlist_handle_delete_all(&node_list);
+    linkedlist_pool_destroy(&node_pool);
+
+    printf("elements: %u in batches of %u\n", BENCH_BULK_BATCH * BENCH_BULK_BATCHES, BENCH_BULK_BATCH);
+    printf("memcpy                    : %8.3f ns/element\n", (copy_time * 1e9) / element_total);
+    printf("insert_end per element    : %8.3f ns/element   %6.1fx memcpy\n", (single_time * 1e9) / element_total,
+           single_time / copy_time);
+    printf("append_array              : %8.3f ns/element   %6.1fx memcpy\n", (bulk_time * 1e9) / element_total,
+           bulk_time / copy_time);
+    printf("append_array, pool backed : %8.3f ns/element   %6.1fx memcpy\n", (pool_time * 1e9) / element_total,
+           pool_time / copy_time);
+
+    free(batch_data);
+    free(batch_copy);
+}
+
+/** Grows a list by factors of 10 up to 10^7 nodes, or to the node count given as option, and reports the latency of
+    every operation at every size. Positional operations are sampled at random indexes. **/
+static void bench_large(void)
+{
+    linkedlist_t node_list;
+    linkedlist_pool_t node_pool;
+    size_t size_limit = BENCH_LARGE_DEFAULT_LIMIT;
+    size_t size_current = 0;
+    size_t size_start = 0;
+    size_t size_next = BENCH_LARGE_FIRST_SIZE;
+    size_t sample_index = 0;
+    unsigned int random_state = 12345u;
+    int data = 0;
+    long long data_sum = 0;
+    double time_start = 0.0;
+    double append_time = 0.0;
+    double get_end_time = 0.0;
+    double get_index_time = 0.0;
+    double insert_index_time = 0.0;
+    double delete_index_time = 0.0;
+    double delete_end_time = 0.0;
+
+    if(NULL != bench_option)
+    {
+        size_limit = (size_t)strtoull(bench_option, NULL, 10);
+    }
+
+    linkedlist_handle_init(&node_list);
+    linkedlist_pool_init(&node_pool, 0);
+    linkedlist_handle_pool_set(&node_list, &node_pool);
+
+    printf("%12s %12s %12s %12s %14s %14s %12s   (ns/op)\n", "nodes", "insert_end", "get_end", "get_index",
+           "insert_index", "delete_index", "delete_end");
+    while(size_next <= size_limit)
+    {
+        size_start = size_current;
+        time_start = bench_time_now();
+        for(; size_current < size_next; size_current++)
+        {
+            linkedlist_handle_insert_end(&node_list, (int)size_current);
+        }
+        append_time = (bench_time_now() - time_start) / (double)(size_current - size_start);
+
+        time_start = bench_time_now();
+        for(sample_index = 0; sample_index < BENCH_LARGE_SAMPLES; sample_index++)
+        {
+            linkedlist_handle_get_end(&node_list, &data);
+            data_sum += data;
+        }
+        get_end_time = (bench_time_now() - time_start) / BENCH_LARGE_SAMPLES;
+
+        time_start = bench_time_now();
+        for(sample_index = 0; sample_index < BENCH_LARGE_SAMPLES; sample_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            linkedlist_handle_get_index(&node_list, (size_t)random_state % size_current, &data);
+            data_sum += data;
+        }
+        get_index_time = (bench_time_now() - time_start) / BENCH_LARGE_SAMPLES;
+
+        time_start = bench_time_now();
+        for(sample_index = 0; sample_index < BENCH_LARGE_SAMPLES; sample_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            linkedlist_handle_insert_index(&node_list, (size_t)random_state % size_current, (int)sample_index);
+        }
+        insert_index_time = (bench_time_now() - time_start) / BENCH_LARGE_SAMPLES;
+
+        time_start = bench_time_now();
+        for(sample_index = 0; sample_index < BENCH_LARGE_SAMPLES; sample_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            linkedlist_handle_delete_index(&node_list, (size_t)random_state % size_current);
+        }
+        delete_index_time = (bench_time_now() - time_start) / BENCH_LARGE_SAMPLES;
+
+        time_start = bench_time_now();
+        for(sample_index = 0; sample_index < BENCH_LARGE_SAMPLES; sample_index++)
+        {
+            linkedlist_handle_delete_end(&node_list);
+        }
+        delete_end_time = (bench_time_now() - time_start) / BENCH_LARGE_SAMPLES;
+
+        /** Put back the nodes taken away by delete_end, so the list keeps its size **/
+        for(sample_index = 0; sample_index < BENCH_LARGE_SAMPLES; sample_index++)
+        {
+            linkedlist_handle_insert_end(&node_list, (int)sample_index);
+        }
+
+        printf("%12zu %12.1f %12.1f %12.1f %14.1f %14.1f %12.1f\n", linkedlist_handle_size(&node_list),
+               append_time * 1e9, get_end_time * 1e9, get_index_time * 1e9, insert_index_time * 1e9,
+               delete_index_time * 1e9, delete_end_time * 1e9);
+        size_next = size_next * 10u;
+    }
+    bench_sink = data_sum;
+
+    linkedlist_handle_delete_all(&node_list);
+    linkedlist_pool_destroy(&node_pool);
+}
+
+/** Compares an int list generated with LINKEDLIST_DEFINE() with the int handle based functions **/
+static void bench_generic(void)
+{
+    linkedlist_t node_list;
+    bench_intlist_t generic_list;
+    struct node_t* node_current = NULL;
+    struct bench_intlist_node_t* generic_current = NULL;
+    unsigned int element_index = 0;
+    unsigned int random_state = 12345u;
+    long long data_sum = 0;
+    int data = 0;
+    double time_start = 0.0;
+    double node_time[4] = {0.0};
+    double generic_time[4] = {0.0};
+    const char* operation_name[4] = {"insert_end", "traversal", "get_index", "delete_all"};
+    const double operation_count[4] = {BENCH_GENERIC_ELEMENTS, BENCH_GENERIC_ELEMENTS, BENCH_GENERIC_SAMPLES,
+                                       BENCH_GENERIC_ELEMENTS};
+
+    linkedlist_handle_init(&node_list);
+    bench_intlist_init(&generic_list);
+
+    time_start = bench_time_now();
+    for(element_index = 0; element_index < BENCH_GENERIC_ELEMENTS; element_index++)
+    {
+        linkedlist_handle_insert_end(&node_list, (int)element_index);
+    }
+    node_time[0] = bench_time_now() - time_start;
+
+    time_start = bench_time_now();
+    for(element_index = 0; element_index < BENCH_GENERIC_ELEMENTS; element_index++)
+    {
+        bench_intlist_insert_end(&generic_list, (int)element_index);
+    }
+    generic_time[0] = bench_time_now() - time_start;
+
+    time_start = bench_time_now();
+    for(node_current = node_list.head_node_ptr; NULL != node_current;
+        node_current = node_current->next_node_address_ptr)
+    {
+        data_sum += node_current->data;
+    }
+    node_time[1] = bench_time_now() - time_start;
+
+    time_start = bench_time_now();
+    for(generic_current = generic_list.head_node_ptr; NULL != generic_current;
+        generic_current = generic_current->next_node_address_ptr)
+    {
+        data_sum += generic_current->data;
+    }
+    generic_time[1] = bench_time_now() - time_start;
+
+    time_start = bench_time_now();
+    for(element_index = 0; element_index < BENCH_GENERIC_SAMPLES; element_index++)
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        linkedlist_handle_get_index(&node_list, random_state % BENCH_GENERIC_ELEMENTS, &data);
+        data_sum += data;
+    }
+    node_time[2] = bench_time_now() - time_start;
+
+    random_state = 12345u;
+    time_start = bench_time_now();
+    for(element_index = 0; element_index < BENCH_GENERIC_SAMPLES; element_index++)
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        bench_intlist_get_index(&generic_list, random_state % BENCH_GENERIC_ELEMENTS, &data);
+        data_sum += data;
+    }
+    generic_time[2] = bench_time_now() - time_start;
+    bench_sink = data_sum;
+
+    time_start = bench_time_now();
+    linkedlist_handle_delete_all(&node_list);
+    node_time[3] = bench_time_now() - time_start;
+
+    time_start = bench_time_now();
+    bench_intlist_delete_all(&generic_list);
+    generic_time[3] = bench_time_now() - time_start;
+
+    printf("elements: %u\n", BENCH_GENERIC_ELEMENTS);
+    for(element_index = 0; element_index < 4u; element_index++)
+    {
+        printf("%-10s  linkedlist: %12.3f ns/op   generic int: %12.3f ns/op   ratio: %.2f\n",
+               operation_name[element_index], (node_time[element_index] * 1e9) / operation_count[element_index],
+               (generic_time[element_index] * 1e9) / operation_count[element_index],
+               generic_time[element_index] / node_time[element_index]);
+    }
+}
+
+/** Compares linking records of an array with the intrusive list against storing their ids in handle based nodes **/
+static void bench_intrusive(void)
+{
+    linkedlist_t node_list;
+    intrusive_list_t record_list;
+    bench_record_t* record_array = (bench_record_t*)calloc(BENCH_INTRUSIVE_RECORDS, sizeof(bench_record_t));
+    struct node_t* node_current = NULL;
+    struct intrusive_link_t* link_current = NULL;
+    unsigned int record_index = 0;
+    long long data_sum = 0;
+    double time_start = 0.0;
+    double node_time[3] = {0.0};
+    double intrusive_time[3] = {0.0};
+    const char* operation_name[3] = {"insert_end", "traversal", "delete_all"};
+
+    if(NULL == record_array)
+    {
+        printf("record array couldn't be allocated\n");
+        return;
+    }
+    for(record_index = 0; record_index < BENCH_INTRUSIVE_RECORDS; record_index++)
+    {
+        record_array[record_index].record_id = (int)record_index;
+        record_array[record_index].record_payload[0] = (int)(record_index & 0xFFu);
+    }
+    linkedlist_handle_init(&node_list);
+    intrusive_list_init(&record_list);
+
+    time_start = bench_time_now();
+    for(record_index = 0; record_index < BENCH_INTRUSIVE_RECORDS; record_index++)
+    {
+        linkedlist_handle_insert_end(&node_list, record_array[record_index].record_id);
+    }
+    node_time[0] = bench_time_now() - time_start;
+
+    time_start = bench_time_now();
+    for(record_index = 0; record_index < BENCH_INTRUSIVE_RECORDS; record_index++)
+    {
+        intrusive_list_insert_end(&record_list, &record_array[record_index].record_link);
+    }
+    intrusive_time[0] = bench_time_now() - time_start;
+
+    /** Both traversals read the payload of every record **/
+    time_start = bench_time_now();
+    for(node_current = node_list.head_node_ptr; NULL != node_current;
+        node_current = node_current->next_node_address_ptr)
+    {
+        data_sum += record_array[node_current->data].record_payload[0];
+    }
+    node_time[1] = bench_time_now() - time_start;
+
+    time_start = bench_time_now();
+    INTRUSIVE_LIST_FOR_EACH(link_current, &record_list)
+    {
+        data_sum += INTRUSIVE_LIST_CONTAINER_OF(link_current, bench_record_t, record_link)->record_payload[0];
+    }
+    intrusive_time[1] = bench_time_now() - time_start;
+    bench_sink = data_sum;
+
+    time_start = bench_time_now();
+    linkedlist_handle_delete_all(&node_list);
+    node_time[2] = bench_time_now() - time_start;
+
+    time_start = bench_time_now();
+    intrusive_list_delete_all(&record_list);
+    intrusive_time[2] = bench_time_now() - time_start;
+
+    printf("records: %u\n", BENCH_INTRUSIVE_RECORDS);
+    for(record_index = 0; record_index < 3u; record_index++)
+    {
+        printf("%-10s  linkedlist: %12.3f ns/op   intrusive: %12.3f ns/op\n", operation_name[record_index],
+               (node_time[record_index] * 1e9) / BENCH_INTRUSIVE_RECORDS,
+               (intrusive_time[record_index] * 1e9) / BENCH_INTRUSIVE_RECORDS);
+    }
+
+    free(record_array);
+}
+
+/** Measures the throughput of the lock-free list from 1 thread up to the thread count given as option, against the
+    same list used behind a single global mutex. 80% of the operations are searches, 10% inserts and 10% deletes. **/
+static void bench_lockfree(void)
+{
+    lockfree_list_t* list_ptr = (lockfree_list_t*)malloc(sizeof(lockfree_list_t));
+    pthread_mutex_t global_lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_t thread_id[BENCH_LOCKFREE_MAX_THREADS];
+    bench_thread_arg_t thread_arg[BENCH_LOCKFREE_MAX_THREADS];
+    size_t thread_limit = BENCH_LOCKFREE_MAX_THREADS;
+    size_t thread_count = 0;
+    size_t thread_index = 0;
+    size_t thread_slot = 0;
+    unsigned int key = 0;
+    int use_lock = 0;
+    double time_start = 0.0;
+    double run_time[2] = {0.0};
+
+    if(NULL == list_ptr)
+    {
+        printf("list couldn't be allocated\n");
+        return;
+    }
+    if(NULL != bench_option)
+    {
+        thread_limit = (size_t)strtoull(bench_option, NULL, 10);
+    }
+    if((0u == thread_limit) || (thread_limit > BENCH_LOCKFREE_MAX_THREADS))
+    {
+        thread_limit = BENCH_LOCKFREE_MAX_THREADS;
+    }
+
+    printf("operations: %u, key range: %u\n", BENCH_LOCKFREE_OPERATIONS, BENCH_LOCKFREE_KEY_RANGE);
+    for(thread_count = 1; thread_count <= thread_limit; thread_count = thread_count * 2u)
+    {
+        for(use_lock = 0; use_lock < 2; use_lock++)
+        {
+            /** Start every run from the same half full list **/
+            lockfree_list_init(list_ptr);
+            lockfree_list_thread_attach(list_ptr, &thread_slot);
+            for(key = 0; key < BENCH_LOCKFREE_KEY_RANGE; key = key + 2u)
+            {
+                lockfree_list_insert(list_ptr, thread_slot, (int)key);
+            }
+            lockfree_list_thread_detach(list_ptr, thread_slot);
+
+            time_start = bench_time_now();
+            for(thread_index = 0; thread_index < thread_count; thread_index++)
+            {
+                thread_arg[thread_index].list_ptr = list_ptr;
+                thread_arg[thread_index].global_lock_ptr = (0 != use_lock) ? &global_lock : NULL;
+                thread_arg[thread_index].operation_count = BENCH_LOCKFREE_OPERATIONS / (unsigned int)thread_count;
+                thread_arg[thread_index].random_state = 12345u + (unsigned int)thread_index;
+                pthread_create(&thread_id[thread_index], NULL, bench_lockfree_thread, &thread_arg[thread_index]);
+            }
+            for(thread_index = 0; thread_index < thread_count; thread_index++)
+            {
+                pthread_join(thread_id[thread_index], NULL);
+            }
+            run_time[use_lock] = bench_time_now() - time_start;
+            lockfree_list_destroy(list_ptr);
+        }
+
+        printf("threads: %3zu   lock-free: %8.3f Mops/s   global mutex: %8.3f Mops/s\n", thread_count,
+               (BENCH_LOCKFREE_OPERATIONS / run_time[0]) / 1e6, (BENCH_LOCKFREE_OPERATIONS / run_time[1]) / 1e6);
+    }
+
+    free(list_ptr);
+}
+
+static void* bench_lockfree_thread(void* thread_arg)
+{
+    bench_thread_arg_t* arg_ptr = (bench_thread_arg_t*)thread_arg;
+    unsigned int random_state = arg_ptr->random_state;
+    unsigned int operation_index = 0;
+    unsigned int operation_kind = 0;
+    size_t thread_slot = 0;
+    int key = 0;
+    long long found_count = 0;
+
+    lockfree_list_thread_attach(arg_ptr->list_ptr, &thread_slot);
+    for(operation_index = 0; operation_index < arg_ptr->operation_count; operation_index++)
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        key = (int)((random_state >> 8) % BENCH_LOCKFREE_KEY_RANGE);
+        operation_kind = (random_state >> 24) % 10u;
+
+        if(NULL != arg_ptr->global_lock_ptr)
+        {
+            pthread_mutex_lock(arg_ptr->global_lock_ptr);
+        }
+        if(0u == operation_kind)
+        {
+            lockfree_list_insert(arg_ptr->list_ptr, thread_slot, key);
+        }
+        else if(1u == operation_kind)
+        {
+            lockfree_list_delete(arg_ptr->list_ptr, thread_slot, key);
+        }
+        else if(LINKEDLIST_OP_SUCCESS == lockfree_list_contains(arg_ptr->list_ptr, thread_slot, key))
+        {
+            found_count = found_count + 1;
+        }
+        else
+        {
+            /** Key not found **/
+        }
+        if(NULL != arg_ptr->global_lock_ptr)
+        {
+            pthread_mutex_unlock(arg_ptr->global_lock_ptr);
+        }
+    }
+    lockfree_list_thread_detach(arg_ptr->list_ptr, thread_slot);
+    bench_sink = found_count;
+
+    return NULL;
+}
+
+/** Measures the throughput of the hand-over-hand locking list against the handle based functions behind a single
+    global mutex, from 1 thread up to the thread count given as option. Operations are get, insert and delete at
+    random indexes, on a read mostly and on a write heavy workload. **/
+static void bench_hoh(void)
+{
+    hoh_list_t hoh_list;
+    linkedlist_t node_list;
+    pthread_mutex_t global_lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_t thread_id[BENCH_LOCKFREE_MAX_THREADS];
+    bench_hoh_arg_t thread_arg[BENCH_LOCKFREE_MAX_THREADS];
+    const unsigned int write_percent[2] = {10u, 50u};
+    size_t thread_limit = BENCH_HOH_DEFAULT_THREADS;
+    size_t thread_count = 0;
+    size_t thread_index = 0;
+    size_t workload_index = 0;
+    unsigned int element_index = 0;
+    int use_lock = 0;
+    double time_start = 0.0;
+    double run_time[2] = {0.0};
+
+    if(NULL != bench_option)
+    {
+        thread_limit = (size_t)strtoull(bench_option, NULL, 10);
+    }
+    if((0u == thread_limit) || (thread_limit > BENCH_LOCKFREE_MAX_THREADS))
+    {
+        thread_limit = BENCH_HOH_DEFAULT_THREADS;
+    }
+
+    printf("operations: %u, elements: %u\n", BENCH_HOH_OPERATIONS, BENCH_HOH_ELEMENTS);
+    for(workload_index = 0; workload_index < 2u; workload_index++)
+    {
+        printf("writes: %u%%\n", write_percent[workload_index]);
+        for(thread_count = 1; thread_count <= thread_limit; thread_count = thread_count * 2u)
+        {
+            for(use_lock = 0; use_lock < 2; use_lock++)
+            {
+                /** Start every run from the same list **/
+                hoh_list_init(&hoh_list);
+                linkedlist_handle_init(&node_list);
+                for(element_index = 0; element_index < BENCH_HOH_ELEMENTS; element_index++)
+                {
+                    if(0 != use_lock)
+                    {
+                        linkedlist_handle_insert_end(&node_list, (int)element_index);
+                    }
+                    else
+                    {
+                        hoh_list_insert_end(&hoh_list, (int)element_index);
+                    }
+                }
+
+                time_start = bench_time_now();
+                for(thread_index = 0; thread_index < thread_count; thread_index++)
+                {
+                    thread_arg[thread_index].hoh_list_ptr = (0 != use_lock) ? NULL : &hoh_list;
+                    thread_arg[thread_index].node_list_ptr = &node_list;
+                    thread_arg[thread_index].global_lock_ptr = &global_lock;
+                    thread_arg[thread_index].operation_count = BENCH_HOH_OPERATIONS / (unsigned int)thread_count;
+                    thread_arg[thread_index].write_percent = write_percent[workload_index];
+                    thread_arg[thread_index].random_state = 12345u + (unsigned int)thread_index;
+                    pthread_create(&thread_id[thread_index], NULL, bench_hoh_thread, &thread_arg[thread_index]);
+                }
+                for(thread_index = 0; thread_index < thread_count; thread_index++)
+                {
+                    pthread_join(thread_id[thread_index], NULL);
+                }
+                run_time[use_lock] = bench_time_now() - time_start;
+
+                hoh_list_destroy(&hoh_list);
+                linkedlist_handle_delete_all(&node_list);
+            }
+
+            printf("threads: %3zu   hand-over-hand: %8.3f Kops/s   global mutex: %8.3f Kops/s\n", thread_count,
+                   (BENCH_HOH_OPERATIONS / run_time[0]) / 1e3, (BENCH_HOH_OPERATIONS / run_time[1]) / 1e3);
+        }
+    }
+}
+
+static void* bench_hoh_thread(void* thread_arg)
+{
+    bench_hoh_arg_t* arg_ptr = (bench_hoh_arg_t*)thread_arg;
+    unsigned int random_state = arg_ptr->random_state;
+    unsigned int operation_index = 0;
+    unsigned int operation_kind = 0;
+    size_t node_index = 0;
+    long long data_sum = 0;
+    int data = 0;
+
+    for(operation_index = 0; operation_index < arg_ptr->operation_count; operation_index++)
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        node_index = (size_t)((random_state >> 8) % BENCH_HOH_ELEMENTS);
+        operation_kind = (random_state >> 24) % 100u;
+
+        if(NULL != arg_ptr->hoh_list_ptr)
+        {
+            /** Writes are split evenly between inserts and deletes, so the list keeps about the same size **/
+            if(operation_kind < (arg_ptr->write_percent / 2u))
+            {
+                hoh_list_insert_index(arg_ptr->hoh_list_ptr, node_index, (int)operation_index);
+            }
+            else if(operation_kind < arg_ptr->write_percent)
+            {
+                hoh_list_delete_index(arg_ptr->hoh_list_ptr, node_index);
+            }
+            else if(LINKEDLIST_OP_SUCCESS == hoh_list_get_index(arg_ptr->hoh_list_ptr, node_index, &data))
+            {
+                data_sum += data;
+            }
+            else
+            {
+                /** Index out of range **/
+            }
+        }
+        else
+        {
+            pthread_mutex_lock(arg_ptr->global_lock_ptr);
+            if(operation_kind < (arg_ptr->write_percent / 2u))
+            {
+                linkedlist_handle_insert_index(arg_ptr->node_list_ptr, node_index, (int)operation_index);
+            }
+            else if(operation_kind < arg_ptr->write_percent)
+            {
+                linkedlist_handle_delete_index(arg_ptr->node_list_ptr, node_index);
+            }
+            else if(LINKEDLIST_OP_SUCCESS == linkedlist_handle_get_index(arg_ptr->node_list_ptr, node_index, &data))
+            {
+                data_sum += data;
+            }
+            else
+            {
+                /** Index out of range **/
+            }
+            pthread_mutex_unlock(arg_ptr->global_lock_ptr);
+        }
+    }
+    bench_sink = data_sum;
+
+    return NULL;
+}
+
+/** Measures linkedlist_sort() against copying the elements out, sorting them with qsort() and writing them back, at
+    10^6 nodes and every power of 10 up to the size given as option, then merge and dedup of sorted lists **/
+static void bench_sort(void)
+{
+    linkedlist_t node_list;
+    linkedlist_t node_list_other;
+    struct node_t* node_current = NULL;
+    int* data_array = NULL;
+    size_t size_limit = BENCH_SORT_DEFAULT_LIMIT;
+    size_t list_size = 0;
+    size_t element_index = 0;
+    unsigned int random_state = 12345u;
+    double time_start = 0.0;
+    double sort_time = 0.0;
+    double qsort_time = 0.0;
+    double merge_time = 0.0;
+    double dedup_time = 0.0;
+
+    if(NULL != bench_option)
+    {
+        size_limit = (size_t)strtoull(bench_option, NULL, 10);
+    }
+
+    for(list_size = BENCH_SORT_FIRST_SIZE; list_size <= size_limit; list_size = list_size * 10u)
+    {
+        data_array = (int*)malloc(list_size * sizeof(int));
+        if(NULL == data_array)
+        {
+            printf("array of %zu elements couldn't be allocated\n", list_size);
+            break;
+        }
+        linkedlist_handle_init(&node_list);
+        linkedlist_handle_init(&node_list_other);
+        for(element_index = 0; element_index < list_size; element_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            linkedlist_handle_insert_end(&node_list, (int)(random_state >> 4));
+            linkedlist_handle_insert_end(&node_list_other, (int)(random_state >> 4));
+        }
+
+        time_start = bench_time_now();
+        linkedlist_sort(&node_list);
+        sort_time = bench_time_now() - time_start;
+
+        /** Copy out, sort and write back, walking the nodes so no O(n^2) indexed access is measured **/
+        time_start = bench_time_now();
+        element_index = 0;
+        for(node_current = node_list_other.head_node_ptr; NULL != node_current;
+            node_current = node_current->next_node_address_ptr)
+        {
+            data_array[element_index] = node_current->data;
+            element_index = element_index + 1;
+        }
+        qsort(data_array, list_size, sizeof(int), bench_int_compare);
+        element_index = 0;
+        for(node_current = node_list_other.head_node_ptr; NULL != node_current;
+            node_current = node_current->next_node_address_ptr)
+        {
+            node_current->data = data_array[element_index];
+            element_index = element_index + 1;
+        }
+        qsort_time = bench_time_now() - time_start;
+
+        time_start = bench_time_now();
+        linkedlist_merge(&node_list, &node_list_other);
+        merge_time = bench_time_now() - time_start;
+
+        /** Every element is in the merged list twice **/
+        time_start = bench_time_now();
+        linkedlist_dedup(&node_list);
+        dedup_time = bench_time_now() - time_start;
+
+        printf("size: %9zu   sort: %8.3f s   copy+qsort: %8.3f s   merge: %8.3f s   dedup: %8.3f s\n", list_size,
+               sort_time, qsort_time, merge_time, dedup_time);
+
+        linkedlist_handle_delete_all(&node_list);
+        free(data_array);
+    }
+}
+
+static int bench_int_compare(const void* value_a, const void* value_b)
+{
+    int data_a = *(const int*)value_a;
+    int data_b = *(const int*)value_b;
+
+    return (data_a > data_b) - (data_a < data_b);
+}
+
+/** Scatters the nodes of a list by sorting it on random values, then measures traversal before and after
+    linkedlist_compact(), for a pool based list and for a list of nodes allocated one by one **/
+static void bench_compact(void)
+{
+    linkedlist_t node_list;
+    linkedlist_pool_t node_pool;
+    unsigned int element_index = 0;
+    unsigned int random_state = 12345u;
+    int use_pool = 0;
+    double stride_before = 0.0;
+    double traversal_before = 0.0;
+    double time_start = 0.0;
+    double compact_time = 0.0;
+
+    printf("elements: %u\n", BENCH_COMPACT_ELEMENTS);
+    for(use_pool = 0; use_pool < 2; use_pool++)
+    {
+        linkedlist_pool_init(&node_pool, 0);
+        linkedlist_handle_init(&node_list);
+        if(0 != use_pool)
+        {
+            linkedlist_handle_pool_set(&node_list, &node_pool);
+        }
+        for(element_index = 0; element_index < BENCH_COMPACT_ELEMENTS; element_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            linkedlist_handle_insert_end(&node_list, (int)(random_state >> 4));
+        }
+        /** Relinking in value order leaves consecutive nodes at random places of the heap **/
+        linkedlist_sort(&node_list);
+
+        stride_before = linkedlist_stride_average(&node_list);
+        traversal_before = bench_traversal_time(&node_list);
+
+        time_start = bench_time_now();
+        linkedlist_compact(&node_list);
+        compact_time = bench_time_now() - time_start;
+
+        printf("%-8s  stride: %12.1f -> %8.1f bytes   traversal: %8.3f -> %8.3f ns/node   compact: %8.3f s\n",
+               (0 != use_pool) ? "pool" : "malloc", stride_before, linkedlist_stride_average(&node_list),
+               traversal_before, bench_traversal_time(&node_list), compact_time);
+
+        linkedlist_handle_delete_all(&node_list);
+        linkedlist_pool_destroy(&node_pool);
+    }
+}
+
+/** Returns the time to visit one node, averaged over several traversals of the whole list **/
+static double bench_traversal_time(linkedlist_t* list)
+{
+    struct node_t* node_current = NULL;
+    unsigned int pass_index = 0;
+    long long data_sum = 0;
+    double time_start = bench_time_now();
+
+    for(pass_index = 0; pass_index < BENCH_COMPACT_PASSES; pass_index++)
+    {
+        for(node_current = list->head_node_ptr; NULL != node_current;
+            node_current = node_current->next_node_address_ptr)
+        {
+            data_sum += node_current->data;
+        }
+    }
+    bench_sink = data_sum;
+
+    return ((bench_time_now() - time_start) * 1e9) / ((double)list->node_count * BENCH_COMPACT_PASSES);
+}
+
+/** Scatters the nodes of a list much larger than the last level cache by sorting it on random values, then compares
+    the traversal modes on a full traversal, on reading random indexes and on freeing the list. The option sets the
+    number of elements. **/
+static void bench_traversal(void)
+{
+    static const char* mode_names[] = {"plain", "prefetch", "jump"};
+    linkedlist_t node_list;
+    size_t element_count = BENCH_TRAVERSAL_ELEMENTS;
+    size_t element_index = 0;
+    unsigned int random_state = 12345u;
+    unsigned int lookup_index = 0;
+    int mode_index = 0;
+    int data = 0;
+    long long data_sum = 0;
+    double time_start = 0.0;
+    double for_each_first = 0.0;
+    double for_each_time = 0.0;
+    double lookup_time = 0.0;
+    double delete_time = 0.0;
+
+    if(NULL != bench_option)
+    {
+        element_count = (size_t)strtoull(bench_option, NULL, 10);
+    }
+
+    printf("elements: %lu   node memory: %lu MiB\n", (unsigned long)element_count,
+           (unsigned long)((element_count * sizeof(struct node_t)) >> 20));
+    for(mode_index = 0; mode_index < 3; mode_index++)
+    {
+        linkedlist_handle_init(&node_list);
+        linkedlist_traversal_set(&node_list, (linkedlist_traversal_t)mode_index);
+        random_state = 12345u;
+        for(element_index = 0; element_index < element_count; element_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            linkedlist_handle_insert_end(&node_list, (int)(random_state >> 4));
+        }
+        /** Relinking in value order leaves consecutive nodes at random places of the heap **/
+        linkedlist_sort(&node_list);
+
+        /** The first pass of the jump mode also rebuilds the jump table after sorting **/
+        data_sum = 0;
+        time_start = bench_time_now();
+        linkedlist_for_each(&node_list, bench_traversal_visit, &data_sum);
+        for_each_first = bench_time_now() - time_start;
+        time_start = bench_time_now();
+        linkedlist_for_each(&node_list, bench_traversal_visit, &data_sum);
+        for_each_time = bench_time_now() - time_start;
+
+        time_start = bench_time_now();
+        for(lookup_index = 0; lookup_index < BENCH_TRAVERSAL_LOOKUPS; lookup_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            linkedlist_handle_get_index(&node_list, (size_t)random_state % element_count, &data);
+            data_sum += data;
+        }
+        lookup_time = bench_time_now() - time_start;
+        bench_sink = data_sum;
+
+        time_start = bench_time_now();
+        linkedlist_handle_delete_all(&node_list);
+        delete_time = bench_time_now() - time_start;
+
+        printf("%-8s  for_each: %8.3f (first pass %8.3f) ns/node   get_index: %12.3f us   delete_all: %8.3f ns/node\n",
+               mode_names[mode_index], (for_each_time * 1e9) / (double)element_count,
+               (for_each_first * 1e9) / (double)element_count,
+               (lookup_time * 1e6) / BENCH_TRAVERSAL_LOOKUPS, (delete_time * 1e9) / (double)element_count);
+    }
+}
+
+/** Adds every element to the sum given as context **/
+static void bench_traversal_visit(int data, void* context)
+{
+    *(long long*)context += data;
+}
+
+/** Compares rebuilding a list from a text file, one insert per element, with loading it from a snapshot file into a
+    plain and a pool based list. The option sets the number of elements. **/
+static void bench_snapshot(void)
+{
+    static const char text_path[] = "bench_snapshot.txt";
+    static const char snapshot_path[] = "bench_snapshot.bin";
+    linkedlist_t node_list;
+    linkedlist_pool_t node_pool;
+    struct node_t* node_current = NULL;
+    FILE* text_file = NULL;
+    size_t element_count = BENCH_SNAPSHOT_ELEMENTS;
+    size_t element_index = 0;
+    unsigned int random_state = 12345u;
+    int data = 0;
+    double time_start = 0.0;
+    double write_time = 0.0;
+
+    if(NULL != bench_option)
+    {
+        element_count = (size_t)strtoull(bench_option, NULL, 10);
+    }
+
+    linkedlist_handle_init(&node_list);
+    for(element_index = 0; element_index < element_count; element_index++)
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        linkedlist_handle_insert_end(&node_list, (int)(random_state >> 4));
+    }
+    text_file = fopen(text_path, "w");
+    if(NULL == text_file)
+    {
+        printf("can't create %s\n", text_path);
+        linkedlist_handle_delete_all(&node_list);
+        return;
+    }
+    for(node_current = node_list.head_node_ptr; NULL != node_current;
+        node_current = node_current->next_node_address_ptr)
+    {
+        fprintf(text_file, "%d\n", node_current->data);
+    }
+    fclose(text_file);
+
+    time_start = bench_time_now();
+    linkedlist_snapshot_write(&node_list, snapshot_path);
+    write_time = bench_time_now() - time_start;
+    linkedlist_handle_delete_all(&node_list);
+    printf("elements: %lu   snapshot write: %8.3f s\n", (unsigned long)element_count, write_time);
+
+    /** Rebuild from text, one parse and one insert per element **/
+    time_start = bench_time_now();
+    text_file = fopen(text_path, "r");
+    while((NULL != text_file) && (1 == fscanf(text_file, "%d", &data)))
+    {
+        linkedlist_handle_insert_end(&node_list, data);
+    }
+    if(NULL != text_file)
+    {
+        fclose(text_file);
+    }
+    printf("text + insert_end      : %8.3f s   (%lu elements)\n", bench_time_now() - time_start,
+           (unsigned long)linkedlist_handle_size(&node_list));
+    linkedlist_handle_delete_all(&node_list);
+
+    time_start = bench_time_now();
+    linkedlist_snapshot_load(&node_list, snapshot_path);
+    printf("snapshot load, malloc  : %8.3f s   (%lu elements)\n", bench_time_now() - time_start,
+           (unsigned long)linkedlist_handle_size(&node_list));
+    linkedlist_handle_delete_all(&node_list);
+
+    /** Nodes of a pool based list are taken as one run of the pool **/
+    linkedlist_pool_init(&node_pool, 0);
+    linkedlist_handle_pool_set(&node_list, &node_pool);
+    time_start = bench_time_now();
+    linkedlist_snapshot_load(&node_list, snapshot_path);
+    printf("snapshot load, pool    : %8.3f s   (%lu elements)\n", bench_time_now() - time_start,
+           (unsigned long)linkedlist_handle_size(&node_list));
+    linkedlist_handle_delete_all(&node_list);
+    linkedlist_pool_destroy(&node_pool);
+
+    remove(text_path);
+    remove(snapshot_path);
+}
+
+/** Runs a mixed workload and prints its time, run it once built with "STATS=0" and once with "STATS=1" to see the
+    instrumentation overhead. With the instrumentation built in, its counters are printed as JSON. **/
+static void bench_stats(void)
+{
+    linkedlist_t node_list;
+    linkedlist_stats_t list_stats;
+    unsigned int element_index = 0;
+    unsigned int random_state = 12345u;
+    int data = 0;
+    long long data_sum = 0;
+    double time_start = 0.0;
+
+    linkedlist_stats_reset();
+    linkedlist_handle_init(&node_list);
+
+    time_start = bench_time_now();
+    for(element_index = 0; element_index < BENCH_STATS_ELEMENTS; element_index++)
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        linkedlist_handle_insert_end(&node_list, (int)(random_state >> 4));
+    }
+    for(element_index = 0; element_index < BENCH_STATS_LOOKUPS; element_index++)
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        linkedlist_handle_get_index(&node_list, random_state % BENCH_STATS_LOOKUP_RANGE, &data);
+        data_sum += data;
+    }
+    linkedlist_sort(&node_list);
+    linkedlist_dedup(&node_list);
+    linkedlist_truncate(&node_list, BENCH_STATS_ELEMENTS / 2u);
+    linkedlist_handle_delete_all(&node_list);
+    bench_sink = data_sum;
+
+    printf("workload: %8.3f s   instrumentation: %s\n", bench_time_now() - time_start,
+           (LINKEDLIST_OP_SUCCESS == linkedlist_stats_get(&list_stats)) ? "built in" : "compiled out");
+    if(LINKEDLIST_OP_SUCCESS == linkedlist_stats_get(&list_stats))
+    {
+        linkedlist_stats_dump_json(stdout);
+    }
+}
+
+/** Compares summing and counting a scattered list on one thread with the parallel reductions, from 1 pool thread up
+    to the thread count given as option. The parts are found with a single pass over the plain list, and with the
+    stored jump table of a list in jump mode. **/
+static void bench_parallel(void)
+{
+    static const char* mode_names[] = {"plain", "jump"};
+    linkedlist_t node_list;
+    linkedlist_thread_pool_t thread_pool;
+    struct node_t* node_current = NULL;
+    size_t thread_limit = BENCH_PARALLEL_MAX_THREADS;
+    size_t thread_count = 0;
+    size_t match_count = 0;
+    size_t serial_count = 0;
+    unsigned int element_index = 0;
+    unsigned int random_state = 12345u;
+    unsigned int pass_index = 0;
+    int mode_index = 0;
+    long long data_sum = 0;
+    long long serial_sum = 0;
+    double time_start = 0.0;
+    double serial_time = 0.0;
+    double parallel_time = 0.0;
+
+    if(NULL != bench_option)
+    {
+        thread_limit = (size_t)strtoull(bench_option, NULL, 10);
+    }
+    if((0u == thread_limit) || (thread_limit > LINKEDLIST_PARALLEL_MAX_THREADS))
+    {
+        thread_limit = BENCH_PARALLEL_MAX_THREADS;
+    }
+
+    linkedlist_handle_init(&node_list);
+    for(element_index = 0; element_index < BENCH_PARALLEL_ELEMENTS; element_index++)
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        linkedlist_handle_insert_end(&node_list, (int)(random_state >> 4));
+    }
+    /** Relinking in value order leaves consecutive nodes at random places of the heap **/
+    linkedlist_sort(&node_list);
+
+    time_start = bench_time_now();
+    for(pass_index = 0; pass_index < BENCH_PARALLEL_PASSES; pass_index++)
+    {
+        /** Two passes, like the two reductions they are compared with **/
+        serial_sum = 0;
+        serial_count = 0;
+        for(node_current = node_list.head_node_ptr; NULL != node_current;
+            node_current = node_current->next_node_address_ptr)
+        {
+            serial_sum += node_current->data;
+        }
+        for(node_current = node_list.head_node_ptr; NULL != node_current;
+            node_current = node_current->next_node_address_ptr)
+        {
+            serial_count += (size_t)bench_parallel_odd(node_current->data, NULL);
+        }
+    }
+    serial_time = (bench_time_now() - time_start) / BENCH_PARALLEL_PASSES;
+
+    printf("elements: %u   serial sum + count_if: %8.3f ms\n", BENCH_PARALLEL_ELEMENTS, serial_time * 1e3);
+    for(mode_index = 0; mode_index < 2; mode_index++)
+    {
+        linkedlist_traversal_set(&node_list,
+                                 (0 == mode_index) ? LINKEDLIST_TRAVERSAL_PLAIN : LINKEDLIST_TRAVERSAL_JUMP);
+        for(thread_count = 1; thread_count <= thread_limit; thread_count = thread_count * 2u)
+        {
+            linkedlist_thread_pool_init(&thread_pool, thread_count);
+            /** The first jump mode reduction builds the jump table, it is kept for all the later ones **/
+            linkedlist_parallel_sum(&thread_pool, &node_list, &data_sum);
+
+            time_start = bench_time_now();
+            for(pass_index = 0; pass_index < BENCH_PARALLEL_PASSES; pass_index++)
+            {
+                linkedlist_parallel_sum(&thread_pool, &node_list, &data_sum);
+                linkedlist_parallel_count_if(&thread_pool, &node_list, bench_parallel_odd, NULL, &match_count);
+            }
+            parallel_time = (bench_time_now() - time_start) / BENCH_PARALLEL_PASSES;
+            linkedlist_thread_pool_destroy(&thread_pool);
+
+            printf("%-5s  threads: %3zu   sum + count_if: %8.3f ms   speedup: %6.2fx   %s\n", mode_names[mode_index],
+                   thread_count, parallel_time * 1e3, serial_time / parallel_time,
+                   ((data_sum == serial_sum) && (match_count == serial_count)) ? "same result" : "RESULT DIFFERS");
+        }
+    }
+    bench_sink = data_sum;
+
+    linkedlist_handle_delete_all(&node_list);
+}
+
+/** Counts the odd elements **/
+static int bench_parallel_odd(int data, void* context)
+{
+    (void)context;
+    return (0 != (data & 1)) ? 1 : 0;
+}
+
+/** Compares searching for a value with the handle based list, with an element by element loop over the blocks of an
+    unrolled list and with the unrolled list search, which compares several elements at a time. index_of searches
+    for a value that isn't in the list, so every search reads the whole list. **/
+static void bench_search(void)
+{
+    linkedlist_t node_list;
+    unrolled_list_t unrolled_list;
+    struct unrolled_node_t* block_current = NULL;
+    unsigned int element_index = 0;
+    unsigned int block_offset = 0;
+    unsigned int pass_index = 0;
+    unsigned int random_state = 12345u;
+    size_t match_count = 0;
+    size_t element_found = 0;
+    size_t count_total[3] = {0u};
+    int data = 0;
+    double time_start = 0.0;
+    double count_time[3] = {0.0};
+    double index_time[3] = {0.0};
+
+    linkedlist_handle_init(&node_list);
+    unrolled_list_init(&unrolled_list);
+    for(element_index = 0; element_index < BENCH_SEARCH_ELEMENTS; element_index++)
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        linkedlist_handle_insert_end(&node_list, (int)((random_state >> 8) % BENCH_SEARCH_VALUE_RANGE));
+        unrolled_list_insert_end(&unrolled_list, (int)((random_state >> 8) % BENCH_SEARCH_VALUE_RANGE));
+    }
+
+    for(pass_index = 0; pass_index < BENCH_SEARCH_PASSES; pass_index++)
+    {
+        data = (int)pass_index;
+
+        time_start = bench_time_now();
+        linkedlist_count_of(&node_list, data, &match_count);
+        count_time[0] += bench_time_now() - time_start;
+        count_total[0] += match_count;
+
+        time_start = bench_time_now();
+        match_count = 0;
+        for(block_current = unrolled_list.head_node_ptr; NULL != block_current;
+            block_current = block_current->next_node_address_ptr)
+        {
+            for(block_offset = 0; block_offset < block_current->element_count; block_offset++)
+            {
+                match_count += (data == block_current->data[block_offset]) ? 1u : 0u;
+            }
+        }
+        count_time[1] += bench_time_now() - time_start;
+        count_total[1] += match_count;
+
+        time_start = bench_time_now();
+        unrolled_list_count_of(&unrolled_list, data, &match_count);
+        count_time[2] += bench_time_now() - time_start;
+        count_total[2] += match_count;
+
+        data = -1 - (int)pass_index;
+
+        time_start = bench_time_now();
+        element_found += (LINKEDLIST_OP_SUCCESS == linkedlist_index_of(&node_list, data, &match_count)) ? 1u : 0u;
+        index_time[0] += bench_time_now() - time_start;
+
+        time_start = bench_time_now();
+        for(block_current = unrolled_list.head_node_ptr; NULL != block_current;
+            block_current = block_current->next_node_address_ptr)
+        {
+            for(block_offset = 0; block_offset < block_current->element_count; block_offset++)
+            {
+                element_found += (data == block_current->data[block_offset]) ? 1u : 0u;
+            }
+        }
+        index_time[1] += bench_time_now() - time_start;
+
+        time_start = bench_time_now();
+        element_found += (LINKEDLIST_OP_SUCCESS == unrolled_list_index_of(&unrolled_list, data, &match_count)) ?
+                         1u : 0u;
+        index_time[2] += bench_time_now() - time_start;
+    }
+    bench_sink = (long long)element_found;
+
+    printf("elements: %u   values: 0..%u\n", BENCH_SEARCH_ELEMENTS, BENCH_SEARCH_VALUE_RANGE - 1u);
+    printf("linkedlist          count_of: %8.3f ns/element   index_of: %8.3f ns/element\n",
+           (count_time[0] * 1e9) / ((double)BENCH_SEARCH_ELEMENTS * BENCH_SEARCH_PASSES),
+           (index_time[0] * 1e9) / ((double)BENCH_SEARCH_ELEMENTS * BENCH_SEARCH_PASSES));
+    printf("unrolled, scalar    count_of: %8.3f ns/element   index_of: %8.3f ns/element\n",
+           (count_time[1] * 1e9) / ((double)BENCH_SEARCH_ELEMENTS * BENCH_SEARCH_PASSES),
+           (index_time[1] * 1e9) / ((double)BENCH_SEARCH_ELEMENTS * BENCH_SEARCH_PASSES));
+    printf("unrolled, vector    count_of: %8.3f ns/element   index_of: %8.3f ns/element   %s\n",
+           (count_time[2] * 1e9) / ((double)BENCH_SEARCH_ELEMENTS * BENCH_SEARCH_PASSES),
+           (index_time[2] * 1e9) / ((double)BENCH_SEARCH_ELEMENTS * BENCH_SEARCH_PASSES),
+           ((count_total[0] == count_total[1]) && (count_total[1] == count_total[2]) && (0u == element_found)) ?
+           "same result" : "RESULT DIFFERS");
+
+    linkedlist_handle_delete_all(&node_list);
+    unrolled_list_delete_all(&unrolled_list);
+}
+
+/** Compares taking a consistent view of a list by copying it behind a mutex with taking a snapshot of a persistent
+    list, first alone for growing list sizes, then with one thread appending while reader threads keep taking views.
+    The option sets the number of reader threads. **/
+static void bench_persistent(void)
+{
+    persistent_list_t persistent_list;
+    persistent_snapshot_t list_snapshot;
+    linkedlist_t node_list;
+    linkedlist_t node_copy;
+    pthread_mutex_t global_lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_t thread_id[BENCH_PERSISTENT_MAX_READERS];
+    bench_persistent_arg_t thread_arg[BENCH_PERSISTENT_MAX_READERS];
+    atomic_int writer_done;
+    size_t reader_count = BENCH_PERSISTENT_READERS;
+    size_t thread_index = 0;
+    size_t list_size = 0;
+    size_t element_index = 0;
+    unsigned int snapshot_index = 0;
+    unsigned long snapshot_total = 0;
+    unsigned long error_total = 0;
+    int use_persistent = 0;
+    double time_start = 0.0;
+    double copy_time = 0.0;
+    double snapshot_time = 0.0;
+    double append_time = 0.0;
+
+    if(NULL != bench_option)
+    {
+        reader_count = (size_t)strtoull(bench_option, NULL, 10);
+    }
+    if((0u == reader_count) || (reader_count > BENCH_PERSISTENT_MAX_READERS))
+    {
+        reader_count = BENCH_PERSISTENT_READERS;
+    }
+
+    persistent_list_init(&persistent_list);
+    linkedlist_handle_init(&node_list);
+    for(list_size = BENCH_PERSISTENT_FIRST_SIZE; list_size <= BENCH_PERSISTENT_LAST_SIZE; list_size = list_size * 10u)
+    {
+        for(; element_index < list_size; element_index++)
+        {
+            persistent_list_insert_end(&persistent_list, (int)element_index);
+            linkedlist_handle_insert_end(&node_list, (int)element_index);
+        }
+
+        time_start = bench_time_now();
+        for(snapshot_index = 0; snapshot_index < BENCH_PERSISTENT_SNAPSHOTS; snapshot_index++)
+        {
+            pthread_mutex_lock(&global_lock);
+            bench_persistent_copy(&node_list, &node_copy);
+            pthread_mutex_unlock(&global_lock);
+            linkedlist_handle_delete_all(&node_copy);
+        }
+        copy_time = (bench_time_now() - time_start) / BENCH_PERSISTENT_SNAPSHOTS;
+
+        time_start = bench_time_now();
+        for(snapshot_index = 0; snapshot_index < BENCH_PERSISTENT_SNAPSHOTS; snapshot_index++)
+        {
+            persistent_list_snapshot(&persistent_list, &list_snapshot);
+            persistent_snapshot_release(&list_snapshot);
+        }
+        snapshot_time = (bench_time_now() - time_start) / BENCH_PERSISTENT_SNAPSHOTS;
+
+        printf("elements: %8lu   copy behind mutex: %12.3f us   persistent snapshot: %8.3f us\n",
+               (unsigned long)list_size, copy_time * 1e6, snapshot_time * 1e6);
+    }
+    persistent_list_destroy(&persistent_list);
+    linkedlist_handle_delete_all(&node_list);
+
+    printf("appends: %u   reader threads: %lu\n", BENCH_PERSISTENT_APPENDS, (unsigned long)reader_count);
+    for(use_persistent = 0; use_persistent < 2; use_persistent++)
+    {
+        persistent_list_init(&persistent_list);
+        linkedlist_handle_init(&node_list);
+        atomic_init(&writer_done, 0);
+        for(thread_index = 0; thread_index < reader_count; thread_index++)
+        {
+            thread_arg[thread_index].persistent_list_ptr = (0 != use_persistent) ? &persistent_list : NULL;
+            thread_arg[thread_index].node_list_ptr = &node_list;
+            thread_arg[thread_index].global_lock_ptr = &global_lock;
+            thread_arg[thread_index].writer_done_ptr = &writer_done;
+            thread_arg[thread_index].snapshot_count = 0;
+            thread_arg[thread_index].snapshot_errors = 0;
+            pthread_create(&thread_id[thread_index], NULL, bench_persistent_reader, &thread_arg[thread_index]);
+        }
+
+        time_start = bench_time_now();
+        for(element_index = 0; element_index < BENCH_PERSISTENT_APPENDS; element_index++)
+        {
+            if(0 != use_persistent)
+            {
+                persistent_list_insert_end(&persistent_list, (int)element_index);
+            }
+            else
+            {
+                pthread_mutex_lock(&global_lock);
+                linkedlist_handle_insert_end(&node_list, (int)element_index);
+                pthread_mutex_unlock(&global_lock);
+            }
+        }
+        append_time = bench_time_now() - time_start;
+        atomic_store(&writer_done, 1);
+
+        snapshot_total = 0;
+        error_total = 0;
+        for(thread_index = 0; thread_index < reader_count; thread_index++)
+        {
+            pthread_join(thread_id[thread_index], NULL);
+            snapshot_total += thread_arg[thread_index].snapshot_count;
+            error_total += thread_arg[thread_index].snapshot_errors;
+        }
+        persistent_list_destroy(&persistent_list);
+        linkedlist_handle_delete_all(&node_list);
+
+        printf("%-20s  appends: %10.3f Mops/s   views taken: %10lu   inconsistent views: %lu\n",
+               (0 != use_persistent) ? "persistent snapshot" : "copy behind mutex",
+               (BENCH_PERSISTENT_APPENDS / append_time) / 1e6, snapshot_total, error_total);
+    }
+}
+
+/** Keeps taking views of the list until the writer is done. The writer appends 0, 1, 2..., so the last element of a
+    consistent view is its size minus 1. **/
+static void* bench_persistent_reader(void* thread_arg)
+{
+    bench_persistent_arg_t* reader_arg = (bench_persistent_arg_t*)thread_arg;
+    persistent_snapshot_t list_snapshot;
+    linkedlist_t node_copy;
+    int data = 0;
+
+    while(0 == atomic_load(reader_arg->writer_done_ptr))
+    {
+        if(NULL != reader_arg->persistent_list_ptr)
+        {
+            persistent_list_snapshot(reader_arg->persistent_list_ptr, &list_snapshot);
+            if((LINKEDLIST_OP_SUCCESS == persistent_snapshot_get_end(&list_snapshot, &data)) &&
+               ((size_t)data != (persistent_snapshot_size(&list_snapshot) - 1u)))
+            {
+                reader_arg->snapshot_errors++;
+            }
+            persistent_snapshot_release(&list_snapshot);
+        }
+        else
+        {
+            pthread_mutex_lock(reader_arg->global_lock_ptr);
+            bench_persistent_copy(reader_arg->node_list_ptr, &node_copy);
+            pthread_mutex_unlock(reader_arg->global_lock_ptr);
+            if((LINKEDLIST_OP_SUCCESS == linkedlist_handle_get_end(&node_copy, &data)) &&
+               ((size_t)data != (node_copy.node_count - 1u)))
+            {
+                reader_arg->snapshot_errors++;
+            }
+            linkedlist_handle_delete_all(&node_copy);
+        }
+        reader_arg->snapshot_count++;
+    }
+
+    return NULL;
+}
+
+/** Copies every element of list_source to the new list list_copy **/
+static void bench_persistent_copy(linkedlist_t* list_source, linkedlist_t* list_copy)
+{
+    struct node_t* node_current = NULL;
+
+    linkedlist_handle_init(list_copy);
+    for(node_current = list_source->head_node_ptr; NULL != node_current;
+        node_current = node_current->next_node_address_ptr)
+    {
+        linkedlist_handle_insert_end(list_copy, node_current->data);
+    }
+}
+
+/** Compares moving a run of elements from the middle of a list to the end of another one, and appending a whole list
+    to another one, by copying every element with a cursor, with moving the nodes themselves. Reversing the list is
+    timed as well. **/
+static void bench_splice(void)
+{
+    linkedlist_t node_list;
+    linkedlist_t node_target;
+    linkedlist_cursor_t list_cursor;
+    size_t element_index = 0;
+    int data = 0;
+    double time_start = 0.0;
+    double copy_time[2] = {0.0};
+    double move_time[2] = {0.0};
+    double reverse_time = 0.0;
+
+    linkedlist_handle_init(&node_list);
+    linkedlist_handle_init(&node_target);
+    for(element_index = 0; element_index < BENCH_SPLICE_ELEMENTS; element_index++)
+    {
+        linkedlist_handle_insert_end(&node_list, (int)element_index);
+    }
+
+    /** Copy the run from the middle with one cursor pass, then delete it **/
+    time_start = bench_time_now();
+    linkedlist_cursor_init(&list_cursor, &node_list);
+    for(element_index = 0; element_index < ((BENCH_SPLICE_ELEMENTS / 2u) + BENCH_SPLICE_RUN); element_index++)
+    {
+        if(element_index >= (BENCH_SPLICE_ELEMENTS / 2u))
+        {
+            linkedlist_cursor_peek(&list_cursor, &data);
+            linkedlist_handle_insert_end(&node_target, data);
+        }
+        linkedlist_cursor_next(&list_cursor);
+    }
+    linkedlist_delete_range(&node_list, BENCH_SPLICE_ELEMENTS / 2u, BENCH_SPLICE_RUN);
+    copy_time[0] = bench_time_now() - time_start;
+
+    /** Move it back **/
+    time_start = bench_time_now();
+    linkedlist_splice(&node_list, BENCH_SPLICE_ELEMENTS / 2u, &node_target, 0, BENCH_SPLICE_RUN);
+    move_time[0] = bench_time_now() - time_start;
+
+    /** Append a whole list to another one **/
+    time_start = bench_time_now();
+    linkedlist_cursor_init(&list_cursor, &node_list);
+    while(LINKEDLIST_OP_SUCCESS == linkedlist_cursor_peek(&list_cursor, &data))
+    {
+        linkedlist_handle_insert_end(&node_target, data);
+        linkedlist_cursor_next(&list_cursor);
+    }
+    linkedlist_handle_delete_all(&node_list);
+    copy_time[1] = bench_time_now() - time_start;
+
+    time_start = bench_time_now();
+    linkedlist_concat(&node_list, &node_target);
+    move_time[1] = bench_time_now() - time_start;
+
+    time_start = bench_time_now();
+    linkedlist_reverse(&node_list);
+    reverse_time = bench_time_now() - time_start;
+    linkedlist_handle_get_end(&node_list, &data);
+    bench_sink = data;
+
+    printf("elements: %u\n", BENCH_SPLICE_ELEMENTS);
+    printf("move %u from the middle   copy: %10.3f ms   splice: %10.3f ms\n", BENCH_SPLICE_RUN,
+           copy_time[0] * 1e3, move_time[0] * 1e3);
+    printf("append whole list           copy: %10.3f ms   concat: %10.3f us\n", copy_time[1] * 1e3,
+           move_time[1] * 1e6);
+    printf("reverse: %8.3f ns/node   last element afterwards: %d\n",
+           (reverse_time * 1e9) / BENCH_SPLICE_ELEMENTS, data);
+
+    linkedlist_handle_delete_all(&node_list);
+}
+
+/** Compares copying a list to an array with linkedlist_handle_get_index() in a loop, on a short list since that is
+    quadratic, and with a cursor, with linkedlist_to_array() and linkedlist_to_chunks(). Building a list from an array
+    with linkedlist_handle_insert_end() in a loop is compared with linkedlist_from_array(), into an empty pool based
+    list and into a list that already has its nodes. **/
+static void bench_array(void)
+{
+    linkedlist_pool_t node_pool;
+    linkedlist_t node_list;
+    linkedlist_cursor_t list_cursor;
+    int* data_array = (int*)malloc(BENCH_ARRAY_ELEMENTS * sizeof(int));
+    int* chunk_buffer = (int*)malloc(BENCH_ARRAY_CHUNK * sizeof(int));
+    long long chunk_sum = 0;
+    size_t element_index = 0;
+    double time_start = 0.0;
+    double indexed_time = 0.0;
+    double export_time[3] = {0.0};
+    double import_time[3] = {0.0};
+
+    if((NULL != data_array) && (NULL != chunk_buffer))
+    {
+        for(element_index = 0; element_index < BENCH_ARRAY_ELEMENTS; element_index++)
+        {
+            data_array[element_index] = (int)element_index;
+        }
+        linkedlist_pool_init(&node_pool, 0);
+        linkedlist_handle_init(&node_list);
+        linkedlist_handle_pool_set(&node_list, &node_pool);
+
+        /** Import **/
+        time_start = bench_time_now();
+        for(element_index = 0; element_index < BENCH_ARRAY_ELEMENTS; element_index++)
+        {
+            linkedlist_handle_insert_end(&node_list, data_array[element_index]);
+        }
+        import_time[0] = bench_time_now() - time_start;
+        linkedlist_handle_delete_all(&node_list);
+
+        time_start = bench_time_now();
+        linkedlist_from_array(&node_list, data_array, BENCH_ARRAY_ELEMENTS);
+        import_time[1] = bench_time_now() - time_start;
+
+        time_start = bench_time_now();
+        linkedlist_from_array(&node_list, data_array, BENCH_ARRAY_ELEMENTS);
+        import_time[2] = bench_time_now() - time_start;
+
+        /** Export **/
+        time_start = bench_time_now();
+        linkedlist_cursor_init(&list_cursor, &node_list);
+        for(element_index = 0; element_index < BENCH_ARRAY_ELEMENTS; element_index++)
+        {
+            linkedlist_cursor_peek(&list_cursor, &data_array[element_index]);
+            linkedlist_cursor_next(&list_cursor);
+        }
+        export_time[0] = bench_time_now() - time_start;
+
+        time_start = bench_time_now();
+        linkedlist_to_array(&node_list, data_array);
+        export_time[1] = bench_time_now() - time_start;
+
+        time_start = bench_time_now();
+        linkedlist_to_chunks(&node_list, chunk_buffer, BENCH_ARRAY_CHUNK, bench_array_chunk, &chunk_sum);
+        export_time[2] = bench_time_now() - time_start;
+        bench_sink = chunk_sum + data_array[BENCH_ARRAY_ELEMENTS - 1u];
+
+        linkedlist_truncate(&node_list, BENCH_ARRAY_INDEXED);
+        time_start = bench_time_now();
+        for(element_index = 0; element_index < BENCH_ARRAY_INDEXED; element_index++)
+        {
+            linkedlist_handle_get_index(&node_list, element_index, &data_array[element_index]);
+        }
+        indexed_time = bench_time_now() - time_start;
+        bench_sink = data_array[BENCH_ARRAY_INDEXED - 1u];
+
+        printf("elements: %u   chunk: %u elements\n", BENCH_ARRAY_ELEMENTS, BENCH_ARRAY_CHUNK);
+        printf("list to array    get_index loop (%u elements): %8.3f ns/element\n", BENCH_ARRAY_INDEXED,
+               (indexed_time * 1e9) / BENCH_ARRAY_INDEXED);
+        printf("list to array    cursor: %8.3f   to_array: %8.3f   to_chunks: %8.3f   (ns/element)\n",
+               (export_time[0] * 1e9) / BENCH_ARRAY_ELEMENTS, (export_time[1] * 1e9) / BENCH_ARRAY_ELEMENTS,
+               (export_time[2] * 1e9) / BENCH_ARRAY_ELEMENTS);
+        printf("array to list    insert_end: %8.3f   from_array new: %8.3f   from_array reused: %8.3f   "
+               "(ns/element)\n", (import_time[0] * 1e9) / BENCH_ARRAY_ELEMENTS,
+               (import_time[1] * 1e9) / BENCH_ARRAY_ELEMENTS, (import_time[2] * 1e9) / BENCH_ARRAY_ELEMENTS);
+
+        linkedlist_handle_delete_all(&node_list);
+        linkedlist_pool_destroy(&node_pool);
+    }
+    free(chunk_buffer);
+    free(data_array);
+}
+
+/** Sums the elements of a chunk into the long long context, standing in for the numeric code a list is handed to **/
+static linkedlist_std_ret_t bench_array_chunk(const int* data_array, size_t data_count, void* context)
+{
+    long long* chunk_sum = (long long*)context;
+    size_t loop_cntr = 0;
+
+    for(loop_cntr = 0; loop_cntr < data_count; loop_cntr++)
+    {
+        *chunk_sum = *chunk_sum + data_array[loop_cntr];
+    }
+
+    return LINKEDLIST_OP_SUCCESS;
+}
+
+/** Runs reader threads reading random indexes of a buffer backed CustomArray, next to 0 to BENCH_RWLOCK_MAX_WRITERS
+    writer threads inserting and deleting its last element, for BENCH_RWLOCK_MILLISECONDS each. The array's own
+    reader-writer lock lets the readers run side by side; the same run with every call also made behind one global
+    mutex shows what it costs when readers block each other. Takes the maximum number of reader threads. **/
+static void bench_rwlock(void)
+{
+    static custarr_t shared_array;
+    pthread_mutex_t global_lock = PTHREAD_MUTEX_INITIALIZER;
+    pthread_t thread_id[BENCH_LOCKFREE_MAX_THREADS + BENCH_RWLOCK_MAX_WRITERS];
+    bench_rwlock_arg_t thread_arg[BENCH_LOCKFREE_MAX_THREADS + BENCH_RWLOCK_MAX_WRITERS];
+    struct timespec run_time = {0, BENCH_RWLOCK_MILLISECONDS * 1000000L};
+    atomic_int stop_flag;
+    size_t reader_limit = BENCH_RWLOCK_DEFAULT_READERS;
+    size_t reader_count = 0;
+    size_t writer_count = 0;
+    size_t thread_count = 0;
+    size_t thread_index = 0;
+    unsigned int element_index = 0;
+    unsigned long read_total[2] = {0};
+    unsigned long write_total[2] = {0};
+    int use_lock = 0;
+
+    if(NULL != bench_option)
+    {
+        reader_limit = (size_t)strtoull(bench_option, NULL, 10);
+    }
+    if((0u == reader_limit) || (reader_limit > BENCH_LOCKFREE_MAX_THREADS))
+    {
+        reader_limit = BENCH_RWLOCK_DEFAULT_READERS;
+    }
+
+    initArray_backing(&shared_array, BENCH_RWLOCK_ELEMENTS + BENCH_RWLOCK_MAX_WRITERS, CUSTARR_BACKING_BUFFER);
+    for(element_index = 1; element_index < BENCH_RWLOCK_ELEMENTS; element_index++)
+    {
+        insertElement_atEnd(&shared_array, (int)element_index);
+    }
+
+    printf("elements: %u   %u ms per run   (reads: Mops/s, writes: Kops/s)\n", BENCH_RWLOCK_ELEMENTS,
+           BENCH_RWLOCK_MILLISECONDS);
+    for(writer_count = 0; writer_count <= BENCH_RWLOCK_MAX_WRITERS; writer_count++)
+    {
+        for(reader_count = 1; reader_count <= reader_limit; reader_count = reader_count * 2u)
+        {
+            for(use_lock = 0; use_lock < 2; use_lock++)
+            {
+                atomic_init(&stop_flag, 0);
+                thread_count = reader_count + writer_count;
+                for(thread_index = 0; thread_index < thread_count; thread_index++)
+                {
+                    thread_arg[thread_index].array_ptr = &shared_array;
+                    thread_arg[thread_index].global_lock_ptr = (0 != use_lock) ? &global_lock : NULL;
+                    thread_arg[thread_index].stop_ptr = &stop_flag;
+                    thread_arg[thread_index].is_writer = (thread_index >= reader_count) ? 1 : 0;
+                    thread_arg[thread_index].random_state = 12345u + (unsigned int)thread_index;
+                    thread_arg[thread_index].operation_count = 0;
+                    pthread_create(&thread_id[thread_index], NULL, bench_rwlock_thread, &thread_arg[thread_index]);
+                }
+                nanosleep(&run_time, NULL);
+                atomic_store(&stop_flag, 1);
+
+                read_total[use_lock] = 0;
+                write_total[use_lock] = 0;
+                for(thread_index = 0; thread_index < thread_count; thread_index++)
+                {
+                    pthread_join(thread_id[thread_index], NULL);
+                    if(0 != thread_arg[thread_index].is_writer)
+                    {
+                        write_total[use_lock] += thread_arg[thread_index].operation_count;
+                    }
+                    else
+                    {
+                        read_total[use_lock] += thread_arg[thread_index].operation_count;
+                    }
+                }
+            }
+
+            printf("readers: %3lu  writers: %lu   rwlock reads: %8.3f  writes: %8.3f   "
+                   "global mutex reads: %8.3f  writes: %8.3f\n", (unsigned long)reader_count,
+                   (unsigned long)writer_count, (read_total[0] / (BENCH_RWLOCK_MILLISECONDS * 1e-3)) / 1e6,
+                   (write_total[0] / (BENCH_RWLOCK_MILLISECONDS * 1e-3)) / 1e3,
+                   (read_total[1] / (BENCH_RWLOCK_MILLISECONDS * 1e-3)) / 1e6,
+                   (write_total[1] / (BENCH_RWLOCK_MILLISECONDS * 1e-3)) / 1e3);
+        }
+    }
+    array_destroy(&shared_array);
+}
+
+/** Readers read random indexes, writers insert an element at the end and delete it again, so the array keeps its
+    size. Runs until the stop flag is set. **/
+static void* bench_rwlock_thread(void* thread_arg)
+{
+    bench_rwlock_arg_t* arg_ptr = (bench_rwlock_arg_t*)thread_arg;
+    unsigned int random_state = arg_ptr->random_state;
+    unsigned long operation_count = 0;
+    long long data_sum = 0;
+    int data = 0;
+
+    while(0 == atomic_load_explicit(arg_ptr->stop_ptr, memory_order_relaxed))
+    {
+        random_state = (random_state * 1103515245u) + 12345u;
+        if(NULL != arg_ptr->global_lock_ptr)
+        {
+            pthread_mutex_lock(arg_ptr->global_lock_ptr);
+        }
+        if(0 != arg_ptr->is_writer)
+        {
+            insertElement_atEnd(arg_ptr->array_ptr, (int)random_state);
+            deleteElement_atEnd(arg_ptr->array_ptr);
+        }
+        else if(CUSTARR_OP_SUCCESS == getElement_atIndex(arg_ptr->array_ptr,
+                                                         (size_t)((random_state >> 8) % BENCH_RWLOCK_ELEMENTS), &data))
+        {
+            data_sum += data;
+        }
+        else
+        {
+            /** Index out of range **/
+        }
+        if(NULL != arg_ptr->global_lock_ptr)
+        {
+            pthread_mutex_unlock(arg_ptr->global_lock_ptr);
+        }
+        operation_count++;
+    }
+    arg_ptr->operation_count = operation_count;
+    bench_sink = data_sum;
+
+    return NULL;
+}
+
+/** Grows a linkedlist, an unrolled list and a skip list holding the same elements by factors of 10 up to 10^6
+    elements, or to the element count given as option, and compares reading, inserting and deleting at random indexes
+    at every size **/
+static void bench_skiplist(void)
+{
+    linkedlist_t node_list;
+    linkedlist_pool_t node_pool;
+    unrolled_list_t block_list;
+    skiplist_t skip_list;
+    size_t size_limit = BENCH_SKIPLIST_DEFAULT_LIMIT;
+    size_t size_current = 0;
+    size_t size_next = BENCH_SKIPLIST_FIRST_SIZE;
+    size_t sample_index = 0;
+    unsigned int random_state = 0;
+    int data = 0;
+    long long data_sum = 0;
+    double time_start = 0.0;
+    double get_time[3] = {0.0};
+    double update_time[3] = {0.0};
+
+    if(NULL != bench_option)
+    {
+        size_limit = (size_t)strtoull(bench_option, NULL, 10);
+    }
+
+    linkedlist_handle_init(&node_list);
+    linkedlist_pool_init(&node_pool, 0);
+    linkedlist_handle_pool_set(&node_list, &node_pool);
+    unrolled_list_init(&block_list);
+    skiplist_init(&skip_list);
+
+    printf("%10s %26s %26s %26s\n", "elements", "linkedlist", "unrolled", "skiplist");
+    printf("%10s %13s %12s %13s %12s %13s %12s   (ns/op)\n", "", "get_index", "ins+del", "get_index", "ins+del",
+           "get_index", "ins+del");
+    while(size_next <= size_limit)
+    {
+        for(; size_current < size_next; size_current++)
+        {
+            linkedlist_handle_insert_end(&node_list, (int)size_current);
+            unrolled_list_insert_end(&block_list, (int)size_current);
+            skiplist_insert_end(&skip_list, (int)size_current);
+        }
+
+        /** Every list gets the same random indexes, an insert and a delete keep the size of the list **/
+        random_state = 12345u;
+        time_start = bench_time_now();
+        for(sample_index = 0; sample_index < BENCH_SKIPLIST_SAMPLES; sample_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            linkedlist_handle_get_index(&node_list, (size_t)random_state % size_current, &data);
+            data_sum += data;
+        }
+        get_time[0] = (bench_time_now() - time_start) / BENCH_SKIPLIST_SAMPLES;
+        time_start = bench_time_now();
+        for(sample_index = 0; sample_index < BENCH_SKIPLIST_SAMPLES; sample_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            linkedlist_handle_insert_index(&node_list, (size_t)random_state % size_current, (int)sample_index);
+            linkedlist_handle_delete_index(&node_list, (size_t)(random_state >> 8) % size_current);
+        }
+        update_time[0] = (bench_time_now() - time_start) / BENCH_SKIPLIST_SAMPLES;
+
+        random_state = 12345u;
+        time_start = bench_time_now();
+        for(sample_index = 0; sample_index < BENCH_SKIPLIST_SAMPLES; sample_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            unrolled_list_get_index(&block_list, (size_t)random_state % size_current, &data);
+            data_sum += data;
+        }
+        get_time[1] = (bench_time_now() - time_start) / BENCH_SKIPLIST_SAMPLES;
+        time_start = bench_time_now();
+        for(sample_index = 0; sample_index < BENCH_SKIPLIST_SAMPLES; sample_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            unrolled_list_insert_index(&block_list, (size_t)random_state % size_current, (int)sample_index);
+            unrolled_list_delete_index(&block_list, (size_t)(random_state >> 8) % size_current);
+        }
+        update_time[1] = (bench_time_now() - time_start) / BENCH_SKIPLIST_SAMPLES;
+
+        random_state = 12345u;
+        time_start = bench_time_now();
+        for(sample_index = 0; sample_index < BENCH_SKIPLIST_SAMPLES; sample_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            skiplist_get_index(&skip_list, (size_t)random_state % size_current, &data);
+            data_sum += data;
+        }
+        get_time[2] = (bench_time_now() - time_start) / BENCH_SKIPLIST_SAMPLES;
+        time_start = bench_time_now();
+        for(sample_index = 0; sample_index < BENCH_SKIPLIST_SAMPLES; sample_index++)
+        {
+            random_state = (random_state * 1103515245u) + 12345u;
+            skiplist_insert_index(&skip_list, (size_t)random_state % size_current, (int)sample_index);
+            skiplist_delete_index(&skip_list, (size_t)(random_state >> 8) % size_current);
+        }
+        update_time[2] = (bench_time_now() - time_start) / BENCH_SKIPLIST_SAMPLES;
+
+        printf("%10zu %13.1f %12.1f %13.1f %12.1f %13.1f %12.1f\n", size_current, get_time[0] * 1e9,
+               update_time[0] * 1e9, get_time[1] * 1e9, update_time[1] * 1e9, get_time[2] * 1e9,
+               update_time[2] * 1e9);
+        size_next = size_next * 10u;
+    }
+    bench_sink = data_sum;
+
+    linkedlist_handle_delete_all(&node_list);
+    linkedlist_pool_destroy(&node_pool);
+    unrolled_list_delete_all(&block_list);
+    skiplist_destroy(&skip_list);
+}
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,532 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: dlinkedlist.c
+* File Description: This file contains the implementation of the doubly linked list datastructure.
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#include "dlinkedlist.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static linkedlist_std_ret_t node_link_before(dlinkedlist_t* list, struct dnode_t* node_position, int new_data);
+static void node_unlink(dlinkedlist_t* list, struct dnode_t* node_to_delete);
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_init
+*
+** Purpose:
+*  This function initializes an empty list by linking its sentinel node to itself.
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle to be initialized.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t dlinkedlist_init(dlinkedlist_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != list)
+    {
+        list->sentinel_node.data = 0;
+        list->sentinel_node.next_node_address_ptr = &list->sentinel_node;
+        list->sentinel_node.prev_node_address_ptr = &list->sentinel_node;
+        list->node_count = 0;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_insert_front / dlinkedlist_insert_end
+*
+** Purpose:
+*  These functions insert an element at the front or at the end of the list in O(1).
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle.
+*  - new_data: int
+*    Value to be stored in the new node.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: a new node couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t dlinkedlist_insert_front(dlinkedlist_t* list, int new_data)
+{
+    return node_link_before(list, list->sentinel_node.next_node_address_ptr, new_data);
+}
+
+linkedlist_std_ret_t dlinkedlist_insert_end(dlinkedlist_t* list, int new_data)
+{
+    return node_link_before(list, &list->sentinel_node, new_data);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_insert_index
+*
+** Purpose:
+*  This function inserts an element at a provided index, so the new element is found at that index afterwards. The
+*  list is iterated through from whichever end is closer to the index.
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle.
+*  - node_index: size_t
+*    Index of the new node, from 0 up to and including the current number of nodes.
+*  - new_data: int
+*    Value to be stored in the new node.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range, or a new node couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t dlinkedlist_insert_index(dlinkedlist_t* list, size_t node_index, int new_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(node_index == list->node_count)
+    {
+        ret_val = dlinkedlist_insert_end(list, new_data);
+    }
+    else if(node_index < list->node_count)
+    {
+        ret_val = node_link_before(list, dlinkedlist_node_index(list, node_index), new_data);
+    }
+    else
+    {
+        /** Index out of range **/
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_insert_after
+*
+** Purpose:
+*  This function inserts an element right after a node of the list in O(1).
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle.
+*  - node: struct dnode_t*
+*    Address of a node of the list, the new node is linked after it.
+*  - new_data: int
+*    Value to be stored in the new node.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: node is NULL, or a new node couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t dlinkedlist_insert_after(dlinkedlist_t* list, struct dnode_t* node, int new_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != node)
+    {
+        ret_val = node_link_before(list, node->next_node_address_ptr, new_data);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_get_front / dlinkedlist_get_end
+*
+** Purpose:
+*  These functions read the first or the last element of the list in O(1).
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle.
+*  - current_data: int*
+*    Points to the variable in which the element will be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t dlinkedlist_get_front(dlinkedlist_t* list, int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(0u != list->node_count)
+    {
+        *current_data = list->sentinel_node.next_node_address_ptr->data;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+linkedlist_std_ret_t dlinkedlist_get_end(dlinkedlist_t* list, int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(0u != list->node_count)
+    {
+        *current_data = list->sentinel_node.prev_node_address_ptr->data;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_get_index
+*
+** Purpose:
+*  This function reads the element at a provided index, iterating from whichever end is closer to the index.
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle.
+*  - node_index: size_t
+*    Index of the node to be read.
+*  - current_data: int*
+*    Points to the variable in which the element will be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range.
+*********************************************************************************************************************/
+linkedlist_std_ret_t dlinkedlist_get_index(dlinkedlist_t* list, size_t node_index, int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct dnode_t* node_current = dlinkedlist_node_index(list, node_index);
+
+    if(NULL != node_current)
+    {
+        *current_data = node_current->data;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_delete_front / dlinkedlist_delete_end
+*
+** Purpose:
+*  These functions delete the first or the last node of the list in O(1).
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t dlinkedlist_delete_front(dlinkedlist_t* list)
+{
+    return dlinkedlist_delete_node(list, dlinkedlist_node_front(list));
+}
+
+linkedlist_std_ret_t dlinkedlist_delete_end(dlinkedlist_t* list)
+{
+    return dlinkedlist_delete_node(list, dlinkedlist_node_end(list));
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_delete_index
+*
+** Purpose:
+*  This function deletes the node at a provided index, iterating from whichever end is closer to the index.
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle.
+*  - node_index: size_t
+*    Index of the node to be deleted.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range.
+*********************************************************************************************************************/
+linkedlist_std_ret_t dlinkedlist_delete_index(dlinkedlist_t* list, size_t node_index)
+{
+    return dlinkedlist_delete_node(list, dlinkedlist_node_index(list, node_index));
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_delete_node
+*
+** Purpose:
+*  This function deletes a node the caller already holds in O(1), without searching for it.
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle.
+*  - node: struct dnode_t*
+*    Address of the node of the list to be deleted.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: node is NULL or is the sentinel node.
+*********************************************************************************************************************/
+linkedlist_std_ret_t dlinkedlist_delete_node(dlinkedlist_t* list, struct dnode_t* node)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if((NULL != node) && (&list->sentinel_node != node))
+    {
+        node_unlink(list, node);
+        free(node);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_delete_all
+*
+** Purpose:
+*  This function frees all the nodes of the list and leaves it empty.
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list was already empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t dlinkedlist_delete_all(dlinkedlist_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct dnode_t* node_current = list->sentinel_node.next_node_address_ptr;
+    struct dnode_t* node_tofree = NULL;
+
+    if(0u != list->node_count)
+    {
+        while(&list->sentinel_node != node_current)
+        {
+            node_tofree  = node_current;
+            node_current = node_current->next_node_address_ptr;
+            free(node_tofree);
+        }
+        (void)dlinkedlist_init(list);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_splice
+*
+** Purpose:
+*  This function moves a run of linked nodes from a list to a position of another list, or of the same list, in O(1).
+*  Only the links at both ends of the run are changed, no node is allocated, freed or visited.
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the handle of the list the run is moved to.
+*  - node_position: struct dnode_t*
+*    Address of the node the run is linked before. Give &list->sentinel_node to link the run at the end. It must not
+*    be a node of the run itself, from node_first to node_last, which would corrupt the list. This isn't checked,
+*    since it would take O(n).
+*  - list_source: dlinkedlist_t*
+*    A pointer to the handle of the list the run is taken from.
+*  - node_first: struct dnode_t*
+*    Address of the first node of the run.
+*  - node_last: struct dnode_t*
+*    Address of the last node of the run, node_first itself for a single node. It must be node_first or come after
+*    it in list_source.
+*  - node_count: size_t
+*    Number of nodes of the run, given by the caller since counting them would take O(n).
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: a node address is NULL, or node_count is larger than the source list.
+*********************************************************************************************************************/
+linkedlist_std_ret_t dlinkedlist_splice(dlinkedlist_t* list, struct dnode_t* node_position, dlinkedlist_t* list_source,
+                                        struct dnode_t* node_first, struct dnode_t* node_last, size_t node_count)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct dnode_t* node_before = NULL;
+
+    if((NULL != node_position) && (NULL != node_first) && (NULL != node_last) &&
+       (0u != node_count) && (node_count <= list_source->node_count))
+    {
+        /** Close the gap the run leaves in the source list **/
+        node_first->prev_node_address_ptr->next_node_address_ptr = node_last->next_node_address_ptr;
+        node_last->next_node_address_ptr->prev_node_address_ptr = node_first->prev_node_address_ptr;
+        list_source->node_count = list_source->node_count - node_count;
+
+        /** Link the run before the position **/
+        node_before = node_position->prev_node_address_ptr;
+        node_before->next_node_address_ptr = node_first;
+        node_first->prev_node_address_ptr  = node_before;
+        node_last->next_node_address_ptr   = node_position;
+        node_position->prev_node_address_ptr = node_last;
+        list->node_count = list->node_count + node_count;
+
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_node_front / dlinkedlist_node_end / dlinkedlist_node_next / dlinkedlist_node_index
+*
+** Purpose:
+*  These functions return node handles, to be used with dlinkedlist_insert_after(), dlinkedlist_delete_node() and
+*  dlinkedlist_splice(): the first node, the last node, the node after a given node, and the node at an index.
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle.
+*  - node: struct dnode_t* (dlinkedlist_node_next only)
+*    Address of a node of the list.
+*  - node_index: size_t (dlinkedlist_node_index only)
+*    Index of the required node.
+*
+** Return Value:
+*  - struct dnode_t*
+*    Address of the node, or NULL if there is no such node.
+*********************************************************************************************************************/
+struct dnode_t* dlinkedlist_node_front(dlinkedlist_t* list)
+{
+    return (0u != list->node_count) ? list->sentinel_node.next_node_address_ptr : NULL;
+}
+
+struct dnode_t* dlinkedlist_node_end(dlinkedlist_t* list)
+{
+    return (0u != list->node_count) ? list->sentinel_node.prev_node_address_ptr : NULL;
+}
+
+struct dnode_t* dlinkedlist_node_next(dlinkedlist_t* list, struct dnode_t* node)
+{
+    return (&list->sentinel_node != node->next_node_address_ptr) ? node->next_node_address_ptr : NULL;
+}
+
+struct dnode_t* dlinkedlist_node_index(dlinkedlist_t* list, size_t node_index)
+{
+    struct dnode_t* node_current = NULL;
+    size_t loop_cntr = 0;
+
+    if(node_index < list->node_count)
+    {
+        if(node_index < (list->node_count / 2u))
+        {
+            /** Index is in the first half, iterate forward from the first node **/
+            node_current = list->sentinel_node.next_node_address_ptr;
+            for(loop_cntr = 0; loop_cntr < node_index; loop_cntr++)
+            {
+                node_current = node_current->next_node_address_ptr;
+            }
+        }
+        else
+        {
+            /** Index is in the second half, iterate backward from the last node **/
+            node_current = list->sentinel_node.prev_node_address_ptr;
+            for(loop_cntr = list->node_count - 1u; loop_cntr > node_index; loop_cntr--)
+            {
+                node_current = node_current->prev_node_address_ptr;
+            }
+        }
+    }
+
+    return node_current;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  dlinkedlist_size
+*
+** Purpose:
+*  Returns the number of nodes currently in the list.
+*
+** Input Parameters:
+*  - list: dlinkedlist_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - size_t
+*    Number of nodes.
+*********************************************************************************************************************/
+size_t dlinkedlist_size(dlinkedlist_t* list)
+{
+    return list->node_count;
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+static linkedlist_std_ret_t node_link_before(dlinkedlist_t* list, struct dnode_t* node_position, int new_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct dnode_t* node_new = (struct dnode_t*)malloc(sizeof(struct dnode_t));
+
+    if(NULL != node_new)
+    {
+        node_new->data = new_data;
+        node_new->next_node_address_ptr = node_position;
+        node_new->prev_node_address_ptr = node_position->prev_node_address_ptr;
+        node_position->prev_node_address_ptr->next_node_address_ptr = node_new;
+        node_position->prev_node_address_ptr = node_new;
+        list->node_count = list->node_count + 1;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+static void node_unlink(dlinkedlist_t* list, struct dnode_t* node_to_delete)
+{
+    node_to_delete->prev_node_address_ptr->next_node_address_ptr = node_to_delete->next_node_address_ptr;
+    node_to_delete->next_node_address_ptr->prev_node_address_ptr = node_to_delete->prev_node_address_ptr;
+    list->node_count = list->node_count - 1;
+}
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
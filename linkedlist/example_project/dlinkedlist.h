@@ -0,0 +1,125 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: dlinkedlist.h
+* File Description: This file contains the public interfaces, datatypes, and other information of the doubly linked
+* list function library.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef DLINKEDLIST_H_INCLUDED
+#define DLINKEDLIST_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Datatype Name:
+*  dnode_t
+*
+** Description:
+*  This is a structure datatype that will be used for creating a new doubly linked list node.
+*
+** Datatype Elements:
+*  [1] data: int
+*      Stores node data.
+*  [2] next_node_address_ptr: dnode_t*
+*      Stores address of next node, or of the list sentinel node for the last node.
+*  [3] prev_node_address_ptr: dnode_t*
+*      Stores address of previous node, or of the list sentinel node for the first node.
+*********************************************************************************************************************/
+struct dnode_t
+{
+    int data;
+    struct dnode_t* next_node_address_ptr;
+    struct dnode_t* prev_node_address_ptr;
+};
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  dlinkedlist_t
+*
+** Description:
+*  This is a structure datatype that will be used as a handle for a doubly linked list. The nodes are linked in a
+*  circle through a sentinel node that holds no data: the sentinel next node is the first node and its previous node
+*  is the last node. Every node, including the first and the last, always has a previous and a next node, so nodes
+*  are linked and unlinked in O(1) without special cases. The sentinel is stored inside the handle, so the handle
+*  must not be copied or moved once initialized.
+*
+** Datatype Elements:
+*  [1] sentinel_node: struct dnode_t
+*      Sentinel node of the list. The list is empty when the sentinel is linked to itself.
+*  [2] node_count: size_t
+*      Stores the number of nodes currently in the list.
+*
+** Use Example: Create a doubly linked list and use it as a double ended queue:
+*  dlinkedlist_t my_list;
+*  int data = 0;
+*  dlinkedlist_init(&my_list);
+*  dlinkedlist_insert_end(&my_list, 7);
+*  dlinkedlist_insert_front(&my_list, 6);
+*  dlinkedlist_get_end(&my_list, &data);
+*  dlinkedlist_delete_end(&my_list);
+*  dlinkedlist_delete_all(&my_list);
+*********************************************************************************************************************/
+typedef struct
+{
+    struct dnode_t sentinel_node;
+    size_t node_count;
+} dlinkedlist_t;
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+extern linkedlist_std_ret_t  dlinkedlist_init(dlinkedlist_t* list);
+extern linkedlist_std_ret_t  dlinkedlist_insert_front(dlinkedlist_t* list, int new_data);
+extern linkedlist_std_ret_t  dlinkedlist_insert_end(dlinkedlist_t* list, int new_data);
+extern linkedlist_std_ret_t  dlinkedlist_insert_index(dlinkedlist_t* list, size_t node_index, int new_data);
+extern linkedlist_std_ret_t  dlinkedlist_insert_after(dlinkedlist_t* list, struct dnode_t* node, int new_data);
+extern linkedlist_std_ret_t  dlinkedlist_get_front(dlinkedlist_t* list, int* current_data);
+extern linkedlist_std_ret_t  dlinkedlist_get_end(dlinkedlist_t* list, int* current_data);
+extern linkedlist_std_ret_t  dlinkedlist_get_index(dlinkedlist_t* list, size_t node_index, int* current_data);
+extern linkedlist_std_ret_t  dlinkedlist_delete_front(dlinkedlist_t* list);
+extern linkedlist_std_ret_t  dlinkedlist_delete_end(dlinkedlist_t* list);
+extern linkedlist_std_ret_t  dlinkedlist_delete_index(dlinkedlist_t* list, size_t node_index);
+extern linkedlist_std_ret_t  dlinkedlist_delete_node(dlinkedlist_t* list, struct dnode_t* node);
+extern linkedlist_std_ret_t  dlinkedlist_delete_all(dlinkedlist_t* list);
+extern linkedlist_std_ret_t  dlinkedlist_splice(dlinkedlist_t* list, struct dnode_t* node_position,
+                                                dlinkedlist_t* list_source, struct dnode_t* node_first,
+                                                struct dnode_t* node_last, size_t node_count);
+extern struct dnode_t*       dlinkedlist_node_front(dlinkedlist_t* list);
+extern struct dnode_t*       dlinkedlist_node_end(dlinkedlist_t* list);
+extern struct dnode_t*       dlinkedlist_node_next(dlinkedlist_t* list, struct dnode_t* node);
+extern struct dnode_t*       dlinkedlist_node_index(dlinkedlist_t* list, size_t node_index);
+extern size_t                dlinkedlist_size(dlinkedlist_t* list);
+
+#endif /** DLINKEDLIST_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,462 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: hoh_list.c
+* File Description: This file contains the implementation of the hand-over-hand locking linkedlist datastructure.
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#include "hoh_list.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static struct hoh_node_t* node_walk(hoh_list_t* list, size_t node_steps);
+static struct hoh_node_t* node_walk_end(hoh_list_t* list);
+static void node_unlink(hoh_list_t* list, struct hoh_node_t* node_previous);
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  hoh_list_init
+*
+** Purpose:
+*  This function initializes an empty list. It must be called before any thread uses the list.
+*
+** Input Parameters:
+*  - list: hoh_list_t*
+*    A pointer to the list handle to be initialized.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the lock of the head node couldn't be initialized.
+*********************************************************************************************************************/
+linkedlist_std_ret_t hoh_list_init(hoh_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if((NULL != list) && (0 == pthread_mutex_init(&list->head_node.node_lock, NULL)))
+    {
+        list->head_node.data = 0;
+        list->head_node.next_node_address_ptr = NULL;
+        atomic_init(&list->node_count, (size_t)0u);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  hoh_list_insert_end
+*
+** Purpose:
+*  This function inserts an element at the end of the list. The list is iterated through with lock coupling up to
+*  the last node.
+*
+** Input Parameters:
+*  - list: hoh_list_t*
+*    A pointer to the list handle.
+*  - new_data: int
+*    Value to be stored in the new node.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: a new node couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t hoh_list_insert_end(hoh_list_t* list, int new_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct hoh_node_t* node_new = (struct hoh_node_t*)malloc(sizeof(struct hoh_node_t));
+    struct hoh_node_t* node_current = NULL;
+
+    if((NULL != node_new) && (0 == pthread_mutex_init(&node_new->node_lock, NULL)))
+    {
+        node_new->data = new_data;
+        node_new->next_node_address_ptr = NULL;
+
+        node_current = node_walk_end(list);
+        node_current->next_node_address_ptr = node_new;
+        atomic_fetch_add(&list->node_count, (size_t)1u);
+        pthread_mutex_unlock(&node_current->node_lock);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+    else
+    {
+        free(node_new);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  hoh_list_insert_index
+*
+** Purpose:
+*  This function inserts an element at a provided index, so the new element is found at that index afterwards. Only
+*  the node before the index is kept locked while the new node is linked.
+*
+** Input Parameters:
+*  - list: hoh_list_t*
+*    A pointer to the list handle.
+*  - node_index: size_t
+*    Index of the new node, from 0 up to and including the current number of nodes.
+*  - new_data: int
+*    Value to be stored in the new node.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range, or a new node couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t hoh_list_insert_index(hoh_list_t* list, size_t node_index, int new_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct hoh_node_t* node_new = (struct hoh_node_t*)malloc(sizeof(struct hoh_node_t));
+    struct hoh_node_t* node_previous = NULL;
+
+    if((NULL != node_new) && (0 == pthread_mutex_init(&node_new->node_lock, NULL)))
+    {
+        node_new->data = new_data;
+
+        /** The node before the index is node_index steps after the head node **/
+        node_previous = node_walk(list, node_index);
+        if(NULL != node_previous)
+        {
+            node_new->next_node_address_ptr = node_previous->next_node_address_ptr;
+            node_previous->next_node_address_ptr = node_new;
+            atomic_fetch_add(&list->node_count, (size_t)1u);
+            pthread_mutex_unlock(&node_previous->node_lock);
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+        else
+        {
+            /** Index out of range **/
+            pthread_mutex_destroy(&node_new->node_lock);
+            free(node_new);
+        }
+    }
+    else
+    {
+        free(node_new);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  hoh_list_get_end
+*
+** Purpose:
+*  This function reads the element at the end of the list.
+*
+** Input Parameters:
+*  - list: hoh_list_t*
+*    A pointer to the list handle.
+*  - current_data: int*
+*    Points to the variable in which the element will be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t hoh_list_get_end(hoh_list_t* list, int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct hoh_node_t* node_current = node_walk_end(list);
+
+    if(&list->head_node != node_current)
+    {
+        *current_data = node_current->data;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+    pthread_mutex_unlock(&node_current->node_lock);
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  hoh_list_get_index
+*
+** Purpose:
+*  This function reads the element at a provided index.
+*
+** Input Parameters:
+*  - list: hoh_list_t*
+*    A pointer to the list handle.
+*  - node_index: size_t
+*    Index of the node to be read.
+*  - current_data: int*
+*    Points to the variable in which the element will be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range.
+*********************************************************************************************************************/
+linkedlist_std_ret_t hoh_list_get_index(hoh_list_t* list, size_t node_index, int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct hoh_node_t* node_current = NULL;
+
+    if(node_index < (size_t)-1)
+    {
+        node_current = node_walk(list, node_index + 1u);
+        if(NULL != node_current)
+        {
+            *current_data = node_current->data;
+            pthread_mutex_unlock(&node_current->node_lock);
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  hoh_list_delete_end
+*
+** Purpose:
+*  This function deletes the node at the end of the list. The list is iterated through holding the locks of two
+*  nodes, so the node before the last one is still locked once the last node is found.
+*
+** Input Parameters:
+*  - list: hoh_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t hoh_list_delete_end(hoh_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct hoh_node_t* node_previous = &list->head_node;
+    struct hoh_node_t* node_current = NULL;
+    struct hoh_node_t* node_next = NULL;
+
+    pthread_mutex_lock(&node_previous->node_lock);
+    node_current = node_previous->next_node_address_ptr;
+    if(NULL != node_current)
+    {
+        pthread_mutex_lock(&node_current->node_lock);
+        while(NULL != node_current->next_node_address_ptr)
+        {
+            node_next = node_current->next_node_address_ptr;
+            pthread_mutex_lock(&node_next->node_lock);
+            pthread_mutex_unlock(&node_previous->node_lock);
+            node_previous = node_current;
+            node_current  = node_next;
+        }
+        pthread_mutex_unlock(&node_current->node_lock);
+        node_unlink(list, node_previous);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+    pthread_mutex_unlock(&node_previous->node_lock);
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  hoh_list_delete_index
+*
+** Purpose:
+*  This function deletes the node at a provided index.
+*
+** Input Parameters:
+*  - list: hoh_list_t*
+*    A pointer to the list handle.
+*  - node_index: size_t
+*    Index of the node to be deleted.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range.
+*********************************************************************************************************************/
+linkedlist_std_ret_t hoh_list_delete_index(hoh_list_t* list, size_t node_index)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct hoh_node_t* node_previous = node_walk(list, node_index);
+
+    if(NULL != node_previous)
+    {
+        if(NULL != node_previous->next_node_address_ptr)
+        {
+            node_unlink(list, node_previous);
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+        pthread_mutex_unlock(&node_previous->node_lock);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  hoh_list_delete_all
+*
+** Purpose:
+*  This function deletes all the nodes of the list. The head node stays locked, so no other thread enters the list,
+*  and the first node is deleted until the list is empty. Threads already walking through the list are never passed.
+*
+** Input Parameters:
+*  - list: hoh_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list was already empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t hoh_list_delete_all(hoh_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    pthread_mutex_lock(&list->head_node.node_lock);
+    while(NULL != list->head_node.next_node_address_ptr)
+    {
+        node_unlink(list, &list->head_node);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+    pthread_mutex_unlock(&list->head_node.node_lock);
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  hoh_list_size
+*
+** Purpose:
+*  Returns the number of nodes currently in the list. While other threads update the list, the value is only a snap-
+*  shot.
+*
+** Input Parameters:
+*  - list: hoh_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - size_t
+*    Number of nodes.
+*********************************************************************************************************************/
+size_t hoh_list_size(hoh_list_t* list)
+{
+    return atomic_load(&list->node_count);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  hoh_list_destroy
+*
+** Purpose:
+*  This function frees all the nodes of the list and the lock of the head node. It must only be called once no
+*  thread uses the list anymore.
+*
+** Input Parameters:
+*  - list: hoh_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t hoh_list_destroy(hoh_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != list)
+    {
+        (void)hoh_list_delete_all(list);
+        pthread_mutex_destroy(&list->head_node.node_lock);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+/** Walks node_steps nodes after the head node with lock coupling. Returns the reached node still locked, or NULL
+    with no lock held if the list is shorter. **/
+static struct hoh_node_t* node_walk(hoh_list_t* list, size_t node_steps)
+{
+    struct hoh_node_t* node_current = &list->head_node;
+    struct hoh_node_t* node_next = NULL;
+    size_t loop_cntr = 0;
+
+    pthread_mutex_lock(&node_current->node_lock);
+    for(loop_cntr = 0; loop_cntr < node_steps; loop_cntr++)
+    {
+        node_next = node_current->next_node_address_ptr;
+        if(NULL == node_next)
+        {
+            pthread_mutex_unlock(&node_current->node_lock);
+            node_current = NULL;
+            break;
+        }
+        pthread_mutex_lock(&node_next->node_lock);
+        pthread_mutex_unlock(&node_current->node_lock);
+        node_current = node_next;
+    }
+
+    return node_current;
+}
+
+/** Walks up to the last node with lock coupling, returns it still locked. Returns the head node for an empty list. **/
+static struct hoh_node_t* node_walk_end(hoh_list_t* list)
+{
+    struct hoh_node_t* node_current = &list->head_node;
+    struct hoh_node_t* node_next = NULL;
+
+    pthread_mutex_lock(&node_current->node_lock);
+    while(NULL != node_current->next_node_address_ptr)
+    {
+        node_next = node_current->next_node_address_ptr;
+        pthread_mutex_lock(&node_next->node_lock);
+        pthread_mutex_unlock(&node_current->node_lock);
+        node_current = node_next;
+    }
+
+    return node_current;
+}
+
+/** Unlinks and frees the node after node_previous, whose lock is held by the caller. Any other thread reaching the
+    node would need the lock of node_previous first, so once the node lock is taken no thread can be using it. **/
+static void node_unlink(hoh_list_t* list, struct hoh_node_t* node_previous)
+{
+    struct hoh_node_t* node_to_delete = node_previous->next_node_address_ptr;
+
+    pthread_mutex_lock(&node_to_delete->node_lock);
+    node_previous->next_node_address_ptr = node_to_delete->next_node_address_ptr;
+    pthread_mutex_unlock(&node_to_delete->node_lock);
+    pthread_mutex_destroy(&node_to_delete->node_lock);
+    free(node_to_delete);
+    atomic_fetch_sub(&list->node_count, (size_t)1u);
+}
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,116 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: hoh_list.h
+* File Description: This file contains the public interfaces, datatypes, and other information of the hand-over-hand
+* locking linkedlist function library. It requires a C11 compiler with atomics support and POSIX threads.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef HOH_LIST_H_INCLUDED
+#define HOH_LIST_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Datatype Name:
+*  hoh_node_t
+*
+** Description:
+*  This is a structure datatype that will be used for creating a new hand-over-hand locking list node. Every node has
+*  its own lock, which protects its data and its link to the next node.
+*
+** Datatype Elements:
+*  [1] data: int
+*      Stores node data.
+*  [2] next_node_address_ptr: hoh_node_t*
+*      Stores address of next node.
+*  [3] node_lock: pthread_mutex_t
+*      Lock of the node.
+*********************************************************************************************************************/
+struct hoh_node_t
+{
+    int data;
+    struct hoh_node_t* next_node_address_ptr;
+    pthread_mutex_t node_lock;
+};
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  hoh_list_t
+*
+** Description:
+*  This is a structure datatype that will be used as a handle for a hand-over-hand locking linkedlist. Threads walk
+*  through the list holding the lock of the current node and taking the lock of the next node before giving it back
+*  (lock coupling), so threads working on different parts of the list don't block each other. Locks are always taken
+*  from the front to the end of the list, so threads never deadlock.
+*
+** Datatype Elements:
+*  [1] head_node: struct hoh_node_t
+*      Sentinel node placed before the first node, its data is never used. Its lock is the entry to the list.
+*  [2] node_count: atomic_size_t
+*      Stores the number of nodes currently in the list.
+*
+** Use Example: Use a list from several threads:
+*  Step 1: Create the handle and initialize it, before the threads are started:
+*          static hoh_list_t my_list;
+*          hoh_list_init(&my_list);
+*  Step 2: In any thread:
+*          hoh_list_insert_end(&my_list, 7);
+*          hoh_list_get_index(&my_list, 0, &data);
+*  Step 3: Free all the nodes and the locks once all the threads are done:
+*          hoh_list_destroy(&my_list);
+*********************************************************************************************************************/
+typedef struct
+{
+    struct hoh_node_t head_node;
+    atomic_size_t node_count;
+} hoh_list_t;
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+extern linkedlist_std_ret_t  hoh_list_init(hoh_list_t* list);
+extern linkedlist_std_ret_t  hoh_list_insert_end(hoh_list_t* list, int new_data);
+extern linkedlist_std_ret_t  hoh_list_insert_index(hoh_list_t* list, size_t node_index, int new_data);
+extern linkedlist_std_ret_t  hoh_list_get_end(hoh_list_t* list, int* current_data);
+extern linkedlist_std_ret_t  hoh_list_get_index(hoh_list_t* list, size_t node_index, int* current_data);
+extern linkedlist_std_ret_t  hoh_list_delete_end(hoh_list_t* list);
+extern linkedlist_std_ret_t  hoh_list_delete_index(hoh_list_t* list, size_t node_index);
+extern linkedlist_std_ret_t  hoh_list_delete_all(hoh_list_t* list);
+extern size_t                hoh_list_size(hoh_list_t* list);
+extern linkedlist_std_ret_t  hoh_list_destroy(hoh_list_t* list);
+
+#endif /** HOH_LIST_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,414 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: intrusive_list.c
+* File Description: This file contains the implementation of the intrusive linkedlist datastructure.
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#include "intrusive_list.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static struct intrusive_link_t* link_find(intrusive_list_t* list, size_t link_index);
+static void link_unlink(intrusive_list_t* list, struct intrusive_link_t* link_previous,
+                        struct intrusive_link_t* link_to_delete);
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  intrusive_list_init
+*
+** Purpose:
+*  This function initializes an empty intrusive list.
+*
+** Input Parameters:
+*  - list: intrusive_list_t*
+*    A pointer to the list handle to be initialized.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t intrusive_list_init(intrusive_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != list)
+    {
+        list->head_link_ptr = NULL;
+        list->tail_link_ptr = NULL;
+        list->link_count    = 0;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  intrusive_list_insert_end
+*
+** Purpose:
+*  This function links a record at the end of the list in O(1). Nothing is allocated or copied.
+*
+** Input Parameters:
+*  - list: intrusive_list_t*
+*    A pointer to the list handle.
+*  - link_new: struct intrusive_link_t*
+*    Address of the link embedded in the record. The record must not be linked in any list already.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: link_new is NULL.
+*********************************************************************************************************************/
+linkedlist_std_ret_t intrusive_list_insert_end(intrusive_list_t* list, struct intrusive_link_t* link_new)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != link_new)
+    {
+        link_new->next_link_address_ptr = NULL;
+        if(NULL == list->tail_link_ptr)
+        {
+            list->head_link_ptr = link_new;
+        }
+        else
+        {
+            list->tail_link_ptr->next_link_address_ptr = link_new;
+        }
+        list->tail_link_ptr = link_new;
+        list->link_count = list->link_count + 1;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  intrusive_list_insert_index
+*
+** Purpose:
+*  This function links a record at a provided index, so the record is found at that index afterwards.
+*
+** Input Parameters:
+*  - list: intrusive_list_t*
+*    A pointer to the list handle.
+*  - link_index: size_t
+*    Index of the new record, from 0 up to and including the current number of records.
+*  - link_new: struct intrusive_link_t*
+*    Address of the link embedded in the record. The record must not be linked in any list already.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range, or link_new is NULL.
+*********************************************************************************************************************/
+linkedlist_std_ret_t intrusive_list_insert_index(intrusive_list_t* list, size_t link_index,
+                                                 struct intrusive_link_t* link_new)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct intrusive_link_t* link_previous = NULL;
+
+    if((NULL == link_new) || (link_index > list->link_count))
+    {
+        /** Nothing to link, or index out of range **/
+    }
+    else if(link_index == list->link_count)
+    {
+        ret_val = intrusive_list_insert_end(list, link_new);
+    }
+    else if(0u == link_index)
+    {
+        link_new->next_link_address_ptr = list->head_link_ptr;
+        list->head_link_ptr = link_new;
+        list->link_count = list->link_count + 1;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+    else
+    {
+        link_previous = link_find(list, link_index - 1u);
+        link_new->next_link_address_ptr = link_previous->next_link_address_ptr;
+        link_previous->next_link_address_ptr = link_new;
+        list->link_count = list->link_count + 1;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  intrusive_list_get_end
+*
+** Purpose:
+*  This function returns the link of the last record of the list in O(1). Use INTRUSIVE_LIST_CONTAINER_OF() to reach
+*  the record itself.
+*
+** Input Parameters:
+*  - list: intrusive_list_t*
+*    A pointer to the list handle.
+*  - link_current: struct intrusive_link_t**
+*    Points to the variable in which the address of the link will be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t intrusive_list_get_end(intrusive_list_t* list, struct intrusive_link_t** link_current)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != list->tail_link_ptr)
+    {
+        *link_current = list->tail_link_ptr;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  intrusive_list_get_index
+*
+** Purpose:
+*  This function returns the link of the record at a provided index.
+*
+** Input Parameters:
+*  - list: intrusive_list_t*
+*    A pointer to the list handle.
+*  - link_index: size_t
+*    Index of the record.
+*  - link_current: struct intrusive_link_t**
+*    Points to the variable in which the address of the link will be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range.
+*********************************************************************************************************************/
+linkedlist_std_ret_t intrusive_list_get_index(intrusive_list_t* list, size_t link_index,
+                                              struct intrusive_link_t** link_current)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(link_index < list->link_count)
+    {
+        *link_current = link_find(list, link_index);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  intrusive_list_delete_end
+*
+** Purpose:
+*  This function unlinks the last record of the list. The record itself is left untouched, its storage belongs to the
+*  caller. The record before the last one has to be found, so it takes O(n).
+*
+** Input Parameters:
+*  - list: intrusive_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t intrusive_list_delete_end(intrusive_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(0u != list->link_count)
+    {
+        ret_val = intrusive_list_delete_index(list, list->link_count - 1u);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  intrusive_list_delete_index
+*
+** Purpose:
+*  This function unlinks the record at a provided index. The record itself is left untouched.
+*
+** Input Parameters:
+*  - list: intrusive_list_t*
+*    A pointer to the list handle.
+*  - link_index: size_t
+*    Index of the record to be unlinked.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range.
+*********************************************************************************************************************/
+linkedlist_std_ret_t intrusive_list_delete_index(intrusive_list_t* list, size_t link_index)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct intrusive_link_t* link_previous = NULL;
+
+    if(link_index < list->link_count)
+    {
+        if(0u != link_index)
+        {
+            link_previous = link_find(list, link_index - 1u);
+            link_unlink(list, link_previous, link_previous->next_link_address_ptr);
+        }
+        else
+        {
+            link_unlink(list, NULL, list->head_link_ptr);
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  intrusive_list_delete_all
+*
+** Purpose:
+*  This function unlinks all the records of the list in O(1), as no record has to be freed. The links left in the
+*  records are stale and are overwritten the next time a record is inserted.
+*
+** Input Parameters:
+*  - list: intrusive_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list was already empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t intrusive_list_delete_all(intrusive_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(0u != list->link_count)
+    {
+        ret_val = intrusive_list_init(list);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  intrusive_list_size
+*
+** Purpose:
+*  Returns the number of records currently linked in the list.
+*
+** Input Parameters:
+*  - list: intrusive_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - size_t
+*    Number of records.
+*********************************************************************************************************************/
+size_t intrusive_list_size(intrusive_list_t* list)
+{
+    return list->link_count;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  intrusive_list_first / intrusive_list_next
+*
+** Purpose:
+*  These functions return the link of the first record of the list, and the link of the record after a given one.
+*  They are used by INTRUSIVE_LIST_FOR_EACH() to iterate through the list.
+*
+** Input Parameters:
+*  - list: intrusive_list_t* (intrusive_list_first only)
+*    A pointer to the list handle.
+*  - link_current: struct intrusive_link_t* (intrusive_list_next only)
+*    Address of a link of the list.
+*
+** Return Value:
+*  - struct intrusive_link_t*
+*    Address of the link, or NULL at the end of the list.
+*********************************************************************************************************************/
+struct intrusive_link_t* intrusive_list_first(intrusive_list_t* list)
+{
+    return list->head_link_ptr;
+}
+
+struct intrusive_link_t* intrusive_list_next(struct intrusive_link_t* link_current)
+{
+    return link_current->next_link_address_ptr;
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+static struct intrusive_link_t* link_find(intrusive_list_t* list, size_t link_index)
+{
+    struct intrusive_link_t* link_current = list->head_link_ptr;
+    size_t loop_cntr = 0;
+
+    /** The last link is reached from the handle without iterating **/
+    if(link_index == (list->link_count - 1u))
+    {
+        link_current = list->tail_link_ptr;
+    }
+    else
+    {
+        for(loop_cntr = 0; loop_cntr < link_index; loop_cntr++)
+        {
+            link_current = link_current->next_link_address_ptr;
+        }
+    }
+
+    return link_current;
+}
+
+static void link_unlink(intrusive_list_t* list, struct intrusive_link_t* link_previous,
+                        struct intrusive_link_t* link_to_delete)
+{
+    if(NULL == link_previous)
+    {
+        list->head_link_ptr = link_to_delete->next_link_address_ptr;
+    }
+    else
+    {
+        link_previous->next_link_address_ptr = link_to_delete->next_link_address_ptr;
+    }
+
+    if(list->tail_link_ptr == link_to_delete)
+    {
+        list->tail_link_ptr = link_previous;
+    }
+
+    link_to_delete->next_link_address_ptr = NULL;
+    list->link_count = list->link_count - 1;
+}
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
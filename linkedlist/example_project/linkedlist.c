@@ -14,25 +14,54 @@
                                          << File Inclusions >>
 *********************************************************************************************************************/
 #include "linkedlist.h"
+#include "linkedlist_pool.h"
+#include "linkedlist_stats.h"
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 
+/*********************************************************************************************************************
+                                           << Private Macros >>
+*********************************************************************************************************************/
+/** Asks the processor to start reading a node into the cache, without waiting for it. Does nothing on compilers
+    without a prefetch builtin. **/
+#if defined(__GNUC__) || defined(__clang__)
+#define LINKEDLIST_PREFETCH(address)   __builtin_prefetch(address)
+#else
+#define LINKEDLIST_PREFETCH(address)   ((void)(address))
+#endif
+
 /*********************************************************************************************************************
                                   << Private Function Declarations >>
 *********************************************************************************************************************/
 static void memFree_safe(void** pointer_to_free);
+static struct node_t* node_alloc(linkedlist_t* list);
+static void node_free(linkedlist_t* list, struct node_t* node_tofree);
+static void chain_free(linkedlist_t* list, struct node_t* chain_first, struct node_t* chain_last,
+                       size_t chain_count);
+static struct node_t* chain_merge(struct node_t* chain_first_a, struct node_t* chain_first_b, int* chain_b_last);
+static int address_compare(const void* address_a, const void* address_b);
+static linkedlist_std_ret_t chain_create(linkedlist_t* list, const int* data_array, size_t data_count,
+                                         struct node_t** chain_first, struct node_t** chain_last);
+static struct node_t* node_find(linkedlist_t* list, size_t node_index);
+static void jump_table_invalidate(linkedlist_t* list);
+static void jump_table_release(linkedlist_t* list);
+static linkedlist_std_ret_t jump_table_build(linkedlist_t* list);
+static size_t jump_lanes_walk(linkedlist_t* list, size_t segment_first, struct node_t** node_buffer);
 
 /*********************************************************************************************************************
                                   << Public Function Definitions >>
 *********************************************************************************************************************/
 linkedlist_std_ret_t  linkedlist_insert_end(struct node_t* head_node, int new_data)
 {
+    LINKEDLIST_STATS_BEGIN();
     linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
     struct node_t* node_current = head_node;
     struct node_t* node_new = (struct node_t*)malloc(sizeof(struct node_t));
 
     if(NULL!=node_new)
     {
+        LINKEDLIST_STATS_ALLOC(1);
         node_new->next_node_address_ptr = NULL;
         node_new->data = new_data;
 
@@ -40,6 +69,7 @@ linkedlist_std_ret_t  linkedlist_insert_end(struct node_t* head_node, int new_da
         while(node_current->next_node_address_ptr!= NULL)
         {
             node_current = node_current->next_node_address_ptr;
+            LINKEDLIST_STATS_NODES(1);
         }/** node_current at this point points to the last node **/
 
         /** link the last node to the new node: **/
@@ -47,40 +77,55 @@ linkedlist_std_ret_t  linkedlist_insert_end(struct node_t* head_node, int new_da
         ret_val = LINKEDLIST_OP_SUCCESS;
     }
 
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_INSERT_END);
     return ret_val;
 
 }
 
-linkedlist_std_ret_t  linkedlist_insert_index(struct node_t* head_node, unsigned short node_index, int new_data)
+linkedlist_std_ret_t  linkedlist_insert_index(struct node_t* head_node, size_t node_index, int new_data)
 {
+    LINKEDLIST_STATS_BEGIN();
     linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
     struct node_t* node_current = head_node;
     struct node_t* node_new = (struct node_t*)malloc(sizeof(struct node_t));
-    node_new->data = new_data;
-
-    unsigned short loop_cntr = 0;
+    size_t loop_cntr = 0;
 
-    /** Iterating through the linkedlist to reach the required index **/
-    while(node_current->next_node_address_ptr!= NULL)
+    if(NULL!=node_new)
     {
-        if(loop_cntr == (node_index-1))
+        LINKEDLIST_STATS_ALLOC(1);
+        node_new->data = new_data;
+
+        /** Iterating through the linkedlist to reach the required index **/
+        while((0u != node_index) && (node_current->next_node_address_ptr!= NULL))
         {
-            node_new->next_node_address_ptr = node_current->next_node_address_ptr;
-            node_current->next_node_address_ptr = node_new;
-            ret_val = LINKEDLIST_OP_SUCCESS;
-            break;
+            if(loop_cntr == (node_index-1))
+            {
+                node_new->next_node_address_ptr = node_current->next_node_address_ptr;
+                node_current->next_node_address_ptr = node_new;
+                ret_val = LINKEDLIST_OP_SUCCESS;
+                break;
+            }
+
+            node_current = node_current->next_node_address_ptr;
+            loop_cntr= loop_cntr+1;
+            LINKEDLIST_STATS_NODES(1);
         }
 
-        node_current = node_current->next_node_address_ptr;
-        loop_cntr= loop_cntr+1;
+        /** Index 0 and indexes past the last node are not inserted at, the new node is given back **/
+        if(LINKEDLIST_OP_SUCCESS != ret_val)
+        {
+            memFree_safe((void **)&node_new);
+        }
     }
 
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_INSERT_INDEX);
     return ret_val;
 
 }
 
 linkedlist_std_ret_t  linkedlist_get_end(struct node_t* head_node, int* current_data)
 {
+    LINKEDLIST_STATS_BEGIN();
     linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
     struct node_t* node_current = head_node;
 
@@ -89,21 +134,24 @@ linkedlist_std_ret_t  linkedlist_get_end(struct node_t* head_node, int* current_
     while(node_current->next_node_address_ptr!= NULL)
     {
         node_current = node_current->next_node_address_ptr;
+        LINKEDLIST_STATS_NODES(1);
     } /** At this point node current points to the last node.
           If the array has only the head node, it will point to the head node.**/
 
     *current_data = node_current->data;
     ret_val = LINKEDLIST_OP_SUCCESS;
 
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_GET_END);
     return ret_val;
 
 }
 
-linkedlist_std_ret_t  linkedlist_get_index(struct node_t* head_node, unsigned short node_index, int* data)
+linkedlist_std_ret_t  linkedlist_get_index(struct node_t* head_node, size_t node_index, int* data)
 {
+    LINKEDLIST_STATS_BEGIN();
     linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
     struct node_t* node_current = head_node;
-    unsigned short loop_cntr = 0;
+    size_t loop_cntr = 0;
 
 
     /** Iterating through the linkedlist to reach the node at required node index **/
@@ -118,6 +166,7 @@ linkedlist_std_ret_t  linkedlist_get_index(struct node_t* head_node, unsigned sh
 
         node_current = node_current->next_node_address_ptr;
         loop_cntr= loop_cntr+1;
+        LINKEDLIST_STATS_NODES(1);
 
         if(loop_cntr == node_index)
         {
@@ -130,12 +179,14 @@ linkedlist_std_ret_t  linkedlist_get_index(struct node_t* head_node, unsigned sh
     }
 
 
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_GET_INDEX);
     return ret_val;
 
 }
 
 linkedlist_std_ret_t  linkedlist_delete_end(struct node_t* head_node)
 {
+    LINKEDLIST_STATS_BEGIN();
     linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
     struct node_t* node_current = head_node;
     struct node_t* node_to_delete = NULL;
@@ -150,11 +201,12 @@ linkedlist_std_ret_t  linkedlist_delete_end(struct node_t* head_node)
         {
             node_to_delete = node_current;
             node_current = node_current->next_node_address_ptr;
+            LINKEDLIST_STATS_NODES(1);
         }/** node_current at this point points to the last node **/
 
         /** Delete the last node by freeing its memory **/
-        free(node_current->next_node_address_ptr);
         node_to_delete->next_node_address_ptr = NULL;
+        memFree_safe((void **)&node_current);
 
 
         ret_val = LINKEDLIST_OP_SUCCESS;
@@ -166,17 +218,19 @@ linkedlist_std_ret_t  linkedlist_delete_end(struct node_t* head_node)
             So, there is nothing to free. **/
     }
 
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_DELETE_END);
     return ret_val;
 
 }
 
-linkedlist_std_ret_t  linkedlist_delete_index(struct node_t* head_node, unsigned short node_index)
+linkedlist_std_ret_t  linkedlist_delete_index(struct node_t* head_node, size_t node_index)
 {
+    LINKEDLIST_STATS_BEGIN();
     linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
     struct node_t* node_current = head_node;
     struct node_t* node_to_delete = NULL;
 
-    unsigned short loop_cntr = 0;
+    size_t loop_cntr = 0;
 
     /** Iterating through the linkedlist to reach the required index **/
     while(node_current->next_node_address_ptr!= NULL)
@@ -191,10 +245,13 @@ linkedlist_std_ret_t  linkedlist_delete_index(struct node_t* head_node, unsigned
 
         node_current = node_current->next_node_address_ptr;
         loop_cntr= loop_cntr+1;
+        LINKEDLIST_STATS_NODES(1);
     }
+    LINKEDLIST_STATS_FREE(NULL != node_to_delete);
     free(node_to_delete);
     node_to_delete = NULL;
 
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_DELETE_INDEX);
     return ret_val;
 }
 
@@ -202,6 +259,7 @@ linkedlist_std_ret_t  linkedlist_delete_index(struct node_t* head_node, unsigned
 
 linkedlist_std_ret_t  linkedlist_delete_all(struct node_t* head_node)
 {
+    LINKEDLIST_STATS_BEGIN();
     linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
     struct node_t* node_current = head_node;
     struct node_t  next_node = {0,NULL};
@@ -217,8 +275,10 @@ linkedlist_std_ret_t  linkedlist_delete_all(struct node_t* head_node)
         {
             node_tofree = node_current;
             next_node = (*node_current);
+            LINKEDLIST_PREFETCH(next_node.next_node_address_ptr); /** Read the next node while this one is freed **/
             memFree_safe((void **)&node_tofree); /** Safely free that memory **/
             node_current = next_node.next_node_address_ptr;
+            LINKEDLIST_STATS_NODES(1);
         }
 
         ret_val = LINKEDLIST_OP_SUCCESS;
@@ -232,20 +292,1707 @@ linkedlist_std_ret_t  linkedlist_delete_all(struct node_t* head_node)
 
 
 
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_DELETE_ALL);
     return ret_val;
 
 }
 
 /*********************************************************************************************************************
-                                  << Private Function Definitions >>
+                                  << Handle Based Function Definitions >>
 *********************************************************************************************************************/
-static void memFree_safe(void** pointer_to_free)
+linkedlist_std_ret_t  linkedlist_handle_init(linkedlist_t* list)
 {
-    if(*pointer_to_free!= NULL) /**Checking is made so it doesn't re-free a NULL pointer**/
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != list)
     {
-        free(*pointer_to_free);
-        *pointer_to_free = NULL; /** Set freed pointer as NULL, so it doesn't become dangling. **/
+        list->head_node_ptr = NULL;
+        list->tail_node_ptr = NULL;
+        list->node_count    = 0;
+        list->node_pool_ptr = NULL;
+        list->traversal_mode      = LINKEDLIST_TRAVERSAL_PLAIN;
+        list->jump_table_ptr      = NULL;
+        list->jump_table_count    = 0;
+        list->jump_table_capacity = 0;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_handle_insert_end(linkedlist_t* list, int new_data)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_new = node_alloc(list);
+
+    if(NULL != node_new)
+    {
+        node_new->next_node_address_ptr = NULL;
+        node_new->data = new_data;
+
+        if(NULL == list->tail_node_ptr)
+        {
+            /** List is empty, so the new node is both the first and the last node **/
+            list->head_node_ptr = node_new;
+        }
+        else
+        {
+            /** No iteration needed, the handle already knows the last node **/
+            list->tail_node_ptr->next_node_address_ptr = node_new;
+        }
+
+        /** A node appended at the start of a new segment gets its skip pointer, the rest of the table stays valid **/
+        if((0u != list->jump_table_count) && (0u == (list->node_count % LINKEDLIST_JUMP_INTERVAL)))
+        {
+            if(list->jump_table_count < list->jump_table_capacity)
+            {
+                list->jump_table_ptr[list->jump_table_count] = node_new;
+                list->jump_table_count = list->jump_table_count + 1;
+            }
+            else
+            {
+                jump_table_invalidate(list);
+            }
+        }
+
+        list->tail_node_ptr = node_new;
+        list->node_count = list->node_count + 1;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_HANDLE_INSERT_END);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_handle_insert_index(linkedlist_t* list, size_t node_index, int new_data)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_current = NULL;
+    struct node_t* node_new = NULL;
+
+    if(node_index == list->node_count)
+    {
+        ret_val = linkedlist_handle_insert_end(list, new_data);
+    }
+    else if(node_index < list->node_count)
+    {
+        node_new = node_alloc(list);
+        if(NULL != node_new)
+        {
+            node_new->data = new_data;
+            if(0u == node_index)
+            {
+                node_new->next_node_address_ptr = list->head_node_ptr;
+                list->head_node_ptr = node_new;
+            }
+            else
+            {
+                /** Iterating through the linkedlist to reach the node before the required index **/
+                node_current = node_find(list, node_index - 1u);
+                node_new->next_node_address_ptr = node_current->next_node_address_ptr;
+                node_current->next_node_address_ptr = node_new;
+            }
+            jump_table_invalidate(list);
+            list->node_count = list->node_count + 1;
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+    }
+    else
+    {
+        /** Index out of range **/
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_HANDLE_INSERT_INDEX);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_handle_get_end(linkedlist_t* list, int* current_data)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != list->tail_node_ptr)
+    {
+        *current_data = list->tail_node_ptr->data;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_HANDLE_GET_END);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_handle_get_index(linkedlist_t* list, size_t node_index, int* current_data)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_current = list->tail_node_ptr;
+
+    if(node_index < list->node_count)
+    {
+        if(node_index != (list->node_count - 1u))
+        {
+            /** The jump table is only rebuilt when reading, without it the list is walked from its head **/
+            if((LINKEDLIST_TRAVERSAL_JUMP == list->traversal_mode) && (0u == list->jump_table_count))
+            {
+                (void)jump_table_build(list);
+            }
+
+            /** Iterating through the linkedlist to reach the node at required node index **/
+            node_current = node_find(list, node_index);
+        }
+        *current_data = node_current->data;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_HANDLE_GET_INDEX);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_handle_delete_end(linkedlist_t* list)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_current = list->head_node_ptr;
+    struct node_t* node_to_delete = list->tail_node_ptr;
+
+    if(NULL != node_to_delete)
+    {
+        if(node_current == node_to_delete)
+        {
+            /** The list only has one node **/
+            list->head_node_ptr = NULL;
+            list->tail_node_ptr = NULL;
+        }
+        else
+        {
+            /** Nodes don't link back to their previous node, so the node before the last one has to be searched for **/
+            node_current = node_find(list, list->node_count - 2u);
+
+            node_current->next_node_address_ptr = NULL;
+            list->tail_node_ptr = node_current;
+        }
+
+        /** Only the skip pointer to the deleted node, if any, has to leave the jump table **/
+        if((0u != list->jump_table_count) && (0u == ((list->node_count - 1u) % LINKEDLIST_JUMP_INTERVAL)))
+        {
+            list->jump_table_count = list->jump_table_count - 1;
+        }
+
+        node_free(list, node_to_delete);
+        list->node_count = list->node_count - 1;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_HANDLE_DELETE_END);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_handle_delete_index(linkedlist_t* list, size_t node_index)
+{
+    return linkedlist_delete_range(list, node_index, 1u);
+}
+
+linkedlist_std_ret_t  linkedlist_handle_delete_all(linkedlist_t* list)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_buffer[LINKEDLIST_JUMP_LANES * LINKEDLIST_JUMP_INTERVAL];
+    struct node_t* node_current = NULL;
+    struct node_t* node_tofree = NULL;
+    size_t segment_first = 0;
+    size_t buffer_count = 0;
+    size_t loop_cntr = 0;
+
+    if(NULL != list->head_node_ptr)
+    {
+        if((NULL != list->node_pool_ptr) || (LINKEDLIST_TRAVERSAL_PLAIN == list->traversal_mode))
+        {
+            chain_free(list, list->head_node_ptr, list->tail_node_ptr, list->node_count);
+        }
+        else if((LINKEDLIST_TRAVERSAL_JUMP == list->traversal_mode) && (0u != list->jump_table_count))
+        {
+            /** Several segments are walked at the same time, their nodes are freed once they were all read **/
+            for(segment_first = 0; segment_first < list->jump_table_count; segment_first += LINKEDLIST_JUMP_LANES)
+            {
+                buffer_count = jump_lanes_walk(list, segment_first, node_buffer);
+                for(loop_cntr = 0; loop_cntr < buffer_count; loop_cntr++)
+                {
+                    free(node_buffer[loop_cntr]);
+                }
+                LINKEDLIST_STATS_FREE(buffer_count);
+            }
+        }
+        else
+        {
+            /** Read the next node while the current one is freed **/
+            node_current = list->head_node_ptr;
+            while(NULL != node_current)
+            {
+                node_tofree = node_current;
+                node_current = node_current->next_node_address_ptr;
+                LINKEDLIST_PREFETCH(node_current);
+                memFree_safe((void **)&node_tofree);
+                LINKEDLIST_STATS_NODES(1);
+            }
+        }
+
+        list->head_node_ptr = NULL;
+        list->tail_node_ptr = NULL;
+        list->node_count    = 0;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+    else
+    {
+        /** List is already empty, there are no dynamically allocated nodes to free **/
+    }
+
+    /** The jump table is released even if the list was already empty **/
+    jump_table_release(list);
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_HANDLE_DELETE_ALL);
+    return ret_val;
+}
+
+size_t linkedlist_handle_size(linkedlist_t* list)
+{
+    return list->node_count;
+}
+
+linkedlist_std_ret_t  linkedlist_handle_pool_set(linkedlist_t* list, struct linkedlist_pool_t* pool)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    /** Nodes already in the list weren't taken from the pool, so the pool can only be changed while it is empty **/
+    if(0 == list->node_count)
+    {
+        list->node_pool_ptr = pool;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/** Only a pool based list gets the new nodes with a single allocation, as one run of its pool. A list using malloc()
+    still allocates every node on its own, since each node must be freeable by itself, so the gain is then limited to
+    the single traversal. The same holds for linkedlist_append_array(). **/
+linkedlist_std_ret_t  linkedlist_insert_range(linkedlist_t* list, size_t node_index, const int* data_array,
+                                              size_t data_count)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* chain_first = NULL;
+    struct node_t* chain_last  = NULL;
+    struct node_t* node_current = NULL;
+
+    if((node_index <= list->node_count) && (0u != data_count) &&
+       (LINKEDLIST_OP_SUCCESS == chain_create(list, data_array, data_count, &chain_first, &chain_last)))
+    {
+        if(0u == node_index)
+        {
+            chain_last->next_node_address_ptr = list->head_node_ptr;
+            list->head_node_ptr = chain_first;
+        }
+        else if(node_index == list->node_count)
+        {
+            /** Appending doesn't need any iteration, the handle knows the last node **/
+            list->tail_node_ptr->next_node_address_ptr = chain_first;
+        }
+        else
+        {
+            /** One iteration to reach the node before the required index, then the chain is spliced in at once **/
+            node_current = node_find(list, node_index - 1u);
+            chain_last->next_node_address_ptr = node_current->next_node_address_ptr;
+            node_current->next_node_address_ptr = chain_first;
+        }
+
+        if(node_index == list->node_count)
+        {
+            list->tail_node_ptr = chain_last;
+        }
+        jump_table_invalidate(list);
+        list->node_count = list->node_count + data_count;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_INSERT_RANGE);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_append_array(linkedlist_t* list, const int* data_array, size_t data_count)
+{
+    return linkedlist_insert_range(list, list->node_count, data_array, data_count);
+}
+
+linkedlist_std_ret_t  linkedlist_delete_range(linkedlist_t* list, size_t node_index, size_t node_count)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_previous = NULL;
+    struct node_t* chain_first = list->head_node_ptr;
+    struct node_t* chain_last  = NULL;
+    size_t loop_cntr = 0;
+
+    if((node_index < list->node_count) && (0u != node_count) && (node_count <= (list->node_count - node_index)))
+    {
+        /** Iterate once to reach the node before the range **/
+        if(0u != node_index)
+        {
+            node_previous = node_find(list, node_index - 1u);
+            chain_first = node_previous->next_node_address_ptr;
+        }
+
+        if(node_count == (list->node_count - node_index))
+        {
+            /** The range goes up to the end of the list, so its last node is already known **/
+            chain_last = list->tail_node_ptr;
+            list->tail_node_ptr = node_previous;
+        }
+        else
+        {
+            chain_last = chain_first;
+            for(loop_cntr = 1; loop_cntr < node_count; loop_cntr++)
+            {
+                chain_last = chain_last->next_node_address_ptr;
+            }
+            LINKEDLIST_STATS_NODES(node_count - 1u);
+        }
+
+        /** Unlink the whole range at once **/
+        if(NULL == node_previous)
+        {
+            list->head_node_ptr = chain_last->next_node_address_ptr;
+        }
+        else
+        {
+            node_previous->next_node_address_ptr = chain_last->next_node_address_ptr;
+        }
+        chain_last->next_node_address_ptr = NULL;
+        jump_table_invalidate(list);
+        list->node_count = list->node_count - node_count;
+
+        chain_free(list, chain_first, chain_last, node_count);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_DELETE_RANGE);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_truncate(linkedlist_t* list, size_t new_node_count)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(new_node_count == list->node_count)
+    {
+        /** Nothing to delete **/
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+    else if(new_node_count < list->node_count)
+    {
+        ret_val = linkedlist_delete_range(list, new_node_count, list->node_count - new_node_count);
+    }
+    else
+    {
+        /** A list can't be truncated to more nodes than it has **/
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Cursor Function Definitions >>
+*********************************************************************************************************************/
+linkedlist_std_ret_t  linkedlist_cursor_init(linkedlist_cursor_t* cursor, linkedlist_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if((NULL != cursor) && (NULL != list))
+    {
+        cursor->list_ptr          = list;
+        cursor->node_previous_ptr = NULL;
+        cursor->node_current_ptr  = list->head_node_ptr;
+        cursor->node_index        = 0;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_cursor_init_chain(linkedlist_cursor_t* cursor, struct node_t* head_node)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if((NULL != cursor) && (NULL != head_node))
+    {
+        /** There is no handle to keep up to date, the head node itself is the first node **/
+        cursor->list_ptr          = NULL;
+        cursor->node_previous_ptr = NULL;
+        cursor->node_current_ptr  = head_node;
+        cursor->node_index        = 0;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_cursor_next(linkedlist_cursor_t* cursor)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != cursor->node_current_ptr)
+    {
+        cursor->node_previous_ptr = cursor->node_current_ptr;
+        cursor->node_current_ptr  = cursor->node_current_ptr->next_node_address_ptr;
+        cursor->node_index        = cursor->node_index + 1;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_cursor_peek(linkedlist_cursor_t* cursor, int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != cursor->node_current_ptr)
+    {
+        *current_data = cursor->node_current_ptr->data;
+        ret_val = LINKEDLIST_OP_SUCCESS;
     }
+
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_cursor_insert_after(linkedlist_cursor_t* cursor, int new_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    linkedlist_t* list = cursor->list_ptr;
+    struct node_t* node_new = (NULL != list) ? node_alloc(list) : (struct node_t*)malloc(sizeof(struct node_t));
+
+    if(NULL != node_new)
+    {
+        if(NULL == list)
+        {
+            LINKEDLIST_STATS_ALLOC(1);
+        }
+        node_new->data = new_data;
+
+        if(NULL != cursor->node_current_ptr)
+        {
+            /** Link the new node right after the cursor node, the cursor stays where it is **/
+            node_new->next_node_address_ptr = cursor->node_current_ptr->next_node_address_ptr;
+            cursor->node_current_ptr->next_node_address_ptr = node_new;
+            if((NULL != list) && (list->tail_node_ptr == cursor->node_current_ptr))
+            {
+                list->tail_node_ptr = node_new;
+            }
+        }
+        else
+        {
+            /** Cursor went past the last node, so the new node is appended and the cursor stays past it **/
+            node_new->next_node_address_ptr = NULL;
+            if(NULL != cursor->node_previous_ptr)
+            {
+                cursor->node_previous_ptr->next_node_address_ptr = node_new;
+            }
+            else if(NULL != list)
+            {
+                list->head_node_ptr = node_new;
+            }
+            else
+            {
+                /** Can't happen, a head node based list always has its head node **/
+            }
+            if(NULL != list)
+            {
+                list->tail_node_ptr = node_new;
+            }
+            cursor->node_previous_ptr = node_new;
+            cursor->node_index = cursor->node_index + 1;
+        }
+
+        if(NULL != list)
+        {
+            jump_table_invalidate(list);
+            list->node_count = list->node_count + 1;
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_cursor_erase(linkedlist_cursor_t* cursor)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    linkedlist_t* list = cursor->list_ptr;
+    struct node_t* node_to_delete = cursor->node_current_ptr;
+
+    /** The head node of a head node based list isn't dynamically allocated, so it can't be erased **/
+    if((NULL != node_to_delete) && ((NULL != list) || (NULL != cursor->node_previous_ptr)))
+    {
+        if(NULL != cursor->node_previous_ptr)
+        {
+            cursor->node_previous_ptr->next_node_address_ptr = node_to_delete->next_node_address_ptr;
+        }
+        else
+        {
+            list->head_node_ptr = node_to_delete->next_node_address_ptr;
+        }
+
+        /** The cursor moves to the node after the erased one, which now has the same index **/
+        cursor->node_current_ptr = node_to_delete->next_node_address_ptr;
+
+        if(NULL != list)
+        {
+            if(list->tail_node_ptr == node_to_delete)
+            {
+                list->tail_node_ptr = cursor->node_previous_ptr;
+            }
+            jump_table_invalidate(list);
+            list->node_count = list->node_count - 1;
+            node_free(list, node_to_delete);
+        }
+        else
+        {
+            memFree_safe((void **)&node_to_delete);
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Sort Function Definitions >>
+*********************************************************************************************************************/
+linkedlist_std_ret_t  linkedlist_sort(linkedlist_t* list)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    /** sorted_bins[i] is empty or holds a sorted run of 2^i nodes, runs in higher bins are older **/
+    struct node_t* sorted_bins[LINKEDLIST_SORT_BINS] = {NULL};
+    struct node_t* node_current = NULL;
+    struct node_t* node_carry = NULL;
+    size_t bin_index = 0;
+
+    if(NULL != list)
+    {
+        /** Bottom-up merge sort: every node is merged into the bins like a carry through a binary counter **/
+        node_current = list->head_node_ptr;
+        while(NULL != node_current)
+        {
+            node_carry = node_current;
+            node_current = node_current->next_node_address_ptr;
+            node_carry->next_node_address_ptr = NULL;
+            LINKEDLIST_STATS_NODES(1);
+
+            for(bin_index = 0; (bin_index < (LINKEDLIST_SORT_BINS - 1u)) && (NULL != sorted_bins[bin_index]);
+                bin_index++)
+            {
+                node_carry = chain_merge(sorted_bins[bin_index], node_carry, NULL);
+                sorted_bins[bin_index] = NULL;
+            }
+            sorted_bins[bin_index] = chain_merge(sorted_bins[bin_index], node_carry, NULL);
+        }
+
+        /** Merge the runs left in the bins, older runs first so equal elements keep their order **/
+        node_carry = NULL;
+        for(bin_index = 0; bin_index < LINKEDLIST_SORT_BINS; bin_index++)
+        {
+            node_carry = chain_merge(sorted_bins[bin_index], node_carry, NULL);
+        }
+
+        jump_table_invalidate(list);
+        list->head_node_ptr = node_carry;
+        list->tail_node_ptr = node_carry;
+        while((NULL != list->tail_node_ptr) && (NULL != list->tail_node_ptr->next_node_address_ptr))
+        {
+            list->tail_node_ptr = list->tail_node_ptr->next_node_address_ptr;
+            LINKEDLIST_STATS_NODES(1);
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_SORT);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_merge(linkedlist_t* list, linkedlist_t* list_source)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    int source_last = 0;
+
+    /** Nodes are moved, not copied, so both lists must take their nodes from the same place **/
+    if((NULL != list) && (NULL != list_source) && (list != list_source) &&
+       (list->node_pool_ptr == list_source->node_pool_ptr))
+    {
+        if(NULL != list_source->head_node_ptr)
+        {
+            /** The merged list ends with the rest of one of the lists, so its last node is the last node of that list,
+                whether the lists were sorted or not **/
+            list->head_node_ptr = chain_merge(list->head_node_ptr, list_source->head_node_ptr, &source_last);
+            if(0 != source_last)
+            {
+                list->tail_node_ptr = list_source->tail_node_ptr;
+            }
+            list->node_count    = list->node_count + list_source->node_count;
+
+            list_source->head_node_ptr = NULL;
+            list_source->tail_node_ptr = NULL;
+            list_source->node_count    = 0;
+            jump_table_invalidate(list);
+            jump_table_invalidate(list_source);
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_MERGE);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_dedup(linkedlist_t* list)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_current = NULL;
+    struct node_t* node_to_delete = NULL;
+
+    if(NULL != list)
+    {
+        /** Equal elements of a sorted list are next to each other, only the first of them is kept **/
+        node_current = list->head_node_ptr;
+        while((NULL != node_current) && (NULL != node_current->next_node_address_ptr))
+        {
+            if(node_current->next_node_address_ptr->data == node_current->data)
+            {
+                node_to_delete = node_current->next_node_address_ptr;
+                node_current->next_node_address_ptr = node_to_delete->next_node_address_ptr;
+                node_free(list, node_to_delete);
+                list->node_count = list->node_count - 1;
+            }
+            else
+            {
+                node_current = node_current->next_node_address_ptr;
+            }
+            LINKEDLIST_STATS_NODES(1);
+        }
+        list->tail_node_ptr = node_current;
+        jump_table_invalidate(list);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_DEDUP);
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Locality Function Definitions >>
+*********************************************************************************************************************/
+linkedlist_std_ret_t  linkedlist_compact(linkedlist_t* list)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_run = NULL;
+    struct node_t* node_current = NULL;
+    struct node_t** node_array = NULL;
+    int* data_array = NULL;
+    size_t loop_cntr = 0;
+
+    if((NULL == list) || (list->node_count < 2u))
+    {
+        /** Nothing to compact **/
+        ret_val = (NULL != list) ? LINKEDLIST_OP_SUCCESS : LINKEDLIST_OP_FAIL;
+    }
+    else if(NULL != list->node_pool_ptr)
+    {
+        /** Copy the elements in list order to one run of the pool, then give the old nodes back in O(1) **/
+        node_run = linkedlist_pool_alloc_run(list->node_pool_ptr, list->node_count);
+        if(NULL != node_run)
+        {
+            LINKEDLIST_STATS_ALLOC(list->node_count);
+            LINKEDLIST_STATS_NODES(list->node_count);
+            node_current = list->head_node_ptr;
+            for(loop_cntr = 0; loop_cntr < list->node_count; loop_cntr++)
+            {
+                node_run[loop_cntr].data = node_current->data;
+                node_run[loop_cntr].next_node_address_ptr = &node_run[loop_cntr + 1u];
+                node_current = node_current->next_node_address_ptr;
+            }
+            node_run[list->node_count - 1u].next_node_address_ptr = NULL;
+
+            chain_free(list, list->head_node_ptr, list->tail_node_ptr, list->node_count);
+            jump_table_invalidate(list);
+            list->head_node_ptr = node_run;
+            list->tail_node_ptr = &node_run[list->node_count - 1u];
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+    }
+    else
+    {
+        /** Nodes allocated one by one can't be moved, so the elements are moved instead: the nodes are relinked in
+            increasing address order and the elements are written back in list order. Traversal then always moves
+            forward in memory, and nodes that were allocated next to each other are visited one after the other. **/
+        node_array = (struct node_t**)malloc(list->node_count * sizeof(struct node_t*));
+        data_array = (int*)malloc(list->node_count * sizeof(int));
+        if((NULL != node_array) && (NULL != data_array))
+        {
+            node_current = list->head_node_ptr;
+            for(loop_cntr = 0; loop_cntr < list->node_count; loop_cntr++)
+            {
+                node_array[loop_cntr] = node_current;
+                data_array[loop_cntr] = node_current->data;
+                node_current = node_current->next_node_address_ptr;
+            }
+            qsort(node_array, list->node_count, sizeof(struct node_t*), address_compare);
+            LINKEDLIST_STATS_NODES(2u * list->node_count);
+
+            for(loop_cntr = 0; loop_cntr < list->node_count; loop_cntr++)
+            {
+                node_array[loop_cntr]->data = data_array[loop_cntr];
+                node_array[loop_cntr]->next_node_address_ptr =
+                    ((loop_cntr + 1u) < list->node_count) ? node_array[loop_cntr + 1u] : NULL;
+            }
+            jump_table_invalidate(list);
+            list->head_node_ptr = node_array[0];
+            list->tail_node_ptr = node_array[list->node_count - 1u];
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+        free(node_array);
+        free(data_array);
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_COMPACT);
+    return ret_val;
+}
+
+double linkedlist_stride_average(linkedlist_t* list)
+{
+    double stride_sum = 0.0;
+    double stride_average = 0.0;
+    struct node_t* node_current = NULL;
+    uintptr_t address_current = 0;
+    uintptr_t address_next = 0;
+
+    if((NULL != list) && (list->node_count >= 2u))
+    {
+        /** Average distance in bytes between the addresses of consecutive nodes, in either direction. Nodes lying next
+            to each other in list order give sizeof(struct node_t). **/
+        for(node_current = list->head_node_ptr; NULL != node_current->next_node_address_ptr;
+            node_current = node_current->next_node_address_ptr)
+        {
+            address_current = (uintptr_t)node_current;
+            address_next    = (uintptr_t)node_current->next_node_address_ptr;
+            stride_sum += (double)((address_next > address_current) ? (address_next - address_current) :
+                                                                      (address_current - address_next));
+        }
+        stride_average = stride_sum / (double)(list->node_count - 1u);
+    }
+
+    return stride_average;
+}
+
+linkedlist_std_ret_t  linkedlist_compact_if_fragmented(linkedlist_t* list, double stride_threshold)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_SUCCESS;
+
+    if(linkedlist_stride_average(list) > stride_threshold)
+    {
+        ret_val = linkedlist_compact(list);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Traversal Function Definitions >>
+*********************************************************************************************************************/
+linkedlist_std_ret_t  linkedlist_traversal_set(linkedlist_t* list, linkedlist_traversal_t traversal_mode)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if((NULL != list) && ((LINKEDLIST_TRAVERSAL_PLAIN == traversal_mode) ||
+       (LINKEDLIST_TRAVERSAL_PREFETCH == traversal_mode) || (LINKEDLIST_TRAVERSAL_JUMP == traversal_mode)))
+    {
+        list->traversal_mode = traversal_mode;
+        if(LINKEDLIST_TRAVERSAL_JUMP != traversal_mode)
+        {
+            /** Only the jump mode uses the table, its memory is given back right away **/
+            jump_table_release(list);
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_for_each(linkedlist_t* list, void (*visit_function)(int data, void* context),
+                                          void* context)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_buffer[LINKEDLIST_JUMP_LANES * LINKEDLIST_JUMP_INTERVAL];
+    struct node_t* node_current = NULL;
+    size_t segment_first = 0;
+    size_t buffer_count = 0;
+    size_t loop_cntr = 0;
+
+    if((NULL != list) && (NULL != visit_function))
+    {
+        if((LINKEDLIST_TRAVERSAL_JUMP == list->traversal_mode) && (0u == list->jump_table_count) &&
+           (0u != list->node_count))
+        {
+            (void)jump_table_build(list);
+        }
+
+        if(0u != list->jump_table_count)
+        {
+            /** Nodes of several segments are read at the same time, then visited in list order **/
+            for(segment_first = 0; segment_first < list->jump_table_count; segment_first += LINKEDLIST_JUMP_LANES)
+            {
+                buffer_count = jump_lanes_walk(list, segment_first, node_buffer);
+                for(loop_cntr = 0; loop_cntr < buffer_count; loop_cntr++)
+                {
+                    visit_function(node_buffer[loop_cntr]->data, context);
+                }
+            }
+        }
+        else
+        {
+            for(node_current = list->head_node_ptr; NULL != node_current;
+                node_current = node_current->next_node_address_ptr)
+            {
+                if(LINKEDLIST_TRAVERSAL_PREFETCH == list->traversal_mode)
+                {
+                    /** Read the next node while the current one is visited **/
+                    LINKEDLIST_PREFETCH(node_current->next_node_address_ptr);
+                }
+                visit_function(node_current->data, context);
+                LINKEDLIST_STATS_NODES(1);
+            }
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_FOR_EACH);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_split_points(linkedlist_t* list, size_t split_count, struct node_t** split_nodes)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_current = NULL;
+    size_t split_index = 0;
+    size_t node_index = 0;
+
+    if((NULL != list) && (NULL != split_nodes) && (0u != split_count) && (split_count <= list->node_count))
+    {
+        if((LINKEDLIST_TRAVERSAL_JUMP == list->traversal_mode) && (0u == list->jump_table_count))
+        {
+            (void)jump_table_build(list);
+        }
+
+        /** Part split_index starts at node (split_index * node_count) / split_count, so the parts differ by at most
+            one node. The jump table gives every start without walking the list, otherwise one pass finds them all. **/
+        node_current = list->head_node_ptr;
+        for(split_index = 0; split_index < split_count; split_index++)
+        {
+            if(0u != list->jump_table_count)
+            {
+                split_nodes[split_index] = node_find(list, (split_index * list->node_count) / split_count);
+            }
+            else
+            {
+                while(node_index < ((split_index * list->node_count) / split_count))
+                {
+                    node_current = node_current->next_node_address_ptr;
+                    node_index = node_index + 1;
+                }
+                split_nodes[split_index] = node_current;
+            }
+        }
+        LINKEDLIST_STATS_NODES(node_index);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Search Function Definitions >>
+*********************************************************************************************************************/
+linkedlist_std_ret_t  linkedlist_index_of(linkedlist_t* list, int data, size_t* node_index)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_current = NULL;
+    size_t loop_cntr = 0;
+
+    if((NULL != list) && (NULL != node_index))
+    {
+        node_current = list->head_node_ptr;
+        while((NULL != node_current) && (data != node_current->data))
+        {
+            node_current = node_current->next_node_address_ptr;
+            loop_cntr = loop_cntr + 1;
+        }
+        LINKEDLIST_STATS_NODES(loop_cntr);
+
+        if(NULL != node_current)
+        {
+            *node_index = loop_cntr;
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_INDEX_OF);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_count_of(linkedlist_t* list, int data, size_t* match_count)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_current = NULL;
+    size_t count = 0;
+
+    if((NULL != list) && (NULL != match_count))
+    {
+        for(node_current = list->head_node_ptr; NULL != node_current;
+            node_current = node_current->next_node_address_ptr)
+        {
+            count = count + ((data == node_current->data) ? 1u : 0u);
+        }
+        LINKEDLIST_STATS_NODES(list->node_count);
+        *match_count = count;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_COUNT_OF);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_contains(linkedlist_t* list, int data)
+{
+    size_t node_index = 0;
+
+    return linkedlist_index_of(list, data, &node_index);
+}
+
+/*********************************************************************************************************************
+                                  << Splice Function Definitions >>
+*********************************************************************************************************************/
+linkedlist_std_ret_t  linkedlist_concat(linkedlist_t* list, linkedlist_t* list_source)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    /** Nodes are moved, not copied, so both lists must take their nodes from the same place **/
+    if((NULL != list) && (NULL != list_source) && (list != list_source) &&
+       (list->node_pool_ptr == list_source->node_pool_ptr))
+    {
+        if(NULL != list_source->head_node_ptr)
+        {
+            if(NULL == list->tail_node_ptr)
+            {
+                list->head_node_ptr = list_source->head_node_ptr;
+            }
+            else
+            {
+                list->tail_node_ptr->next_node_address_ptr = list_source->head_node_ptr;
+            }
+            list->tail_node_ptr = list_source->tail_node_ptr;
+            list->node_count    = list->node_count + list_source->node_count;
+
+            list_source->head_node_ptr = NULL;
+            list_source->tail_node_ptr = NULL;
+            list_source->node_count    = 0;
+            jump_table_invalidate(list);
+            jump_table_invalidate(list_source);
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_CONCAT);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_split(linkedlist_t* list, size_t node_index, linkedlist_t* list_tail)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    /** list_tail must be empty, and take its nodes from the same place as list **/
+    if((NULL != list) && (NULL != list_tail) && (list != list_tail) && (0u == list_tail->node_count) &&
+       (list->node_pool_ptr == list_tail->node_pool_ptr) && (node_index <= list->node_count))
+    {
+        ret_val = linkedlist_splice(list_tail, 0, list, node_index, list->node_count - node_index);
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_SPLIT);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_splice(linkedlist_t* list, size_t node_index, linkedlist_t* list_source,
+                                        size_t source_index, size_t node_count)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* source_previous = NULL;
+    struct node_t* node_previous = NULL;
+    struct node_t* chain_first = NULL;
+    struct node_t* chain_last  = NULL;
+    size_t loop_cntr = 0;
+
+    if((NULL != list) && (NULL != list_source) && (list != list_source) &&
+       (list->node_pool_ptr == list_source->node_pool_ptr) && (node_index <= list->node_count) &&
+       (source_index <= list_source->node_count) && (node_count <= (list_source->node_count - source_index)))
+    {
+        if(0u != node_count)
+        {
+            /** Find the range in list_source, its last node is already known if it goes up to the end **/
+            chain_first = list_source->head_node_ptr;
+            if(0u != source_index)
+            {
+                source_previous = node_find(list_source, source_index - 1u);
+                chain_first = source_previous->next_node_address_ptr;
+            }
+            if(node_count == (list_source->node_count - source_index))
+            {
+                chain_last = list_source->tail_node_ptr;
+                list_source->tail_node_ptr = source_previous;
+            }
+            else
+            {
+                chain_last = chain_first;
+                for(loop_cntr = 1; loop_cntr < node_count; loop_cntr++)
+                {
+                    chain_last = chain_last->next_node_address_ptr;
+                }
+                LINKEDLIST_STATS_NODES(node_count - 1u);
+            }
+
+            /** Unlink the whole range from list_source at once **/
+            if(NULL == source_previous)
+            {
+                list_source->head_node_ptr = chain_last->next_node_address_ptr;
+            }
+            else
+            {
+                source_previous->next_node_address_ptr = chain_last->next_node_address_ptr;
+            }
+            list_source->node_count = list_source->node_count - node_count;
+
+            /** Link it into list, the first and the last node of list are reached without iterating **/
+            if(0u == node_index)
+            {
+                chain_last->next_node_address_ptr = list->head_node_ptr;
+                list->head_node_ptr = chain_first;
+            }
+            else
+            {
+                node_previous = (node_index == list->node_count) ? list->tail_node_ptr :
+                                                                   node_find(list, node_index - 1u);
+                chain_last->next_node_address_ptr = node_previous->next_node_address_ptr;
+                node_previous->next_node_address_ptr = chain_first;
+            }
+            if(node_index == list->node_count)
+            {
+                list->tail_node_ptr = chain_last;
+            }
+            list->node_count = list->node_count + node_count;
+
+            jump_table_invalidate(list);
+            jump_table_invalidate(list_source);
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_SPLICE);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_splice_cursor(linkedlist_cursor_t* cursor, linkedlist_cursor_t* source_cursor,
+                                               size_t node_count)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    linkedlist_t* list = NULL;
+    linkedlist_t* list_source = NULL;
+    struct node_t* chain_first = NULL;
+    struct node_t* chain_last  = NULL;
+    size_t loop_cntr = 0;
+
+    if((NULL != cursor) && (NULL != source_cursor))
+    {
+        list = cursor->list_ptr;
+        list_source = source_cursor->list_ptr;
+    }
+
+    /** Both cursors must walk handle based lists, and the range must start at the source cursor node **/
+    if((NULL != list) && (NULL != list_source) && (list != list_source) &&
+       (list->node_pool_ptr == list_source->node_pool_ptr) &&
+       (node_count <= (list_source->node_count - source_cursor->node_index)))
+    {
+        if(0u != node_count)
+        {
+            /** Find the last node of the range, it is already known if the range goes up to the end **/
+            chain_first = source_cursor->node_current_ptr;
+            if(node_count == (list_source->node_count - source_cursor->node_index))
+            {
+                chain_last = list_source->tail_node_ptr;
+                list_source->tail_node_ptr = source_cursor->node_previous_ptr;
+            }
+            else
+            {
+                chain_last = chain_first;
+                for(loop_cntr = 1; loop_cntr < node_count; loop_cntr++)
+                {
+                    chain_last = chain_last->next_node_address_ptr;
+                }
+                LINKEDLIST_STATS_NODES(node_count - 1u);
+            }
+
+            /** Unlink the range from list_source, the source cursor moves to the node after it, at the same index **/
+            if(NULL == source_cursor->node_previous_ptr)
+            {
+                list_source->head_node_ptr = chain_last->next_node_address_ptr;
+            }
+            else
+            {
+                source_cursor->node_previous_ptr->next_node_address_ptr = chain_last->next_node_address_ptr;
+            }
+            source_cursor->node_current_ptr = chain_last->next_node_address_ptr;
+            list_source->node_count = list_source->node_count - node_count;
+
+            /** Link it before the cursor node, the cursor stays at its node, which is node_count indexes further **/
+            chain_last->next_node_address_ptr = cursor->node_current_ptr;
+            if(NULL == cursor->node_previous_ptr)
+            {
+                list->head_node_ptr = chain_first;
+            }
+            else
+            {
+                cursor->node_previous_ptr->next_node_address_ptr = chain_first;
+            }
+            if(NULL == cursor->node_current_ptr)
+            {
+                list->tail_node_ptr = chain_last;
+            }
+            cursor->node_previous_ptr = chain_last;
+            cursor->node_index = cursor->node_index + node_count;
+            list->node_count = list->node_count + node_count;
+
+            jump_table_invalidate(list);
+            jump_table_invalidate(list_source);
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_SPLICE_CURSOR);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_reverse(linkedlist_t* list)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_previous = NULL;
+    struct node_t* node_current = NULL;
+    struct node_t* node_next = NULL;
+
+    if(NULL != list)
+    {
+        /** Turn every link around, the nodes stay where they are **/
+        node_current = list->head_node_ptr;
+        while(NULL != node_current)
+        {
+            node_next = node_current->next_node_address_ptr;
+            node_current->next_node_address_ptr = node_previous;
+            node_previous = node_current;
+            node_current = node_next;
+        }
+        LINKEDLIST_STATS_NODES(list->node_count);
+
+        list->tail_node_ptr = list->head_node_ptr;
+        list->head_node_ptr = node_previous;
+        jump_table_invalidate(list);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_REVERSE);
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Array Function Definitions >>
+*********************************************************************************************************************/
+linkedlist_std_ret_t  linkedlist_to_array(linkedlist_t* list, int* data_array)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_buffer[LINKEDLIST_JUMP_LANES * LINKEDLIST_JUMP_INTERVAL];
+    struct node_t* node_current = NULL;
+    size_t segment_first = 0;
+    size_t buffer_count = 0;
+    size_t array_index = 0;
+    size_t loop_cntr = 0;
+
+    if((NULL != list) && ((NULL != data_array) || (0u == list->node_count)))
+    {
+        if((LINKEDLIST_TRAVERSAL_JUMP == list->traversal_mode) && (0u == list->jump_table_count) &&
+           (0u != list->node_count))
+        {
+            (void)jump_table_build(list);
+        }
+
+        if(0u != list->jump_table_count)
+        {
+            /** Segments are read side by side and come back in list order, so they are copied as they are **/
+            for(segment_first = 0; segment_first < list->jump_table_count; segment_first += LINKEDLIST_JUMP_LANES)
+            {
+                buffer_count = jump_lanes_walk(list, segment_first, node_buffer);
+                for(loop_cntr = 0; loop_cntr < buffer_count; loop_cntr++)
+                {
+                    data_array[array_index + loop_cntr] = node_buffer[loop_cntr]->data;
+                }
+                array_index = array_index + buffer_count;
+            }
+        }
+        else
+        {
+            for(node_current = list->head_node_ptr; NULL != node_current;
+                node_current = node_current->next_node_address_ptr)
+            {
+                if(LINKEDLIST_TRAVERSAL_PREFETCH == list->traversal_mode)
+                {
+                    LINKEDLIST_PREFETCH(node_current->next_node_address_ptr);
+                }
+                data_array[array_index] = node_current->data;
+                array_index = array_index + 1u;
+            }
+            LINKEDLIST_STATS_NODES(array_index);
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_TO_ARRAY);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_to_chunks(linkedlist_t* list, int* chunk_buffer, size_t chunk_size,
+                                           linkedlist_std_ret_t (*chunk_function)(const int* data_array,
+                                                                                  size_t data_count, void* context),
+                                           void* context)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* node_current = NULL;
+    size_t chunk_count = 0;
+    size_t loop_cntr = 0;
+
+    if((NULL != list) && (NULL != chunk_buffer) && (0u != chunk_size) && (NULL != chunk_function))
+    {
+        /** Only one chunk of the list is copied at a time, whatever its size. The walk ends early if the function
+            fails on a chunk. **/
+        ret_val = LINKEDLIST_OP_SUCCESS;
+        node_current = list->head_node_ptr;
+        while((NULL != node_current) && (LINKEDLIST_OP_SUCCESS == ret_val))
+        {
+            for(chunk_count = 0; (chunk_count < chunk_size) && (NULL != node_current); chunk_count++)
+            {
+                if(LINKEDLIST_TRAVERSAL_PLAIN != list->traversal_mode)
+                {
+                    LINKEDLIST_PREFETCH(node_current->next_node_address_ptr);
+                }
+                chunk_buffer[chunk_count] = node_current->data;
+                node_current = node_current->next_node_address_ptr;
+            }
+            loop_cntr = loop_cntr + chunk_count;
+            ret_val = chunk_function(chunk_buffer, chunk_count, context);
+        }
+        LINKEDLIST_STATS_NODES(loop_cntr);
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_TO_CHUNKS);
+    return ret_val;
+}
+
+linkedlist_std_ret_t  linkedlist_from_array(linkedlist_t* list, const int* data_array, size_t data_count)
+{
+    LINKEDLIST_STATS_BEGIN();
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct node_t* chain_first = NULL;
+    struct node_t* chain_last  = NULL;
+    struct node_t* node_current = NULL;
+    struct node_t* node_last = NULL;
+    size_t reuse_count = 0;
+    size_t loop_cntr = 0;
+
+    if((NULL != list) && ((NULL != data_array) || (0u == data_count)))
+    {
+        reuse_count = (data_count < list->node_count) ? data_count : list->node_count;
+
+        /** The missing nodes are made first, all at once, so the list stays as it was if there's no memory **/
+        ret_val = LINKEDLIST_OP_SUCCESS;
+        if(data_count > reuse_count)
+        {
+            ret_val = chain_create(list, &data_array[reuse_count], data_count - reuse_count, &chain_first,
+                                   &chain_last);
+        }
+
+        if(LINKEDLIST_OP_SUCCESS == ret_val)
+        {
+            /** The nodes the list already has are given the new data, rather than being freed and made again **/
+            node_current = list->head_node_ptr;
+            for(loop_cntr = 0; loop_cntr < reuse_count; loop_cntr++)
+            {
+                node_current->data = data_array[loop_cntr];
+                node_last = node_current;
+                node_current = node_current->next_node_address_ptr;
+            }
+            LINKEDLIST_STATS_NODES(reuse_count);
+
+            if(NULL != chain_first)
+            {
+                if(NULL == node_last)
+                {
+                    list->head_node_ptr = chain_first;
+                }
+                else
+                {
+                    node_last->next_node_address_ptr = chain_first;
+                }
+                list->tail_node_ptr = chain_last;
+                jump_table_invalidate(list);
+            }
+            else if(NULL != node_current)
+            {
+                /** The list had more nodes than data, the rest of them are freed together **/
+                chain_free(list, node_current, list->tail_node_ptr, list->node_count - reuse_count);
+                if(NULL == node_last)
+                {
+                    list->head_node_ptr = NULL;
+                }
+                else
+                {
+                    node_last->next_node_address_ptr = NULL;
+                }
+                list->tail_node_ptr = node_last;
+                jump_table_invalidate(list);
+            }
+            else
+            {
+                /** Same number of nodes, the links and the jump table didn't change **/
+            }
+            list->node_count = data_count;
+        }
+    }
+
+    LINKEDLIST_STATS_END(LINKEDLIST_STATS_FROM_ARRAY);
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+static void memFree_safe(void** pointer_to_free)
+{
+    if(*pointer_to_free!= NULL) /**Checking is made so it doesn't re-free a NULL pointer**/
+    {
+        LINKEDLIST_STATS_FREE(1);
+        free(*pointer_to_free);
+        *pointer_to_free = NULL; /** Set freed pointer as NULL, so it doesn't become dangling. **/
+    }
+}
+
+static struct node_t* node_alloc(linkedlist_t* list)
+{
+    struct node_t* node_new = NULL;
+
+    if(NULL != list->node_pool_ptr)
+    {
+        node_new = linkedlist_pool_alloc(list->node_pool_ptr);
+    }
+    else
+    {
+        node_new = (struct node_t*)malloc(sizeof(struct node_t));
+    }
+    LINKEDLIST_STATS_ALLOC(NULL != node_new);
+
+    return node_new;
+}
+
+static void node_free(linkedlist_t* list, struct node_t* node_tofree)
+{
+    if(NULL != list->node_pool_ptr)
+    {
+        LINKEDLIST_STATS_FREE(1);
+        linkedlist_pool_free(list->node_pool_ptr, node_tofree);
+    }
+    else
+    {
+        memFree_safe((void **)&node_tofree);
+    }
+}
+
+/** Frees a chain of linked nodes that was already unlinked from the list. A pool based list hands the whole chain
+    back to its pool at once. **/
+static void chain_free(linkedlist_t* list, struct node_t* chain_first, struct node_t* chain_last,
+                       size_t chain_count)
+{
+    struct node_t* node_tofree = NULL;
+
+    if(NULL != list->node_pool_ptr)
+    {
+        LINKEDLIST_STATS_FREE(chain_count);
+        linkedlist_pool_free_chain(list->node_pool_ptr, chain_first, chain_last, chain_count);
+    }
+    else
+    {
+        while(NULL != chain_first)
+        {
+            node_tofree = chain_first;
+            chain_first = chain_first->next_node_address_ptr;
+            memFree_safe((void **)&node_tofree); /** Safely free that memory **/
+            LINKEDLIST_STATS_NODES(1);
+        }
+    }
+}
+
+/** Creates data_count linked nodes holding data_array. Nodes of a pool based list are taken as one run of the pool,
+    so they are allocated at once and lie next to each other in memory. Otherwise they are allocated one by one, since
+    every node has to be freeable on its own. **/
+static linkedlist_std_ret_t chain_create(linkedlist_t* list, const int* data_array, size_t data_count,
+                                         struct node_t** chain_first, struct node_t** chain_last)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_SUCCESS;
+    struct node_t* node_run = NULL;
+    struct node_t* node_new = NULL;
+    struct node_t* node_tofree = NULL;
+    size_t loop_cntr = 0;
+
+    if(NULL != list->node_pool_ptr)
+    {
+        node_run = linkedlist_pool_alloc_run(list->node_pool_ptr, data_count);
+        if(NULL != node_run)
+        {
+            LINKEDLIST_STATS_ALLOC(data_count);
+            for(loop_cntr = 0; loop_cntr < (data_count - 1u); loop_cntr++)
+            {
+                node_run[loop_cntr].data = data_array[loop_cntr];
+                node_run[loop_cntr].next_node_address_ptr = &node_run[loop_cntr + 1u];
+            }
+            node_run[data_count - 1u].data = data_array[data_count - 1u];
+            node_run[data_count - 1u].next_node_address_ptr = NULL;
+            *chain_first = node_run;
+            *chain_last  = &node_run[data_count - 1u];
+        }
+        else
+        {
+            ret_val = LINKEDLIST_OP_FAIL;
+        }
+    }
+    else
+    {
+        *chain_first = NULL;
+        *chain_last  = NULL;
+        for(loop_cntr = 0; (loop_cntr < data_count) && (LINKEDLIST_OP_SUCCESS == ret_val); loop_cntr++)
+        {
+            node_new = (struct node_t*)malloc(sizeof(struct node_t));
+            if(NULL != node_new)
+            {
+                LINKEDLIST_STATS_ALLOC(1);
+                node_new->data = data_array[loop_cntr];
+                node_new->next_node_address_ptr = NULL;
+                if(NULL == *chain_last)
+                {
+                    *chain_first = node_new;
+                }
+                else
+                {
+                    (*chain_last)->next_node_address_ptr = node_new;
+                }
+                *chain_last = node_new;
+            }
+            else
+            {
+                /** Out of memory, free the part of the chain that was created, the list stays as it was **/
+                while(NULL != *chain_first)
+                {
+                    node_tofree  = *chain_first;
+                    *chain_first = (*chain_first)->next_node_address_ptr;
+                    memFree_safe((void **)&node_tofree);
+                }
+                ret_val = LINKEDLIST_OP_FAIL;
+            }
+        }
+    }
+
+    return ret_val;
+}
+
+static int address_compare(const void* address_a, const void* address_b)
+{
+    uintptr_t value_a = (uintptr_t)*(struct node_t* const*)address_a;
+    uintptr_t value_b = (uintptr_t)*(struct node_t* const*)address_b;
+
+    return (value_a > value_b) - (value_a < value_b);
+}
+
+/** Merges two sorted chains ended by NULL into one, taking from chain a first on equal elements. If chain_b_last isn't
+    NULL, it is set to 1 when the merged chain ends with the rest of chain b, to 0 when it ends with chain a. **/
+static struct node_t* chain_merge(struct node_t* chain_first_a, struct node_t* chain_first_b, int* chain_b_last)
+{
+    struct node_t merged_head;
+    struct node_t* node_last = &merged_head;
+
+    while((NULL != chain_first_a) && (NULL != chain_first_b))
+    {
+        if(chain_first_a->data <= chain_first_b->data)
+        {
+            node_last->next_node_address_ptr = chain_first_a;
+            chain_first_a = chain_first_a->next_node_address_ptr;
+        }
+        else
+        {
+            node_last->next_node_address_ptr = chain_first_b;
+            chain_first_b = chain_first_b->next_node_address_ptr;
+        }
+        node_last = node_last->next_node_address_ptr;
+        LINKEDLIST_STATS_NODES(1);
+    }
+    node_last->next_node_address_ptr = (NULL != chain_first_a) ? chain_first_a : chain_first_b;
+    if(NULL != chain_b_last)
+    {
+        *chain_b_last = (NULL == chain_first_a);
+    }
+
+    return merged_head.next_node_address_ptr;
+}
+
+/** Returns the node at node_index, which must be in range. Walks from the closest skip pointer before it if the list
+    has an up to date jump table, from the first node otherwise. **/
+static struct node_t* node_find(linkedlist_t* list, size_t node_index)
+{
+    struct node_t* node_current = list->head_node_ptr;
+    size_t steps_count = node_index;
+    size_t loop_cntr = 0;
+
+    if(0u != list->jump_table_count)
+    {
+        node_current = list->jump_table_ptr[node_index / LINKEDLIST_JUMP_INTERVAL];
+        steps_count  = node_index % LINKEDLIST_JUMP_INTERVAL;
+    }
+
+    for(loop_cntr = 0; loop_cntr < steps_count; loop_cntr++)
+    {
+        node_current = node_current->next_node_address_ptr;
+    }
+    LINKEDLIST_STATS_NODES(steps_count);
+
+    return node_current;
+}
+
+/** Marks the jump table as out of date, its memory is kept for the next rebuild **/
+static void jump_table_invalidate(linkedlist_t* list)
+{
+    list->jump_table_count = 0;
+}
+
+static void jump_table_release(linkedlist_t* list)
+{
+    free(list->jump_table_ptr);
+    list->jump_table_ptr      = NULL;
+    list->jump_table_count    = 0;
+    list->jump_table_capacity = 0;
+}
+
+/** Stores every LINKEDLIST_JUMP_INTERVAL-th node in the jump table. The table is made a bit larger than needed, so the
+    skip pointers of appended nodes can be added without rebuilding it. **/
+static linkedlist_std_ret_t jump_table_build(linkedlist_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    size_t jump_count = (list->node_count + LINKEDLIST_JUMP_INTERVAL - 1u) / LINKEDLIST_JUMP_INTERVAL;
+    size_t jump_capacity = jump_count + (jump_count / 8u) + 1u;
+    struct node_t** jump_table = list->jump_table_ptr;
+    struct node_t* node_current = list->head_node_ptr;
+    size_t loop_cntr = 0;
+
+    if(jump_count > list->jump_table_capacity)
+    {
+        jump_table = (struct node_t**)realloc(list->jump_table_ptr, jump_capacity * sizeof(struct node_t*));
+        if(NULL != jump_table)
+        {
+            list->jump_table_ptr      = jump_table;
+            list->jump_table_capacity = jump_capacity;
+        }
+    }
+
+    if((NULL != jump_table) && (0u != jump_count))
+    {
+        for(loop_cntr = 0; loop_cntr < list->node_count; loop_cntr++)
+        {
+            if(0u == (loop_cntr % LINKEDLIST_JUMP_INTERVAL))
+            {
+                jump_table[loop_cntr / LINKEDLIST_JUMP_INTERVAL] = node_current;
+            }
+            node_current = node_current->next_node_address_ptr;
+        }
+        list->jump_table_count = jump_count;
+        LINKEDLIST_STATS_NODES(list->node_count);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/** Reads the nodes of up to LINKEDLIST_JUMP_LANES segments starting at segment_first into node_buffer, in list order,
+    and returns how many were read. Each step reads one node of every segment, and these reads don't depend on each
+    other, so the processor can have all of them in flight at once. **/
+static size_t jump_lanes_walk(linkedlist_t* list, size_t segment_first, struct node_t** node_buffer)
+{
+    struct node_t* node_lanes[LINKEDLIST_JUMP_LANES];
+    size_t lane_length[LINKEDLIST_JUMP_LANES];
+    size_t lane_count = list->jump_table_count - segment_first;
+    size_t buffer_count = 0;
+    size_t lane_index = 0;
+    size_t step_index = 0;
+
+    if(lane_count > LINKEDLIST_JUMP_LANES)
+    {
+        lane_count = LINKEDLIST_JUMP_LANES;
+    }
+
+    /** Every segment holds LINKEDLIST_JUMP_INTERVAL nodes, except the last segment of the list **/
+    for(lane_index = 0; lane_index < lane_count; lane_index++)
+    {
+        node_lanes[lane_index]  = list->jump_table_ptr[segment_first + lane_index];
+        lane_length[lane_index] = list->node_count - ((segment_first + lane_index) * LINKEDLIST_JUMP_INTERVAL);
+        if(lane_length[lane_index] > LINKEDLIST_JUMP_INTERVAL)
+        {
+            lane_length[lane_index] = LINKEDLIST_JUMP_INTERVAL;
+        }
+        buffer_count = buffer_count + lane_length[lane_index];
+    }
+
+    for(step_index = 0; step_index < LINKEDLIST_JUMP_INTERVAL; step_index++)
+    {
+        for(lane_index = 0; lane_index < lane_count; lane_index++)
+        {
+            if(step_index < lane_length[lane_index])
+            {
+                node_buffer[(lane_index * LINKEDLIST_JUMP_INTERVAL) + step_index] = node_lanes[lane_index];
+                node_lanes[lane_index] = node_lanes[lane_index]->next_node_address_ptr;
+            }
+        }
+    }
+    LINKEDLIST_STATS_NODES(buffer_count);
+
+    return buffer_count;
 }
 
 /*********************************************************************************************************************
@@ -0,0 +1,265 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: linkedlist_generic.h
+* File Description: This file contains the LINKEDLIST_DEFINE() macro, which generates a linkedlist specialized for
+* any element type, with the element stored inside the node.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef LINKEDLIST_GENERIC_H_INCLUDED
+#define LINKEDLIST_GENERIC_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Macros >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Macro Name:
+*  LINKEDLIST_DEFINE
+*
+** Description:
+*  Generates a linkedlist whose nodes store an element of type T inline, in place of the int of struct node_t. The
+*  generated datatypes and functions are named after the given name, and have the same operations and return values
+*  as the linkedlist handle based functions. The functions are static inline, so every file using the macro gets its
+*  own copy, which the compiler can optimize the same as hand written code for that type.
+*
+*  Generated datatypes:
+*  [1] struct name_node_t: node with "T data" and "struct name_node_t* next_node_address_ptr".
+*  [2] name_t: handle with head_node_ptr, tail_node_ptr and node_count, the same as linkedlist_t.
+*
+*  Generated functions, all returning linkedlist_std_ret_t except name_size():
+*  name_init(name_t* list)
+*  name_insert_end(name_t* list, T new_data)
+*  name_insert_index(name_t* list, size_t node_index, T new_data)
+*  name_get_end(name_t* list, T* current_data)
+*  name_get_index(name_t* list, size_t node_index, T* current_data)
+*  name_delete_end(name_t* list)
+*  name_delete_index(name_t* list, size_t node_index)
+*  name_delete_all(name_t* list)
+*  name_size(name_t* list)
+*
+** Macro Parameters:
+*  - name: prefix of the generated datatypes and functions.
+*  - T: element type, any type that can be assigned.
+*
+** Use Example: Create a list of points:
+*  typedef struct { double x; double y; } point_t;
+*  LINKEDLIST_DEFINE(pointlist, point_t)
+*
+*  pointlist_t my_points;
+*  point_t origin = {0.0, 0.0};
+*  pointlist_init(&my_points);
+*  pointlist_insert_end(&my_points, origin);
+*  pointlist_delete_all(&my_points);
+*********************************************************************************************************************/
+#define LINKEDLIST_DEFINE(name, T)                                                                                    \
+                                                                                                                      \
+struct name##_node_t                                                                                                  \
+{                                                                                                                     \
+    T data;                                                                                                           \
+    struct name##_node_t* next_node_address_ptr;                                                                      \
+};                                                                                                                    \
+                                                                                                                      \
+typedef struct                                                                                                        \
+{                                                                                                                     \
+    struct name##_node_t* head_node_ptr;                                                                              \
+    struct name##_node_t* tail_node_ptr;                                                                              \
+    size_t node_count;                                                                                                \
+} name##_t;                                                                                                           \
+                                                                                                                      \
+static inline linkedlist_std_ret_t name##_init(name##_t* list)                                                        \
+{                                                                                                                     \
+    list->head_node_ptr = NULL;                                                                                       \
+    list->tail_node_ptr = NULL;                                                                                       \
+    list->node_count    = 0;                                                                                          \
+    return LINKEDLIST_OP_SUCCESS;                                                                                     \
+}                                                                                                                     \
+                                                                                                                      \
+static inline linkedlist_std_ret_t name##_insert_end(name##_t* list, T new_data)                                      \
+{                                                                                                                     \
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;                                                                \
+    struct name##_node_t* node_new = (struct name##_node_t*)malloc(sizeof(struct name##_node_t));                     \
+                                                                                                                      \
+    if(NULL != node_new)                                                                                              \
+    {                                                                                                                 \
+        node_new->data = new_data;                                                                                    \
+        node_new->next_node_address_ptr = NULL;                                                                       \
+        if(NULL == list->tail_node_ptr)                                                                               \
+        {                                                                                                             \
+            list->head_node_ptr = node_new;                                                                           \
+        }                                                                                                             \
+        else                                                                                                          \
+        {                                                                                                             \
+            list->tail_node_ptr->next_node_address_ptr = node_new;                                                    \
+        }                                                                                                             \
+        list->tail_node_ptr = node_new;                                                                               \
+        list->node_count = list->node_count + 1;                                                                      \
+        ret_val = LINKEDLIST_OP_SUCCESS;                                                                              \
+    }                                                                                                                 \
+                                                                                                                      \
+    return ret_val;                                                                                                   \
+}                                                                                                                     \
+                                                                                                                      \
+static inline linkedlist_std_ret_t name##_insert_index(name##_t* list, size_t node_index, T new_data)                 \
+{                                                                                                                     \
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;                                                                \
+    struct name##_node_t* node_current = list->head_node_ptr;                                                         \
+    struct name##_node_t* node_new = NULL;                                                                            \
+    size_t loop_cntr = 0;                                                                                             \
+                                                                                                                      \
+    if(node_index == list->node_count)                                                                                \
+    {                                                                                                                 \
+        ret_val = name##_insert_end(list, new_data);                                                                  \
+    }                                                                                                                 \
+    else if(node_index < list->node_count)                                                                            \
+    {                                                                                                                 \
+        node_new = (struct name##_node_t*)malloc(sizeof(struct name##_node_t));                                       \
+        if(NULL != node_new)                                                                                          \
+        {                                                                                                             \
+            node_new->data = new_data;                                                                                \
+            if(0u == node_index)                                                                                      \
+            {                                                                                                         \
+                node_new->next_node_address_ptr = list->head_node_ptr;                                                \
+                list->head_node_ptr = node_new;                                                                       \
+            }                                                                                                         \
+            else                                                                                                      \
+            {                                                                                                         \
+                for(loop_cntr = 1; loop_cntr < node_index; loop_cntr++)                                               \
+                {                                                                                                     \
+                    node_current = node_current->next_node_address_ptr;                                               \
+                }                                                                                                     \
+                node_new->next_node_address_ptr = node_current->next_node_address_ptr;                                \
+                node_current->next_node_address_ptr = node_new;                                                       \
+            }                                                                                                         \
+            list->node_count = list->node_count + 1;                                                                  \
+            ret_val = LINKEDLIST_OP_SUCCESS;                                                                          \
+        }                                                                                                             \
+    }                                                                                                                 \
+                                                                                                                      \
+    return ret_val;                                                                                                   \
+}                                                                                                                     \
+                                                                                                                      \
+static inline linkedlist_std_ret_t name##_get_end(name##_t* list, T* current_data)                                    \
+{                                                                                                                     \
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;                                                                \
+                                                                                                                      \
+    if(NULL != list->tail_node_ptr)                                                                                   \
+    {                                                                                                                 \
+        *current_data = list->tail_node_ptr->data;                                                                    \
+        ret_val = LINKEDLIST_OP_SUCCESS;                                                                              \
+    }                                                                                                                 \
+                                                                                                                      \
+    return ret_val;                                                                                                   \
+}                                                                                                                     \
+                                                                                                                      \
+static inline linkedlist_std_ret_t name##_get_index(name##_t* list, size_t node_index, T* current_data)               \
+{                                                                                                                     \
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;                                                                \
+    struct name##_node_t* node_current = list->head_node_ptr;                                                         \
+    size_t loop_cntr = 0;                                                                                             \
+                                                                                                                      \
+    if(node_index < list->node_count)                                                                                 \
+    {                                                                                                                 \
+        for(loop_cntr = 0; loop_cntr < node_index; loop_cntr++)                                                       \
+        {                                                                                                             \
+            node_current = node_current->next_node_address_ptr;                                                       \
+        }                                                                                                             \
+        *current_data = node_current->data;                                                                           \
+        ret_val = LINKEDLIST_OP_SUCCESS;                                                                              \
+    }                                                                                                                 \
+                                                                                                                      \
+    return ret_val;                                                                                                   \
+}                                                                                                                     \
+                                                                                                                      \
+static inline linkedlist_std_ret_t name##_delete_index(name##_t* list, size_t node_index)                             \
+{                                                                                                                     \
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;                                                                \
+    struct name##_node_t* node_previous = NULL;                                                                       \
+    struct name##_node_t* node_to_delete = list->head_node_ptr;                                                       \
+    size_t loop_cntr = 0;                                                                                             \
+                                                                                                                      \
+    if(node_index < list->node_count)                                                                                 \
+    {                                                                                                                 \
+        for(loop_cntr = 0; loop_cntr < node_index; loop_cntr++)                                                       \
+        {                                                                                                             \
+            node_previous  = node_to_delete;                                                                          \
+            node_to_delete = node_to_delete->next_node_address_ptr;                                                   \
+        }                                                                                                             \
+        if(NULL == node_previous)                                                                                     \
+        {                                                                                                             \
+            list->head_node_ptr = node_to_delete->next_node_address_ptr;                                              \
+        }                                                                                                             \
+        else                                                                                                          \
+        {                                                                                                             \
+            node_previous->next_node_address_ptr = node_to_delete->next_node_address_ptr;                             \
+        }                                                                                                             \
+        if(list->tail_node_ptr == node_to_delete)                                                                     \
+        {                                                                                                             \
+            list->tail_node_ptr = node_previous;                                                                      \
+        }                                                                                                             \
+        free(node_to_delete);                                                                                         \
+        list->node_count = list->node_count - 1;                                                                      \
+        ret_val = LINKEDLIST_OP_SUCCESS;                                                                              \
+    }                                                                                                                 \
+                                                                                                                      \
+    return ret_val;                                                                                                   \
+}                                                                                                                     \
+                                                                                                                      \
+static inline linkedlist_std_ret_t name##_delete_end(name##_t* list)                                                  \
+{                                                                                                                     \
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;                                                                \
+                                                                                                                      \
+    if(0u != list->node_count)                                                                                        \
+    {                                                                                                                 \
+        ret_val = name##_delete_index(list, list->node_count - 1u);                                                   \
+    }                                                                                                                 \
+                                                                                                                      \
+    return ret_val;                                                                                                   \
+}                                                                                                                     \
+                                                                                                                      \
+static inline linkedlist_std_ret_t name##_delete_all(name##_t* list)                                                  \
+{                                                                                                                     \
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;                                                                \
+    struct name##_node_t* node_current = list->head_node_ptr;                                                         \
+    struct name##_node_t* node_tofree = NULL;                                                                         \
+                                                                                                                      \
+    if(NULL != node_current)                                                                                          \
+    {                                                                                                                 \
+        while(NULL != node_current)                                                                                   \
+        {                                                                                                             \
+            node_tofree  = node_current;                                                                              \
+            node_current = node_current->next_node_address_ptr;                                                       \
+            free(node_tofree);                                                                                        \
+        }                                                                                                             \
+        (void)name##_init(list);                                                                                      \
+        ret_val = LINKEDLIST_OP_SUCCESS;                                                                              \
+    }                                                                                                                 \
+                                                                                                                      \
+    return ret_val;                                                                                                   \
+}                                                                                                                     \
+                                                                                                                      \
+static inline size_t name##_size(name##_t* list)                                                                      \
+{                                                                                                                     \
+    return list->node_count;                                                                                          \
+}
+
+#endif /** LINKEDLIST_GENERIC_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,375 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: linkedlist_pool.c
+* File Description: This file contains the implementation of the linkedlist node pool.
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#include "linkedlist_pool.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static struct linkedlist_pool_slab_t* slab_create(size_t slab_node_count);
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_pool_init
+*
+** Purpose:
+*  This function initializes an empty node pool. No memory is allocated until the first node is requested.
+*
+** Input Parameters:
+*  - pool: linkedlist_pool_t*
+*    A pointer to the pool to be initialized.
+*  - slab_node_count: size_t
+*    Number of nodes of every slab the pool allocates. If 0, LINKEDLIST_POOL_DEFAULT_SLAB_NODES is used.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t linkedlist_pool_init(linkedlist_pool_t* pool, size_t slab_node_count)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != pool)
+    {
+        pool->first_slab_ptr    = NULL;
+        pool->current_slab_ptr  = NULL;
+        pool->current_slab_used = 0;
+        pool->slab_node_count   = (0 == slab_node_count) ? LINKEDLIST_POOL_DEFAULT_SLAB_NODES : slab_node_count;
+        pool->free_list_ptr     = NULL;
+        pool->slab_count        = 0;
+        pool->node_capacity     = 0;
+        pool->used_node_count   = 0;
+        pool->free_node_count   = 0;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_pool_alloc
+*
+** Purpose:
+*  This function hands out one node. Recycled nodes on the free list are used first, then nodes are carved from the
+*  current slab, and only when all the slabs are used up a new slab is allocated.
+*
+** Input Parameters:
+*  - pool: linkedlist_pool_t*
+*    A pointer to the pool.
+*
+** Return Value:
+*  - struct node_t*
+*    Address of the node, or NULL if a new slab couldn't be allocated.
+*********************************************************************************************************************/
+struct node_t* linkedlist_pool_alloc(linkedlist_pool_t* pool)
+{
+    struct node_t* node_new = pool->free_list_ptr;
+    struct linkedlist_pool_slab_t* slab_new = NULL;
+
+    if(NULL != node_new)
+    {
+        /** Recycle a freed node **/
+        pool->free_list_ptr = node_new->next_node_address_ptr;
+        pool->free_node_count = pool->free_node_count - 1;
+    }
+    else
+    {
+        /** Move to the next slab if the current one is used up, slabs are kept across pool resets **/
+        while((NULL != pool->current_slab_ptr) &&
+              (pool->current_slab_used == pool->current_slab_ptr->slab_node_count) &&
+              (NULL != pool->current_slab_ptr->next_slab_ptr))
+        {
+            pool->current_slab_ptr  = pool->current_slab_ptr->next_slab_ptr;
+            pool->current_slab_used = 0;
+        }
+
+        if((NULL == pool->current_slab_ptr) || (pool->current_slab_used == pool->current_slab_ptr->slab_node_count))
+        {
+            slab_new = slab_create(pool->slab_node_count);
+            if(NULL != slab_new)
+            {
+                if(NULL == pool->current_slab_ptr)
+                {
+                    pool->first_slab_ptr = slab_new;
+                }
+                else
+                {
+                    pool->current_slab_ptr->next_slab_ptr = slab_new;
+                }
+                pool->current_slab_ptr  = slab_new;
+                pool->current_slab_used = 0;
+                pool->slab_count    = pool->slab_count + 1;
+                pool->node_capacity = pool->node_capacity + slab_new->slab_node_count;
+            }
+        }
+
+        if((NULL != pool->current_slab_ptr) && (pool->current_slab_used < pool->current_slab_ptr->slab_node_count))
+        {
+            node_new = &pool->current_slab_ptr->nodes[pool->current_slab_used];
+            pool->current_slab_used = pool->current_slab_used + 1;
+        }
+    }
+
+    if(NULL != node_new)
+    {
+        pool->used_node_count = pool->used_node_count + 1;
+    }
+
+    return node_new;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_pool_alloc_run
+*
+** Purpose:
+*  This function hands out a run of nodes that are next to each other in memory, as an array of nodes. The free list
+*  isn't used, since its nodes aren't next to each other. If the current slab doesn't have enough nodes left, they
+*  are left for after the next reset and the run is carved from the next slab that fits, or from a new slab that is
+*  made large enough for the run.
+*
+** Input Parameters:
+*  - pool: linkedlist_pool_t*
+*    A pointer to the pool.
+*  - node_count: size_t
+*    Number of nodes of the run.
+*
+** Return Value:
+*  - struct node_t*
+*    Address of the first node of the run, or NULL if node_count is 0 or a new slab couldn't be allocated. The nodes
+*    aren't linked to each other.
+*********************************************************************************************************************/
+struct node_t* linkedlist_pool_alloc_run(linkedlist_pool_t* pool, size_t node_count)
+{
+    struct node_t* node_run = NULL;
+    struct linkedlist_pool_slab_t* slab_new = NULL;
+
+    if(0u != node_count)
+    {
+        while((NULL != pool->current_slab_ptr) &&
+              ((pool->current_slab_ptr->slab_node_count - pool->current_slab_used) < node_count) &&
+              (NULL != pool->current_slab_ptr->next_slab_ptr))
+        {
+            pool->current_slab_ptr  = pool->current_slab_ptr->next_slab_ptr;
+            pool->current_slab_used = 0;
+        }
+
+        if((NULL == pool->current_slab_ptr) ||
+           ((pool->current_slab_ptr->slab_node_count - pool->current_slab_used) < node_count))
+        {
+            slab_new = slab_create((node_count > pool->slab_node_count) ? node_count : pool->slab_node_count);
+            if(NULL != slab_new)
+            {
+                if(NULL == pool->current_slab_ptr)
+                {
+                    pool->first_slab_ptr = slab_new;
+                }
+                else
+                {
+                    pool->current_slab_ptr->next_slab_ptr = slab_new;
+                }
+                pool->current_slab_ptr  = slab_new;
+                pool->current_slab_used = 0;
+                pool->slab_count    = pool->slab_count + 1;
+                pool->node_capacity = pool->node_capacity + slab_new->slab_node_count;
+            }
+        }
+
+        if((NULL != pool->current_slab_ptr) &&
+           ((pool->current_slab_ptr->slab_node_count - pool->current_slab_used) >= node_count))
+        {
+            node_run = &pool->current_slab_ptr->nodes[pool->current_slab_used];
+            pool->current_slab_used = pool->current_slab_used + node_count;
+            pool->used_node_count   = pool->used_node_count + node_count;
+        }
+    }
+
+    return node_run;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_pool_free
+*
+** Purpose:
+*  This function gives a node back to the pool. The node is put on the free list to be recycled, its memory is not
+*  returned to the system.
+*
+** Input Parameters:
+*  - pool: linkedlist_pool_t*
+*    A pointer to the pool the node was allocated from.
+*  - node: struct node_t*
+*    Address of the node to be freed. Nothing happens if it is NULL.
+*
+** Return Value:
+*  - None.
+*********************************************************************************************************************/
+void linkedlist_pool_free(linkedlist_pool_t* pool, struct node_t* node)
+{
+    if(NULL != node)
+    {
+        node->next_node_address_ptr = pool->free_list_ptr;
+        pool->free_list_ptr = node;
+        pool->free_node_count = pool->free_node_count + 1;
+        pool->used_node_count = pool->used_node_count - 1;
+    }
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_pool_free_chain
+*
+** Purpose:
+*  This function gives a whole chain of linked nodes back to the pool at once. The nodes are already linked to each
+*  other, so the chain is put in front of the free list without visiting its nodes.
+*
+** Input Parameters:
+*  - pool: linkedlist_pool_t*
+*    A pointer to the pool the nodes were allocated from.
+*  - first_node: struct node_t*
+*    Address of the first node of the chain.
+*  - last_node: struct node_t*
+*    Address of the last node of the chain.
+*  - node_count: size_t
+*    Number of nodes in the chain.
+*
+** Return Value:
+*  - None.
+*********************************************************************************************************************/
+void linkedlist_pool_free_chain(linkedlist_pool_t* pool, struct node_t* first_node, struct node_t* last_node,
+                                size_t node_count)
+{
+    if((NULL != first_node) && (NULL != last_node))
+    {
+        last_node->next_node_address_ptr = pool->free_list_ptr;
+        pool->free_list_ptr = first_node;
+        pool->free_node_count = pool->free_node_count + node_count;
+        pool->used_node_count = pool->used_node_count - node_count;
+    }
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_pool_reset
+*
+** Purpose:
+*  This function takes back all the nodes of the pool at once, without visiting them. The slabs are kept, so the pool
+*  can be refilled without allocating again. Every list that used the pool has to be re-initialized afterwards.
+*
+** Input Parameters:
+*  - pool: linkedlist_pool_t*
+*    A pointer to the pool.
+*
+** Return Value:
+*  - None.
+*********************************************************************************************************************/
+void linkedlist_pool_reset(linkedlist_pool_t* pool)
+{
+    pool->current_slab_ptr  = pool->first_slab_ptr;
+    pool->current_slab_used = 0;
+    pool->free_list_ptr     = NULL;
+    pool->used_node_count   = 0;
+    pool->free_node_count   = 0;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_pool_destroy
+*
+** Purpose:
+*  This function returns all the slabs of the pool to the system. Every list that used the pool has to be re-initia-
+*  lized afterwards.
+*
+** Input Parameters:
+*  - pool: linkedlist_pool_t*
+*    A pointer to the pool.
+*
+** Return Value:
+*  - None.
+*********************************************************************************************************************/
+void linkedlist_pool_destroy(linkedlist_pool_t* pool)
+{
+    struct linkedlist_pool_slab_t* slab_current = pool->first_slab_ptr;
+    struct linkedlist_pool_slab_t* slab_tofree  = NULL;
+
+    while(NULL != slab_current)
+    {
+        slab_tofree  = slab_current;
+        slab_current = slab_current->next_slab_ptr;
+        free(slab_tofree);
+    }
+
+    (void)linkedlist_pool_init(pool, pool->slab_node_count);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_pool_stats_get
+*
+** Purpose:
+*  This function reports the slab and free list occupancy of the pool.
+*
+** Input Parameters:
+*  - pool: linkedlist_pool_t*
+*    A pointer to the pool.
+*  - stats: linkedlist_pool_stats_t*
+*    Points to the structure that will be loaded with the pool occupancy.
+*
+** Return Value:
+*  - None.
+*********************************************************************************************************************/
+void linkedlist_pool_stats_get(linkedlist_pool_t* pool, linkedlist_pool_stats_t* stats)
+{
+    stats->slab_count           = pool->slab_count;
+    stats->node_capacity        = pool->node_capacity;
+    stats->used_node_count      = pool->used_node_count;
+    stats->free_node_count      = pool->free_node_count;
+    stats->untouched_node_count = pool->node_capacity - pool->used_node_count - pool->free_node_count;
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+static struct linkedlist_pool_slab_t* slab_create(size_t slab_node_count)
+{
+    struct linkedlist_pool_slab_t* slab_new = NULL;
+
+    /** A slab too large for a size_t would wrap around to a small block **/
+    if(slab_node_count <= ((SIZE_MAX - sizeof(struct linkedlist_pool_slab_t)) / sizeof(struct node_t)))
+    {
+        slab_new = (struct linkedlist_pool_slab_t*)malloc(sizeof(struct linkedlist_pool_slab_t) +
+                                                          (slab_node_count * sizeof(struct node_t)));
+    }
+
+    if(NULL != slab_new)
+    {
+        slab_new->next_slab_ptr   = NULL;
+        slab_new->slab_node_count = slab_node_count;
+    }
+
+    return slab_new;
+}
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
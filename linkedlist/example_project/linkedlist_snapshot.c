@@ -0,0 +1,503 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: linkedlist_snapshot.c
+* File Description: This file contains the implementation of the linkedlist binary snapshot format.
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#define _POSIX_C_SOURCE 200809L
+#include "linkedlist_snapshot.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static uint32_t checksum_crc32(uint32_t checksum, const void* data, size_t data_size);
+static uint32_t header_checksum_get(const linkedlist_snapshot_header_t* header);
+static linkedlist_snapshot_ret_t buffer_flush(linkedlist_snapshot_writer_t* writer);
+static linkedlist_snapshot_ret_t snapshot_check(const void* file_data, size_t file_size, size_t* element_count);
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_snapshot_writer_open
+*
+** Purpose:
+*  This function creates the snapshot file, or empties it if it exists. The header is left empty until the writer is
+*  closed, so a file that wasn't completely written is never taken as a valid snapshot.
+*
+** Input Parameters:
+*  - writer: linkedlist_snapshot_writer_t*
+*    A pointer to the writer to be opened.
+*  - file_path: const char*
+*    Path of the snapshot file.
+*
+** Return Value:
+*  - linkedlist_snapshot_ret_t
+*    -- LINKEDLIST_SNAPSHOT_OP_SUCCESS
+*    -- LINKEDLIST_SNAPSHOT_OP_FAIL: the file couldn't be created.
+*********************************************************************************************************************/
+linkedlist_snapshot_ret_t linkedlist_snapshot_writer_open(linkedlist_snapshot_writer_t* writer, const char* file_path)
+{
+    linkedlist_snapshot_ret_t ret_val = LINKEDLIST_SNAPSHOT_OP_FAIL;
+
+    memset(&writer->header, 0, sizeof(writer->header));
+    writer->buffer_count = 0;
+    writer->file_ptr = fopen(file_path, "wb");
+    if(NULL != writer->file_ptr)
+    {
+        if(1u == fwrite(&writer->header, sizeof(writer->header), 1u, writer->file_ptr))
+        {
+            writer->header.magic        = LINKEDLIST_SNAPSHOT_MAGIC;
+            writer->header.version      = LINKEDLIST_SNAPSHOT_VERSION;
+            writer->header.element_size = (uint16_t)sizeof(int);
+            ret_val = LINKEDLIST_SNAPSHOT_OP_SUCCESS;
+        }
+        else
+        {
+            fclose(writer->file_ptr);
+            writer->file_ptr = NULL;
+        }
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_snapshot_writer_put
+*
+** Purpose:
+*  This function adds elements to the end of the snapshot. They are collected in the writer and written to the file
+*  in blocks of LINKEDLIST_SNAPSHOT_BUFFER elements.
+*
+** Input Parameters:
+*  - writer: linkedlist_snapshot_writer_t*
+*    A pointer to an open writer.
+*  - data_array: const int*
+*    Elements to be added.
+*  - data_count: size_t
+*    Number of elements in data_array.
+*
+** Return Value:
+*  - linkedlist_snapshot_ret_t
+*    -- LINKEDLIST_SNAPSHOT_OP_SUCCESS
+*    -- LINKEDLIST_SNAPSHOT_OP_FAIL: the writer isn't open or the file couldn't be written, the writer is closed and
+*       the file is left without a valid header.
+*********************************************************************************************************************/
+linkedlist_snapshot_ret_t linkedlist_snapshot_writer_put(linkedlist_snapshot_writer_t* writer, const int* data_array,
+                                                         size_t data_count)
+{
+    linkedlist_snapshot_ret_t ret_val = (NULL != writer->file_ptr) ? LINKEDLIST_SNAPSHOT_OP_SUCCESS :
+                                                                     LINKEDLIST_SNAPSHOT_OP_FAIL;
+    size_t copy_count = 0;
+
+    while((LINKEDLIST_SNAPSHOT_OP_SUCCESS == ret_val) && (0u != data_count))
+    {
+        copy_count = LINKEDLIST_SNAPSHOT_BUFFER - writer->buffer_count;
+        if(copy_count > data_count)
+        {
+            copy_count = data_count;
+        }
+        memcpy(&writer->buffer[writer->buffer_count], data_array, copy_count * sizeof(int));
+        writer->buffer_count = writer->buffer_count + copy_count;
+        data_array = data_array + copy_count;
+        data_count = data_count - copy_count;
+
+        if(LINKEDLIST_SNAPSHOT_BUFFER == writer->buffer_count)
+        {
+            ret_val = buffer_flush(writer);
+        }
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_snapshot_writer_close
+*
+** Purpose:
+*  This function writes the elements left in the writer and the final header, then closes the file.
+*
+** Input Parameters:
+*  - writer: linkedlist_snapshot_writer_t*
+*    A pointer to an open writer.
+*
+** Return Value:
+*  - linkedlist_snapshot_ret_t
+*    -- LINKEDLIST_SNAPSHOT_OP_SUCCESS
+*    -- LINKEDLIST_SNAPSHOT_OP_FAIL: the writer isn't open or the file couldn't be written.
+*********************************************************************************************************************/
+linkedlist_snapshot_ret_t linkedlist_snapshot_writer_close(linkedlist_snapshot_writer_t* writer)
+{
+    linkedlist_snapshot_ret_t ret_val = LINKEDLIST_SNAPSHOT_OP_FAIL;
+
+    if((NULL != writer->file_ptr) && (LINKEDLIST_SNAPSHOT_OP_SUCCESS == buffer_flush(writer)))
+    {
+        writer->header.header_checksum = header_checksum_get(&writer->header);
+        if((0 == fseek(writer->file_ptr, 0L, SEEK_SET)) &&
+           (1u == fwrite(&writer->header, sizeof(writer->header), 1u, writer->file_ptr)))
+        {
+            ret_val = LINKEDLIST_SNAPSHOT_OP_SUCCESS;
+        }
+        if(0 != fclose(writer->file_ptr))
+        {
+            ret_val = LINKEDLIST_SNAPSHOT_OP_FAIL;
+        }
+        writer->file_ptr = NULL;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_snapshot_map
+*
+** Purpose:
+*  This function maps a snapshot file to memory and checks its header and checksums. The elements can then be read
+*  in place, without copying the file.
+*
+** Input Parameters:
+*  - map: linkedlist_snapshot_map_t*
+*    A pointer to the map to be filled. It must be released with linkedlist_snapshot_unmap() once the function
+*    succeeded.
+*  - file_path: const char*
+*    Path of the snapshot file.
+*
+** Return Value:
+*  - linkedlist_snapshot_ret_t
+*    -- LINKEDLIST_SNAPSHOT_OP_SUCCESS
+*    -- LINKEDLIST_SNAPSHOT_OP_FAIL: the file couldn't be opened or mapped.
+*    -- LINKEDLIST_SNAPSHOT_BAD_FORMAT
+*    -- LINKEDLIST_SNAPSHOT_BAD_VERSION
+*    -- LINKEDLIST_SNAPSHOT_BAD_CHECKSUM
+*********************************************************************************************************************/
+linkedlist_snapshot_ret_t linkedlist_snapshot_map(linkedlist_snapshot_map_t* map, const char* file_path)
+{
+    linkedlist_snapshot_ret_t ret_val = LINKEDLIST_SNAPSHOT_OP_FAIL;
+    size_t element_count = 0;
+#if !defined(_WIN32)
+    struct stat file_status;
+    int file_descriptor = open(file_path, O_RDONLY);
+#else
+    FILE* file_ptr = fopen(file_path, "rb");
+    long file_size = 0;
+#endif
+
+    map->data_ptr      = NULL;
+    map->element_count = 0;
+    map->mapping_ptr   = NULL;
+    map->mapping_size  = 0;
+
+#if !defined(_WIN32)
+    if(0 <= file_descriptor)
+    {
+        if((0 == fstat(file_descriptor, &file_status)) && (0 == file_status.st_size))
+        {
+            /** An empty file can't be mapped, it is rejected like any file too short for a header **/
+            ret_val = LINKEDLIST_SNAPSHOT_BAD_FORMAT;
+        }
+        else if(0 < file_status.st_size)
+        {
+            map->mapping_size = (size_t)file_status.st_size;
+            map->mapping_ptr  = mmap(NULL, map->mapping_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+            if(MAP_FAILED == map->mapping_ptr)
+            {
+                map->mapping_ptr = NULL;
+            }
+            else
+            {
+                /** The checksum and the list rebuild both read the file from start to end **/
+                (void)posix_madvise(map->mapping_ptr, map->mapping_size, POSIX_MADV_SEQUENTIAL);
+            }
+        }
+        close(file_descriptor);
+    }
+#else
+    /** No mmap() here, the file is read to memory in one go instead **/
+    if(NULL != file_ptr)
+    {
+        if((0 == fseek(file_ptr, 0L, SEEK_END)) && (0 < (file_size = ftell(file_ptr))) &&
+           (0 == fseek(file_ptr, 0L, SEEK_SET)))
+        {
+            map->mapping_size = (size_t)file_size;
+            map->mapping_ptr  = malloc(map->mapping_size);
+            if((NULL != map->mapping_ptr) && (1u != fread(map->mapping_ptr, map->mapping_size, 1u, file_ptr)))
+            {
+                free(map->mapping_ptr);
+                map->mapping_ptr = NULL;
+            }
+        }
+        else if(0 == file_size)
+        {
+            ret_val = LINKEDLIST_SNAPSHOT_BAD_FORMAT;
+        }
+        fclose(file_ptr);
+    }
+#endif
+
+    if(NULL != map->mapping_ptr)
+    {
+        ret_val = snapshot_check(map->mapping_ptr, map->mapping_size, &element_count);
+        if(LINKEDLIST_SNAPSHOT_OP_SUCCESS == ret_val)
+        {
+            map->element_count = element_count;
+            if(0u != element_count)
+            {
+                map->data_ptr = (const int*)((const unsigned char*)map->mapping_ptr +
+                                             sizeof(linkedlist_snapshot_header_t));
+            }
+        }
+        else
+        {
+            linkedlist_snapshot_unmap(map);
+        }
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_snapshot_unmap
+*
+** Purpose:
+*  This function releases a snapshot file mapped by linkedlist_snapshot_map(). Its elements can't be read anymore.
+*
+** Input Parameters:
+*  - map: linkedlist_snapshot_map_t*
+*    A pointer to the map to be released.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void linkedlist_snapshot_unmap(linkedlist_snapshot_map_t* map)
+{
+    if(NULL != map->mapping_ptr)
+    {
+#if !defined(_WIN32)
+        (void)munmap(map->mapping_ptr, map->mapping_size);
+#else
+        free(map->mapping_ptr);
+#endif
+    }
+    map->data_ptr      = NULL;
+    map->element_count = 0;
+    map->mapping_ptr   = NULL;
+    map->mapping_size  = 0;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_snapshot_write
+*
+** Purpose:
+*  This function writes all the elements of a list to a snapshot file, in list order.
+*
+** Input Parameters:
+*  - list: linkedlist_t*
+*    A pointer to the list to be written.
+*  - file_path: const char*
+*    Path of the snapshot file.
+*
+** Return Value:
+*  - linkedlist_snapshot_ret_t
+*    -- LINKEDLIST_SNAPSHOT_OP_SUCCESS
+*    -- LINKEDLIST_SNAPSHOT_OP_FAIL: the file couldn't be written.
+*********************************************************************************************************************/
+linkedlist_snapshot_ret_t linkedlist_snapshot_write(linkedlist_t* list, const char* file_path)
+{
+    linkedlist_snapshot_ret_t ret_val = LINKEDLIST_SNAPSHOT_OP_FAIL;
+    linkedlist_snapshot_writer_t* writer = (linkedlist_snapshot_writer_t*)malloc(sizeof(linkedlist_snapshot_writer_t));
+    struct node_t* node_current = list->head_node_ptr;
+
+    /** The writer holds a whole block of elements, so it is too large to be kept on the stack **/
+    if((NULL != writer) && (LINKEDLIST_SNAPSHOT_OP_SUCCESS == linkedlist_snapshot_writer_open(writer, file_path)))
+    {
+        ret_val = LINKEDLIST_SNAPSHOT_OP_SUCCESS;
+        while((NULL != node_current) && (LINKEDLIST_SNAPSHOT_OP_SUCCESS == ret_val))
+        {
+            ret_val = linkedlist_snapshot_writer_put(writer, &node_current->data, 1u);
+            node_current = node_current->next_node_address_ptr;
+        }
+        if(LINKEDLIST_SNAPSHOT_OP_SUCCESS == ret_val)
+        {
+            ret_val = linkedlist_snapshot_writer_close(writer);
+        }
+    }
+    free(writer);
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_snapshot_load
+*
+** Purpose:
+*  This function appends all the elements of a snapshot file to the end of a list. The file is checked completely
+*  before the list is changed, so the list stays as it was if the file is rejected. A list that takes its nodes from
+*  a pool gets all the new nodes with one allocation, see linkedlist_append_array().
+*
+** Input Parameters:
+*  - list: linkedlist_t*
+*    A pointer to the list the elements are appended to.
+*  - file_path: const char*
+*    Path of the snapshot file.
+*
+** Return Value:
+*  - linkedlist_snapshot_ret_t
+*    -- LINKEDLIST_SNAPSHOT_OP_SUCCESS
+*    -- LINKEDLIST_SNAPSHOT_OP_FAIL: the file couldn't be read, or the nodes couldn't be allocated.
+*    -- LINKEDLIST_SNAPSHOT_BAD_FORMAT
+*    -- LINKEDLIST_SNAPSHOT_BAD_VERSION
+*    -- LINKEDLIST_SNAPSHOT_BAD_CHECKSUM
+*********************************************************************************************************************/
+linkedlist_snapshot_ret_t linkedlist_snapshot_load(linkedlist_t* list, const char* file_path)
+{
+    linkedlist_snapshot_map_t map;
+    linkedlist_snapshot_ret_t ret_val = linkedlist_snapshot_map(&map, file_path);
+
+    if(LINKEDLIST_SNAPSHOT_OP_SUCCESS == ret_val)
+    {
+        if((0u != map.element_count) &&
+           (LINKEDLIST_OP_SUCCESS != linkedlist_append_array(list, map.data_ptr, map.element_count)))
+        {
+            ret_val = LINKEDLIST_SNAPSHOT_OP_FAIL;
+        }
+        linkedlist_snapshot_unmap(&map);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+/** Continues the CRC-32 (IEEE 802.3, as in zip and png) of earlier data with data_size more bytes, start with 0 **/
+static uint32_t checksum_crc32(uint32_t checksum, const void* data, size_t data_size)
+{
+    const unsigned char* data_bytes = (const unsigned char*)data;
+    uint32_t crc_table[256];
+    uint32_t table_value = 0;
+    size_t loop_cntr = 0;
+    size_t bit_cntr = 0;
+
+    /** Building the table costs less than a thousandth of checking one block of elements **/
+    for(loop_cntr = 0; loop_cntr < 256u; loop_cntr++)
+    {
+        table_value = (uint32_t)loop_cntr;
+        for(bit_cntr = 0; bit_cntr < 8u; bit_cntr++)
+        {
+            table_value = (0u != (table_value & 1u)) ? (0xEDB88320u ^ (table_value >> 1)) : (table_value >> 1);
+        }
+        crc_table[loop_cntr] = table_value;
+    }
+
+    checksum = ~checksum;
+    for(loop_cntr = 0; loop_cntr < data_size; loop_cntr++)
+    {
+        checksum = crc_table[(checksum ^ data_bytes[loop_cntr]) & 0xFFu] ^ (checksum >> 8);
+    }
+
+    return ~checksum;
+}
+
+/** Returns the CRC-32 of all the header fields before header_checksum **/
+static uint32_t header_checksum_get(const linkedlist_snapshot_header_t* header)
+{
+    return checksum_crc32(0u, header, offsetof(linkedlist_snapshot_header_t, header_checksum));
+}
+
+/** Writes the elements collected in the writer to the file and adds them to the checksum **/
+static linkedlist_snapshot_ret_t buffer_flush(linkedlist_snapshot_writer_t* writer)
+{
+    linkedlist_snapshot_ret_t ret_val = LINKEDLIST_SNAPSHOT_OP_SUCCESS;
+
+    if(0u != writer->buffer_count)
+    {
+        if(writer->buffer_count == fwrite(writer->buffer, sizeof(int), writer->buffer_count, writer->file_ptr))
+        {
+            writer->header.payload_checksum = checksum_crc32(writer->header.payload_checksum, writer->buffer,
+                                                             writer->buffer_count * sizeof(int));
+            writer->header.element_count = writer->header.element_count + writer->buffer_count;
+            writer->buffer_count = 0;
+        }
+        else
+        {
+            fclose(writer->file_ptr);
+            writer->file_ptr = NULL;
+            ret_val = LINKEDLIST_SNAPSHOT_OP_FAIL;
+        }
+    }
+
+    return ret_val;
+}
+
+/** Checks the header of a snapshot held in memory, then the checksum of its elements **/
+static linkedlist_snapshot_ret_t snapshot_check(const void* file_data, size_t file_size, size_t* element_count)
+{
+    linkedlist_snapshot_ret_t ret_val = LINKEDLIST_SNAPSHOT_BAD_FORMAT;
+    linkedlist_snapshot_header_t header;
+    size_t payload_size = file_size - sizeof(linkedlist_snapshot_header_t);
+
+    if(file_size >= sizeof(linkedlist_snapshot_header_t))
+    {
+        memcpy(&header, file_data, sizeof(header));
+        if(LINKEDLIST_SNAPSHOT_MAGIC != header.magic)
+        {
+            /** Not a snapshot, or written with another byte order **/
+        }
+        else if(LINKEDLIST_SNAPSHOT_VERSION != header.version)
+        {
+            /** Other versions may have another header, so its checksum isn't checked **/
+            ret_val = LINKEDLIST_SNAPSHOT_BAD_VERSION;
+        }
+        else if(header_checksum_get(&header) != header.header_checksum)
+        {
+            ret_val = LINKEDLIST_SNAPSHOT_BAD_CHECKSUM;
+        }
+        else if((sizeof(int) != header.element_size) || ((payload_size / sizeof(int)) != header.element_count) ||
+                (0u != (payload_size % sizeof(int))))
+        {
+            /** Written with another int size, truncated or with extra data at its end **/
+        }
+        else if(checksum_crc32(0u, (const unsigned char*)file_data + sizeof(linkedlist_snapshot_header_t),
+                               payload_size) != header.payload_checksum)
+        {
+            ret_val = LINKEDLIST_SNAPSHOT_BAD_CHECKSUM;
+        }
+        else
+        {
+            *element_count = (size_t)header.element_count;
+            ret_val = LINKEDLIST_SNAPSHOT_OP_SUCCESS;
+        }
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
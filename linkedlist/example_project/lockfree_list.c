@@ -0,0 +1,556 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: lockfree_list.c
+* File Description: This file contains the implementation of the lock-free ordered linkedlist datastructure. Nodes
+* are deleted in two steps as proposed by Harris: the node is marked first, then unlinked. Unlinked nodes are freed
+* with hazard pointers as proposed by Michael, once no thread can still be reading them.
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#include "lockfree_list.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************************************************************************************************************
+                                  << Private Constants >>
+*********************************************************************************************************************/
+#define LOCKFREE_MARK_BIT       ((uintptr_t)1u)
+
+/** Hazard pointer indexes **/
+#define HAZARD_CURRENT          0u
+#define HAZARD_PREVIOUS         1u
+
+/*********************************************************************************************************************
+                                  << Private Datatypes >>
+*********************************************************************************************************************/
+/** Position found by a search: the link to be changed and the first node whose key isn't smaller than the key **/
+typedef struct
+{
+    _Atomic uintptr_t* previous_link_ptr;
+    struct lockfree_node_t* node_current;
+    uintptr_t next_node_address;
+} lockfree_position_t;
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static linkedlist_std_ret_t position_find(lockfree_list_t* list, size_t thread_slot, int key,
+                                          lockfree_position_t* position);
+static void node_retire(lockfree_list_t* list, size_t thread_slot, struct lockfree_node_t* node_retired);
+static void retired_scan(lockfree_list_t* list, size_t thread_slot);
+static void hazards_clear(lockfree_list_t* list, size_t thread_slot);
+static int  address_compare(const void* address_a, const void* address_b);
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  lockfree_list_init
+*
+** Purpose:
+*  This function initializes an empty list. It must be called before any thread uses the list.
+*
+** Input Parameters:
+*  - list: lockfree_list_t*
+*    A pointer to the list handle to be initialized.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t lockfree_list_init(lockfree_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    size_t slot_index = 0;
+    size_t hazard_index = 0;
+
+    if(NULL != list)
+    {
+        list->head_node.key = 0;
+        list->head_node.retired_next_ptr = NULL;
+        atomic_init(&list->head_node.next_node_address, (uintptr_t)0u);
+        atomic_init(&list->element_count, (size_t)0u);
+        for(slot_index = 0; slot_index < LOCKFREE_LIST_MAX_THREADS; slot_index++)
+        {
+            for(hazard_index = 0; hazard_index < LOCKFREE_LIST_HAZARDS_PER_THREAD; hazard_index++)
+            {
+                atomic_init(&list->thread_slots[slot_index].hazard_node_ptr[hazard_index], NULL);
+            }
+            atomic_init(&list->thread_slots[slot_index].slot_in_use, 0);
+            list->thread_slots[slot_index].retired_first_ptr = NULL;
+            list->thread_slots[slot_index].retired_count = 0;
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lockfree_list_thread_attach
+*
+** Purpose:
+*  This function reserves a free slot of the list for the calling thread. The thread passes the slot index to every
+*  operation it performs on the list.
+*
+** Input Parameters:
+*  - list: lockfree_list_t*
+*    A pointer to the list handle.
+*  - thread_slot: size_t*
+*    Points to the variable in which the index of the reserved slot will be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: LOCKFREE_LIST_MAX_THREADS threads are already attached.
+*********************************************************************************************************************/
+linkedlist_std_ret_t lockfree_list_thread_attach(lockfree_list_t* list, size_t* thread_slot)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    size_t slot_index = 0;
+    int slot_expected = 0;
+
+    for(slot_index = 0; slot_index < LOCKFREE_LIST_MAX_THREADS; slot_index++)
+    {
+        slot_expected = 0;
+        if(atomic_compare_exchange_strong(&list->thread_slots[slot_index].slot_in_use, &slot_expected, 1))
+        {
+            *thread_slot = slot_index;
+            ret_val = LINKEDLIST_OP_SUCCESS;
+            break;
+        }
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lockfree_list_thread_detach
+*
+** Purpose:
+*  This function gives back the slot of the calling thread. Nodes the thread unlinked and couldn't free yet stay in
+*  the slot, they are freed by the next thread attached to it or by lockfree_list_destroy().
+*
+** Input Parameters:
+*  - list: lockfree_list_t*
+*    A pointer to the list handle.
+*  - thread_slot: size_t
+*    Index of the slot reserved by lockfree_list_thread_attach().
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: invalid slot index.
+*********************************************************************************************************************/
+linkedlist_std_ret_t lockfree_list_thread_detach(lockfree_list_t* list, size_t thread_slot)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(thread_slot < LOCKFREE_LIST_MAX_THREADS)
+    {
+        hazards_clear(list, thread_slot);
+        retired_scan(list, thread_slot);
+        atomic_store(&list->thread_slots[thread_slot].slot_in_use, 0);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lockfree_list_insert
+*
+** Purpose:
+*  This function inserts a key at its sorted position, unless the key is already in the list.
+*
+** Input Parameters:
+*  - list: lockfree_list_t*
+*    A pointer to the list handle.
+*  - thread_slot: size_t
+*    Index of the slot of the calling thread.
+*  - key: int
+*    Key to be inserted.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the key is already in the list, or a new node couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t lockfree_list_insert(lockfree_list_t* list, size_t thread_slot, int key)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct lockfree_node_t* node_new = (struct lockfree_node_t*)malloc(sizeof(struct lockfree_node_t));
+    lockfree_position_t position;
+    uintptr_t node_expected = 0;
+
+    if(NULL != node_new)
+    {
+        node_new->key = key;
+        node_new->retired_next_ptr = NULL;
+        while(1)
+        {
+            if(LINKEDLIST_OP_SUCCESS == position_find(list, thread_slot, key, &position))
+            {
+                /** Key is already in the list **/
+                free(node_new);
+                break;
+            }
+
+            atomic_store(&node_new->next_node_address, (uintptr_t)position.node_current);
+            node_expected = (uintptr_t)position.node_current;
+            if(atomic_compare_exchange_strong(position.previous_link_ptr, &node_expected, (uintptr_t)node_new))
+            {
+                atomic_fetch_add(&list->element_count, (size_t)1u);
+                ret_val = LINKEDLIST_OP_SUCCESS;
+                break;
+            }
+            /** The link changed since it was found, search again **/
+        }
+        hazards_clear(list, thread_slot);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lockfree_list_delete
+*
+** Purpose:
+*  This function deletes a key from the list. The node is marked first, so no other thread links a node after it,
+*  then it is unlinked. If unlinking fails, the next search passing by the marked node unlinks it.
+*
+** Input Parameters:
+*  - list: lockfree_list_t*
+*    A pointer to the list handle.
+*  - thread_slot: size_t
+*    Index of the slot of the calling thread.
+*  - key: int
+*    Key to be deleted.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the key isn't in the list.
+*********************************************************************************************************************/
+linkedlist_std_ret_t lockfree_list_delete(lockfree_list_t* list, size_t thread_slot, int key)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    lockfree_position_t position;
+    uintptr_t node_expected = 0;
+
+    while(LINKEDLIST_OP_SUCCESS == position_find(list, thread_slot, key, &position))
+    {
+        /** Step 1: mark the node as deleted **/
+        node_expected = position.next_node_address;
+        if(!atomic_compare_exchange_strong(&position.node_current->next_node_address, &node_expected,
+                                           position.next_node_address | LOCKFREE_MARK_BIT))
+        {
+            /** The node was changed or marked by another thread, search again **/
+            continue;
+        }
+        atomic_fetch_sub(&list->element_count, (size_t)1u);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+
+        /** Step 2: unlink the node, or leave it to a search if the link before it changed **/
+        node_expected = (uintptr_t)position.node_current;
+        if(atomic_compare_exchange_strong(position.previous_link_ptr, &node_expected, position.next_node_address))
+        {
+            node_retire(list, thread_slot, position.node_current);
+        }
+        else
+        {
+            (void)position_find(list, thread_slot, key, &position);
+        }
+        break;
+    }
+    hazards_clear(list, thread_slot);
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lockfree_list_contains
+*
+** Purpose:
+*  This function searches the list for a key.
+*
+** Input Parameters:
+*  - list: lockfree_list_t*
+*    A pointer to the list handle.
+*  - thread_slot: size_t
+*    Index of the slot of the calling thread.
+*  - key: int
+*    Key to be searched for.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS: the key is in the list.
+*    -- LINKEDLIST_OP_FAIL: the key isn't in the list.
+*********************************************************************************************************************/
+linkedlist_std_ret_t lockfree_list_contains(lockfree_list_t* list, size_t thread_slot, int key)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    lockfree_position_t position;
+
+    ret_val = position_find(list, thread_slot, key, &position);
+    hazards_clear(list, thread_slot);
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lockfree_list_size
+*
+** Purpose:
+*  Returns the number of keys currently in the list. While other threads update the list, the value is only a snap-
+*  shot.
+*
+** Input Parameters:
+*  - list: lockfree_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - size_t
+*    Number of keys.
+*********************************************************************************************************************/
+size_t lockfree_list_size(lockfree_list_t* list)
+{
+    return atomic_load(&list->element_count);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  lockfree_list_destroy
+*
+** Purpose:
+*  This function frees all the nodes of the list, including the nodes waiting in the retired lists of the slots. It
+*  must only be called once no thread uses the list anymore.
+*
+** Input Parameters:
+*  - list: lockfree_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t lockfree_list_destroy(lockfree_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct lockfree_node_t* node_current = NULL;
+    struct lockfree_node_t* node_tofree = NULL;
+    size_t slot_index = 0;
+
+    if(NULL != list)
+    {
+        node_current = (struct lockfree_node_t*)(atomic_load(&list->head_node.next_node_address) & ~LOCKFREE_MARK_BIT);
+        while(NULL != node_current)
+        {
+            node_tofree  = node_current;
+            node_current = (struct lockfree_node_t*)(atomic_load(&node_current->next_node_address) &
+                                                     ~LOCKFREE_MARK_BIT);
+            free(node_tofree);
+        }
+
+        for(slot_index = 0; slot_index < LOCKFREE_LIST_MAX_THREADS; slot_index++)
+        {
+            node_current = list->thread_slots[slot_index].retired_first_ptr;
+            while(NULL != node_current)
+            {
+                node_tofree  = node_current;
+                node_current = node_current->retired_next_ptr;
+                free(node_tofree);
+            }
+        }
+
+        ret_val = lockfree_list_init(list);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+/** Finds the first node whose key isn't smaller than the key, unlinking the marked nodes found on the way. The found
+    node and the node before it are left protected by the hazard pointers of the thread. **/
+static linkedlist_std_ret_t position_find(lockfree_list_t* list, size_t thread_slot, int key,
+                                          lockfree_position_t* position)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    lockfree_list_slot_t* slot_ptr = &list->thread_slots[thread_slot];
+    _Atomic uintptr_t* previous_link_ptr = NULL;
+    struct lockfree_node_t* node_current = NULL;
+    struct lockfree_node_t* node_previous = NULL;
+    uintptr_t next_node_address = 0;
+    uintptr_t node_expected = 0;
+    int key_current = 0;
+    int search_done = 0;
+
+    while(0 == search_done)
+    {
+        /** (Re)start from the head of the list **/
+        previous_link_ptr = &list->head_node.next_node_address;
+        node_current = (struct lockfree_node_t*)atomic_load(previous_link_ptr);
+
+        while(1)
+        {
+            if(NULL == node_current)
+            {
+                search_done = 1;
+                break;
+            }
+
+            /** Publish the node before reading it, then make sure it was still linked once published **/
+            atomic_store(&slot_ptr->hazard_node_ptr[HAZARD_CURRENT], node_current);
+            if(atomic_load(previous_link_ptr) != (uintptr_t)node_current)
+            {
+                break;
+            }
+
+            next_node_address = atomic_load(&node_current->next_node_address);
+            if(0u != (next_node_address & LOCKFREE_MARK_BIT))
+            {
+                /** Node is deleted, help unlinking it **/
+                node_expected = (uintptr_t)node_current;
+                if(!atomic_compare_exchange_strong(previous_link_ptr, &node_expected,
+                                                   next_node_address & ~LOCKFREE_MARK_BIT))
+                {
+                    break;
+                }
+                node_retire(list, thread_slot, node_current);
+                node_current = (struct lockfree_node_t*)(next_node_address & ~LOCKFREE_MARK_BIT);
+            }
+            else
+            {
+                key_current = node_current->key;
+                if(atomic_load(previous_link_ptr) != (uintptr_t)node_current)
+                {
+                    break;
+                }
+                if(key_current >= key)
+                {
+                    if(key_current == key)
+                    {
+                        ret_val = LINKEDLIST_OP_SUCCESS;
+                    }
+                    search_done = 1;
+                    break;
+                }
+
+                /** Move forward, the current node becomes the node before the next one **/
+                node_previous = node_current;
+                atomic_store(&slot_ptr->hazard_node_ptr[HAZARD_PREVIOUS], node_previous);
+                previous_link_ptr = &node_previous->next_node_address;
+                node_current = (struct lockfree_node_t*)next_node_address;
+            }
+        }
+    }
+
+    position->previous_link_ptr = previous_link_ptr;
+    position->node_current = node_current;
+    position->next_node_address = next_node_address;
+
+    return ret_val;
+}
+
+/** Adds an unlinked node to the retired list of the thread, and frees the retired nodes once enough are retired **/
+static void node_retire(lockfree_list_t* list, size_t thread_slot, struct lockfree_node_t* node_retired)
+{
+    lockfree_list_slot_t* slot_ptr = &list->thread_slots[thread_slot];
+
+    node_retired->retired_next_ptr = slot_ptr->retired_first_ptr;
+    slot_ptr->retired_first_ptr = node_retired;
+    slot_ptr->retired_count = slot_ptr->retired_count + 1;
+
+    if(slot_ptr->retired_count >= LOCKFREE_LIST_RETIRE_THRESHOLD)
+    {
+        retired_scan(list, thread_slot);
+    }
+}
+
+/** Frees the retired nodes of the thread no hazard pointer of any thread points to **/
+static void retired_scan(lockfree_list_t* list, size_t thread_slot)
+{
+    lockfree_list_slot_t* slot_ptr = &list->thread_slots[thread_slot];
+    struct lockfree_node_t* hazard_array[LOCKFREE_LIST_MAX_THREADS * LOCKFREE_LIST_HAZARDS_PER_THREAD];
+    struct lockfree_node_t* node_current = slot_ptr->retired_first_ptr;
+    struct lockfree_node_t* node_next = NULL;
+    struct lockfree_node_t* hazard_node = NULL;
+    size_t hazard_count = 0;
+    size_t slot_index = 0;
+    size_t hazard_index = 0;
+
+    /** Step 1: collect the nodes all threads are reading **/
+    for(slot_index = 0; slot_index < LOCKFREE_LIST_MAX_THREADS; slot_index++)
+    {
+        for(hazard_index = 0; hazard_index < LOCKFREE_LIST_HAZARDS_PER_THREAD; hazard_index++)
+        {
+            hazard_node = atomic_load(&list->thread_slots[slot_index].hazard_node_ptr[hazard_index]);
+            if(NULL != hazard_node)
+            {
+                hazard_array[hazard_count] = hazard_node;
+                hazard_count = hazard_count + 1;
+            }
+        }
+    }
+    qsort(hazard_array, hazard_count, sizeof(hazard_array[0]), address_compare);
+
+    /** Step 2: free the retired nodes that aren't read, keep the others for the next scan **/
+    slot_ptr->retired_first_ptr = NULL;
+    slot_ptr->retired_count = 0;
+    while(NULL != node_current)
+    {
+        node_next = node_current->retired_next_ptr;
+        if(NULL != bsearch(&node_current, hazard_array, hazard_count, sizeof(hazard_array[0]), address_compare))
+        {
+            node_current->retired_next_ptr = slot_ptr->retired_first_ptr;
+            slot_ptr->retired_first_ptr = node_current;
+            slot_ptr->retired_count = slot_ptr->retired_count + 1;
+        }
+        else
+        {
+            free(node_current);
+        }
+        node_current = node_next;
+    }
+}
+
+static void hazards_clear(lockfree_list_t* list, size_t thread_slot)
+{
+    size_t hazard_index = 0;
+
+    for(hazard_index = 0; hazard_index < LOCKFREE_LIST_HAZARDS_PER_THREAD; hazard_index++)
+    {
+        atomic_store(&list->thread_slots[thread_slot].hazard_node_ptr[hazard_index], NULL);
+    }
+}
+
+static int address_compare(const void* address_a, const void* address_b)
+{
+    uintptr_t value_a = (uintptr_t)*(struct lockfree_node_t* const*)address_a;
+    uintptr_t value_b = (uintptr_t)*(struct lockfree_node_t* const*)address_b;
+
+    return (value_a > value_b) - (value_a < value_b);
+}
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,550 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: persistent_list.c
+* File Description: This file contains the implementation of the persistent linkedlist datastructure.
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#define _POSIX_C_SOURCE 200809L
+#include "persistent_list.h"
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static struct persistent_node_t* node_create(int new_data, struct persistent_node_t* node_next);
+static void node_release(struct persistent_node_t* node_current);
+static void grace_period_wait(persistent_list_t* list);
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_list_init
+*
+** Purpose:
+*  This function initializes an empty persistent list.
+*
+** Input Parameters:
+*  - list: persistent_list_t*
+*    A pointer to the list handle to be initialized.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t persistent_list_init(persistent_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if((NULL != list) && (0 == pthread_mutex_init(&list->writer_lock, NULL)))
+    {
+        atomic_init(&list->last_node_ptr, NULL);
+        atomic_init(&list->reader_epoch, 0u);
+        atomic_init(&list->readers_acquiring[0], 0u);
+        atomic_init(&list->readers_acquiring[1], 0u);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_list_insert_end
+*
+** Purpose:
+*  This function makes a new version of the list with new data appended, in O(1). The new node links to the last node
+*  of the previous version, which is shared and not copied.
+*
+** Input Parameters:
+*  - list: persistent_list_t*
+*    A pointer to the list handle.
+*  - new_data: int
+*    Data to be appended.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: memory couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t persistent_list_insert_end(persistent_list_t* list, int new_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct persistent_node_t* node_new = NULL;
+
+    pthread_mutex_lock(&list->writer_lock);
+    /** The reference of the list to its previous last node becomes the link of the new node, the previous version
+        stays alive, so it can be replaced without waiting for the readers **/
+    node_new = node_create(new_data, atomic_load(&list->last_node_ptr));
+    if(NULL != node_new)
+    {
+        atomic_store(&list->last_node_ptr, node_new);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+    pthread_mutex_unlock(&list->writer_lock);
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_list_set_index
+*
+** Purpose:
+*  This function makes a new version of the list with the data at the given index replaced. The nodes from the last
+*  one down to the changed one are copied, all the nodes before the index are shared with the previous version, so
+*  changing the end of the list is cheap and changing its start copies the whole list.
+*
+** Input Parameters:
+*  - list: persistent_list_t*
+*    A pointer to the list handle.
+*  - node_index: size_t
+*    Index of the data to replace, 0 being the first element appended.
+*  - new_data: int
+*    Data to be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: invalid index, or memory couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t persistent_list_set_index(persistent_list_t* list, size_t node_index, int new_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct persistent_node_t* node_old = NULL;
+    struct persistent_node_t* node_current = NULL;
+    struct persistent_node_t* copy_first = NULL;
+    struct persistent_node_t* copy_last = NULL;
+    struct persistent_node_t* copy_new = NULL;
+    size_t copy_count = 0;
+    size_t loop_cntr = 0;
+
+    pthread_mutex_lock(&list->writer_lock);
+    node_old = atomic_load(&list->last_node_ptr);
+    if((NULL != node_old) && (node_index < node_old->node_count))
+    {
+        /** Copies of the nodes from the last one down to the changed one, each copy links to the next one **/
+        copy_count = node_old->node_count - node_index;
+        node_current = node_old;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+        for(loop_cntr = 0; (loop_cntr < copy_count) && (LINKEDLIST_OP_SUCCESS == ret_val); loop_cntr++)
+        {
+            copy_new = node_create((loop_cntr == (copy_count - 1u)) ? new_data : node_current->data, NULL);
+            if(NULL == copy_new)
+            {
+                ret_val = LINKEDLIST_OP_FAIL;
+            }
+            else
+            {
+                copy_new->node_count = node_current->node_count;
+                if(NULL == copy_first)
+                {
+                    copy_first = copy_new;
+                }
+                else
+                {
+                    copy_last->next_node_address_ptr = copy_new;
+                }
+                copy_last = copy_new;
+                node_current = node_current->next_node_address_ptr;
+            }
+        }
+
+        if(LINKEDLIST_OP_SUCCESS == ret_val)
+        {
+            /** The copies share all the nodes before the changed one **/
+            copy_last->next_node_address_ptr = node_current;
+            if(NULL != node_current)
+            {
+                atomic_fetch_add(&node_current->reference_count, 1u);
+            }
+            atomic_store(&list->last_node_ptr, copy_first);
+            grace_period_wait(list);
+            node_release(node_old);
+        }
+        else
+        {
+            /** The copies made so far only link to each other **/
+            node_release(copy_first);
+        }
+    }
+    pthread_mutex_unlock(&list->writer_lock);
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_list_delete_end
+*
+** Purpose:
+*  This function makes a new version of the list without its last element, in O(1). The node is freed once no
+*  snapshot holds it anymore.
+*
+** Input Parameters:
+*  - list: persistent_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t persistent_list_delete_end(persistent_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct persistent_node_t* node_old = NULL;
+
+    pthread_mutex_lock(&list->writer_lock);
+    node_old = atomic_load(&list->last_node_ptr);
+    if(NULL != node_old)
+    {
+        if(NULL != node_old->next_node_address_ptr)
+        {
+            atomic_fetch_add(&node_old->next_node_address_ptr->reference_count, 1u);
+        }
+        atomic_store(&list->last_node_ptr, node_old->next_node_address_ptr);
+        grace_period_wait(list);
+        node_release(node_old);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+    pthread_mutex_unlock(&list->writer_lock);
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_list_delete_all
+*
+** Purpose:
+*  This function makes a new empty version of the list. The nodes are freed once no snapshot holds them anymore.
+*
+** Input Parameters:
+*  - list: persistent_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t persistent_list_delete_all(persistent_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct persistent_node_t* node_old = NULL;
+
+    if(NULL != list)
+    {
+        pthread_mutex_lock(&list->writer_lock);
+        node_old = atomic_exchange(&list->last_node_ptr, NULL);
+        grace_period_wait(list);
+        node_release(node_old);
+        pthread_mutex_unlock(&list->writer_lock);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_list_destroy
+*
+** Purpose:
+*  This function deletes all the elements of the list and frees its lock. Snapshots taken before stay valid until
+*  they are released.
+*
+** Input Parameters:
+*  - list: persistent_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t persistent_list_destroy(persistent_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = persistent_list_delete_all(list);
+
+    if(LINKEDLIST_OP_SUCCESS == ret_val)
+    {
+        pthread_mutex_destroy(&list->writer_lock);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_list_snapshot
+*
+** Purpose:
+*  This function takes a snapshot of the current version of the list in O(1), without copying it and without taking
+*  any lock. Writers can keep changing the list, the snapshot keeps the version it was taken of.
+*
+** Input Parameters:
+*  - list: persistent_list_t*
+*    A pointer to the list handle.
+*  - snapshot: persistent_snapshot_t*
+*    A pointer to the snapshot, to be released with persistent_snapshot_release().
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t persistent_list_snapshot(persistent_list_t* list, persistent_snapshot_t* snapshot)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct persistent_node_t* node_last = NULL;
+    unsigned int reader_epoch = 0;
+
+    if((NULL != list) && (NULL != snapshot))
+    {
+        /** A writer doesn't free a version it replaced while a reader could have read it without holding it yet **/
+        reader_epoch = atomic_load(&list->reader_epoch);
+        atomic_fetch_add(&list->readers_acquiring[reader_epoch], 1u);
+        node_last = atomic_load(&list->last_node_ptr);
+        if(NULL != node_last)
+        {
+            atomic_fetch_add(&node_last->reference_count, 1u);
+        }
+        atomic_fetch_sub(&list->readers_acquiring[reader_epoch], 1u);
+
+        snapshot->last_node_ptr = node_last;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_snapshot_release
+*
+** Purpose:
+*  This function releases a snapshot, the nodes only it was holding are freed.
+*
+** Input Parameters:
+*  - snapshot: persistent_snapshot_t*
+*    A pointer to the snapshot, empty afterwards.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t persistent_snapshot_release(persistent_snapshot_t* snapshot)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != snapshot)
+    {
+        node_release(snapshot->last_node_ptr);
+        snapshot->last_node_ptr = NULL;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_snapshot_size
+*
+** Purpose:
+*  Returns the number of elements of a snapshot, in O(1).
+*
+** Input Parameters:
+*  - snapshot: const persistent_snapshot_t*
+*    A pointer to the snapshot.
+*
+** Return Value:
+*  - size_t
+*    Number of elements.
+*********************************************************************************************************************/
+size_t persistent_snapshot_size(const persistent_snapshot_t* snapshot)
+{
+    return (NULL != snapshot->last_node_ptr) ? snapshot->last_node_ptr->node_count : 0u;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_snapshot_get_end
+*
+** Purpose:
+*  This function reads the last element of a snapshot, in O(1).
+*
+** Input Parameters:
+*  - snapshot: const persistent_snapshot_t*
+*    A pointer to the snapshot.
+*  - current_data: int*
+*    A pointer to a variable to hold the last element.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the snapshot is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t persistent_snapshot_get_end(const persistent_snapshot_t* snapshot, int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != snapshot->last_node_ptr)
+    {
+        *current_data = snapshot->last_node_ptr->data;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_snapshot_get_index
+*
+** Purpose:
+*  This function reads an element of a snapshot. The nodes are walked from the last one, so reading the end of the
+*  list is cheaper than reading its start.
+*
+** Input Parameters:
+*  - snapshot: const persistent_snapshot_t*
+*    A pointer to the snapshot.
+*  - node_index: size_t
+*    Index of the element, 0 being the first element appended.
+*  - current_data: int*
+*    A pointer to a variable to hold the element.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: invalid index.
+*********************************************************************************************************************/
+linkedlist_std_ret_t persistent_snapshot_get_index(const persistent_snapshot_t* snapshot, size_t node_index,
+                                                   int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    const struct persistent_node_t* node_current = snapshot->last_node_ptr;
+
+    if(node_index < persistent_snapshot_size(snapshot))
+    {
+        while((node_current->node_count - 1u) != node_index)
+        {
+            node_current = node_current->next_node_address_ptr;
+        }
+        *current_data = node_current->data;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  persistent_snapshot_to_array
+*
+** Purpose:
+*  This function copies all the elements of a snapshot to an array, in list order, with a single traversal.
+*
+** Input Parameters:
+*  - snapshot: const persistent_snapshot_t*
+*    A pointer to the snapshot.
+*  - data_array: int*
+*    Array to copy to, with room for persistent_snapshot_size() elements.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t persistent_snapshot_to_array(const persistent_snapshot_t* snapshot, int* data_array)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    const struct persistent_node_t* node_current = NULL;
+
+    if((NULL != snapshot) && (NULL != data_array))
+    {
+        /** Every node knows its own index, so the array is filled from its end **/
+        for(node_current = snapshot->last_node_ptr; NULL != node_current;
+            node_current = node_current->next_node_address_ptr)
+        {
+            data_array[node_current->node_count - 1u] = node_current->data;
+        }
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+/** Returns a new node holding one reference, linked to node_next, or NULL if memory couldn't be allocated **/
+static struct persistent_node_t* node_create(int new_data, struct persistent_node_t* node_next)
+{
+    struct persistent_node_t* node_new = (struct persistent_node_t*)malloc(sizeof(struct persistent_node_t));
+
+    if(NULL != node_new)
+    {
+        node_new->data = new_data;
+        node_new->node_count = (NULL != node_next) ? (node_next->node_count + 1u) : 1u;
+        node_new->next_node_address_ptr = node_next;
+        atomic_init(&node_new->reference_count, 1u);
+    }
+
+    return node_new;
+}
+
+/** Gives back one reference to a node. A node whose last reference is given back is freed, and gives back its
+    reference to the node it links to. This is a loop rather than a recursion, so freeing a long version can't
+    overflow the stack. **/
+static void node_release(struct persistent_node_t* node_current)
+{
+    struct persistent_node_t* node_next = NULL;
+
+    while((NULL != node_current) && (1u == atomic_fetch_sub(&node_current->reference_count, 1u)))
+    {
+        node_next = node_current->next_node_address_ptr;
+        free(node_current);
+        node_current = node_next;
+    }
+}
+
+/** Waits until no reader that started before the call is taking a snapshot. Called after a new version was
+    published: a reader that read the replaced last node has added its reference to it by then, and later readers
+    read the new version. Only the slot new readers don't count themselves in is waited for, so readers can't keep
+    a writer waiting. The other slot is emptied first: a reader that read reader_epoch just before the previous grace
+    period flipped it may still be counted there. Called with the writer lock held. **/
+static void grace_period_wait(persistent_list_t* list)
+{
+    unsigned int reader_epoch = atomic_load(&list->reader_epoch);
+
+    while(0u != atomic_load(&list->readers_acquiring[1u - reader_epoch]))
+    {
+        sched_yield();
+    }
+    atomic_store(&list->reader_epoch, 1u - reader_epoch);
+    while(0u != atomic_load(&list->readers_acquiring[reader_epoch]))
+    {
+        sched_yield();
+    }
+}
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,161 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: persistent_list.h
+* File Description: This file contains the public interfaces, datatypes, and other information of the persistent
+* linkedlist function library. Nodes are never changed once they are linked, every change makes a new version of the
+* list that shares all the unchanged nodes with the previous one, so readers can keep a snapshot of any version
+* without copying it. It requires a C11 compiler with atomics support and POSIX threads.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef PERSISTENT_LIST_H_INCLUDED
+#define PERSISTENT_LIST_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Datatype Name:
+*  persistent_node_t
+*
+** Description:
+*  This is a structure datatype that will be used for creating a new persistent list node. A version of the list is
+*  reached through its last element: every node links to the element appended before it, so appending a node
+*  doesn't change any node of the previous version. Apart from the reference count, a node is never changed after
+*  it was linked.
+*
+** Datatype Elements:
+*  [1] data: int
+*      Stores node data.
+*  [2] node_count: size_t
+*      Stores the number of nodes from this node down to the first element, i.e. the size of the version ending at
+*      this node.
+*  [3] next_node_address_ptr: persistent_node_t*
+*      Stores address of the node appended before this one, or NULL for the first element.
+*  [4] reference_count: atomic_size_t
+*      Stores the number of links to the node: from the nodes appended after it, from the list and from snapshots.
+*      The node is freed when it drops to 0.
+*********************************************************************************************************************/
+struct persistent_node_t
+{
+    int data;
+    size_t node_count;
+    struct persistent_node_t* next_node_address_ptr;
+    atomic_size_t reference_count;
+};
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  persistent_snapshot_t
+*
+** Description:
+*  This is a structure datatype that holds one version of a persistent list. The version can't change, and its nodes
+*  aren't freed until the snapshot is released, whatever the writers do to the list meanwhile.
+*
+** Datatype Elements:
+*  [1] last_node_ptr: struct persistent_node_t*
+*      Stores address of the last element of the version, or NULL if the version is empty.
+*********************************************************************************************************************/
+typedef struct
+{
+    struct persistent_node_t* last_node_ptr;
+} persistent_snapshot_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  persistent_list_t
+*
+** Description:
+*  This is a structure datatype that will be used as a handle for a persistent linkedlist. The handle holds the
+*  current version. Writers make the next version and publish it with a single atomic store, one writer at a time.
+*  Readers take a snapshot of the current version without any lock: they count themselves in the readers_acquiring
+*  slot of the current reader_epoch while they read the last node and add their reference to it. Before a writer
+*  gives back its own reference to a version it replaced, it flips reader_epoch and waits until the slot of the
+*  previous epoch is empty (grace period). New readers count themselves in the other slot, so a writer only waits for
+*  the readers that started before it flipped, however many readers keep taking snapshots.
+*
+** Datatype Elements:
+*  [1] last_node_ptr: _Atomic(struct persistent_node_t*)
+*      Stores address of the last element of the current version, or NULL if the list is empty.
+*  [2] reader_epoch: atomic_uint
+*      Stores the readers_acquiring slot new readers count themselves in, 0 or 1.
+*  [3] readers_acquiring: atomic_size_t[2]
+*      Stores the number of readers currently taking a snapshot, per epoch.
+*  [4] writer_lock: pthread_mutex_t
+*      Lets one writer at a time make a new version.
+*
+** Use Example: Read a consistent version of a list that other threads keep appending to:
+*  Step 1: Create the handle and initialize it, before the threads are started:
+*          static persistent_list_t my_list;
+*          persistent_list_init(&my_list);
+*  Step 2: Writers append data:
+*          persistent_list_insert_end(&my_list, 7);
+*  Step 3: Readers take a snapshot, read it as long as needed and release it:
+*          persistent_snapshot_t my_snapshot;
+*          persistent_list_snapshot(&my_list, &my_snapshot);
+*          persistent_snapshot_get_index(&my_snapshot, 0, &my_data);
+*          persistent_snapshot_release(&my_snapshot);
+*  Step 4: Free the list once all the threads are done:
+*          persistent_list_destroy(&my_list);
+*********************************************************************************************************************/
+typedef struct
+{
+    _Atomic(struct persistent_node_t*) last_node_ptr;
+    atomic_uint reader_epoch;
+    atomic_size_t readers_acquiring[2];
+    pthread_mutex_t writer_lock;
+} persistent_list_t;
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+/** List functions, making a new version **/
+extern linkedlist_std_ret_t  persistent_list_init(persistent_list_t* list);
+extern linkedlist_std_ret_t  persistent_list_insert_end(persistent_list_t* list, int new_data);
+extern linkedlist_std_ret_t  persistent_list_set_index(persistent_list_t* list, size_t node_index, int new_data);
+extern linkedlist_std_ret_t  persistent_list_delete_end(persistent_list_t* list);
+extern linkedlist_std_ret_t  persistent_list_delete_all(persistent_list_t* list);
+extern linkedlist_std_ret_t  persistent_list_destroy(persistent_list_t* list);
+
+/** Snapshot functions, reading one version **/
+extern linkedlist_std_ret_t  persistent_list_snapshot(persistent_list_t* list, persistent_snapshot_t* snapshot);
+extern linkedlist_std_ret_t  persistent_snapshot_release(persistent_snapshot_t* snapshot);
+extern size_t                persistent_snapshot_size(const persistent_snapshot_t* snapshot);
+extern linkedlist_std_ret_t  persistent_snapshot_get_end(const persistent_snapshot_t* snapshot, int* current_data);
+extern linkedlist_std_ret_t  persistent_snapshot_get_index(const persistent_snapshot_t* snapshot, size_t node_index,
+                                                           int* current_data);
+extern linkedlist_std_ret_t  persistent_snapshot_to_array(const persistent_snapshot_t* snapshot, int* data_array);
+
+#endif /** PERSISTENT_LIST_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,512 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: skiplist.c
+* File Description: This file contains the implementation of the indexable skip list datastructure.
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#include "skiplist.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************************************************************************************************************
+                                  << Private Constants >>
+*********************************************************************************************************************/
+/** Seed of the level generator, any non-zero value works **/
+#define SKIPLIST_RANDOM_SEED   0x9E3779B9u
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static struct skiplist_node_t* node_create(unsigned int level_count, int new_data);
+static unsigned int level_random(skiplist_t* list);
+static void header_reset(skiplist_t* list);
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  skiplist_init
+*
+** Purpose:
+*  This function initializes an empty skip list and allocates its header node.
+*
+** Input Parameters:
+*  - list: skiplist_t*
+*    A pointer to the list handle to be initialized.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the header node couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t skiplist_init(skiplist_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    list->header_node_ptr = node_create(SKIPLIST_MAX_LEVEL, 0);
+    list->random_state    = SKIPLIST_RANDOM_SEED;
+
+    if(NULL != list->header_node_ptr)
+    {
+        header_reset(list);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  skiplist_insert_end
+*
+** Purpose:
+*  This function inserts an element at the end of the list.
+*
+** Input Parameters:
+*  - list: skiplist_t*
+*    A pointer to the list handle.
+*  - new_data: int
+*    Value to be stored in the new element.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: a new node couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t skiplist_insert_end(skiplist_t* list, int new_data)
+{
+    return skiplist_insert_index(list, list->element_count, new_data);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  skiplist_insert_index
+*
+** Purpose:
+*  This function inserts an element at a provided index, so the new element is found at that index afterwards.
+*
+** Input Parameters:
+*  - list: skiplist_t*
+*    A pointer to the list handle.
+*  - element_index: size_t
+*    Index of the new element, from 0 up to and including the current number of elements.
+*  - new_data: int
+*    Value to be stored in the new element.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range, or a new node couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t skiplist_insert_index(skiplist_t* list, size_t element_index, int new_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct skiplist_node_t* node_update[SKIPLIST_MAX_LEVEL] = {NULL};
+    size_t node_rank[SKIPLIST_MAX_LEVEL] = {0};
+    struct skiplist_node_t* node_current = list->header_node_ptr;
+    struct skiplist_node_t* node_new = NULL;
+    unsigned int level_index = 0;
+    unsigned int level_new = 0;
+
+    if(element_index <= list->element_count)
+    {
+        /** Find the node before the new position on every level, and its position. Positions count from 1, the
+            header node is at position 0 **/
+        for(level_index = list->level_count; level_index > 0u; level_index--)
+        {
+            node_rank[level_index - 1u] = (level_index == list->level_count) ? 0u : node_rank[level_index];
+            while((NULL != node_current->levels[level_index - 1u].next_node_address_ptr) &&
+                  ((node_rank[level_index - 1u] + node_current->levels[level_index - 1u].span) <= element_index))
+            {
+                node_rank[level_index - 1u] += node_current->levels[level_index - 1u].span;
+                node_current = node_current->levels[level_index - 1u].next_node_address_ptr;
+            }
+            node_update[level_index - 1u] = node_current;
+        }
+
+        level_new = level_random(list);
+        node_new  = node_create(level_new, new_data);
+
+        if(NULL != node_new)
+        {
+            /** Levels used for the first time start at the header node, spanning the whole list **/
+            for(level_index = list->level_count; level_index < level_new; level_index++)
+            {
+                node_rank[level_index]   = 0u;
+                node_update[level_index] = list->header_node_ptr;
+                list->header_node_ptr->levels[level_index].span = list->element_count;
+            }
+            if(level_new > list->level_count)
+            {
+                list->level_count = level_new;
+            }
+
+            /** Link the new node after the found node on each of its levels, splitting the found node span **/
+            for(level_index = 0u; level_index < level_new; level_index++)
+            {
+                node_new->levels[level_index].next_node_address_ptr =
+                                                        node_update[level_index]->levels[level_index].next_node_address_ptr;
+                node_new->levels[level_index].span = node_update[level_index]->levels[level_index].span -
+                                                     (element_index - node_rank[level_index]);
+                node_update[level_index]->levels[level_index].next_node_address_ptr = node_new;
+                node_update[level_index]->levels[level_index].span = (element_index - node_rank[level_index]) + 1u;
+            }
+
+            /** Higher levels now pass over one more element **/
+            for(level_index = level_new; level_index < list->level_count; level_index++)
+            {
+                node_update[level_index]->levels[level_index].span += 1u;
+            }
+
+            if(NULL == node_new->levels[0].next_node_address_ptr)
+            {
+                list->tail_node_ptr = node_new;
+            }
+            list->element_count = list->element_count + 1;
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  skiplist_get_end
+*
+** Purpose:
+*  This function reads the last element of the list.
+*
+** Input Parameters:
+*  - list: skiplist_t*
+*    A pointer to the list handle.
+*  - current_data: int*
+*    Points to the variable in which the element will be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t skiplist_get_end(skiplist_t* list, int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != list->tail_node_ptr)
+    {
+        *current_data = list->tail_node_ptr->data;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  skiplist_get_index
+*
+** Purpose:
+*  This function reads the element at a provided index.
+*
+** Input Parameters:
+*  - list: skiplist_t*
+*    A pointer to the list handle.
+*  - element_index: size_t
+*    Index of the element to be read.
+*  - current_data: int*
+*    Points to the variable in which the element will be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range.
+*********************************************************************************************************************/
+linkedlist_std_ret_t skiplist_get_index(skiplist_t* list, size_t element_index, int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct skiplist_node_t* node_current = list->header_node_ptr;
+    size_t node_rank = 0;
+    size_t rank_required = element_index + 1u;
+    unsigned int level_index = 0;
+
+    if(element_index < list->element_count)
+    {
+        for(level_index = list->level_count; level_index > 0u; level_index--)
+        {
+            while((NULL != node_current->levels[level_index - 1u].next_node_address_ptr) &&
+                  ((node_rank + node_current->levels[level_index - 1u].span) <= rank_required))
+            {
+                node_rank += node_current->levels[level_index - 1u].span;
+                node_current = node_current->levels[level_index - 1u].next_node_address_ptr;
+            }
+
+            if(node_rank == rank_required)
+            {
+                break;
+            }
+        }
+
+        *current_data = node_current->data;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  skiplist_delete_end
+*
+** Purpose:
+*  This function deletes the last element of the list.
+*
+** Input Parameters:
+*  - list: skiplist_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t skiplist_delete_end(skiplist_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(0u != list->element_count)
+    {
+        ret_val = skiplist_delete_index(list, list->element_count - 1u);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  skiplist_delete_index
+*
+** Purpose:
+*  This function deletes the element at a provided index.
+*
+** Input Parameters:
+*  - list: skiplist_t*
+*    A pointer to the list handle.
+*  - element_index: size_t
+*    Index of the element to be deleted.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range.
+*********************************************************************************************************************/
+linkedlist_std_ret_t skiplist_delete_index(skiplist_t* list, size_t element_index)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct skiplist_node_t* node_update[SKIPLIST_MAX_LEVEL] = {NULL};
+    struct skiplist_node_t* node_current = list->header_node_ptr;
+    struct skiplist_node_t* node_to_delete = NULL;
+    size_t node_rank = 0;
+    unsigned int level_index = 0;
+
+    if(element_index < list->element_count)
+    {
+        /** Find the node before the deleted position on every level **/
+        for(level_index = list->level_count; level_index > 0u; level_index--)
+        {
+            while((NULL != node_current->levels[level_index - 1u].next_node_address_ptr) &&
+                  ((node_rank + node_current->levels[level_index - 1u].span) <= element_index))
+            {
+                node_rank += node_current->levels[level_index - 1u].span;
+                node_current = node_current->levels[level_index - 1u].next_node_address_ptr;
+            }
+            node_update[level_index - 1u] = node_current;
+        }
+        node_to_delete = node_update[0]->levels[0].next_node_address_ptr;
+
+        /** Unlink the node from the levels it is on, and shorten the spans passing over it on the others **/
+        for(level_index = 0u; level_index < list->level_count; level_index++)
+        {
+            if(node_to_delete == node_update[level_index]->levels[level_index].next_node_address_ptr)
+            {
+                node_update[level_index]->levels[level_index].span += node_to_delete->levels[level_index].span - 1u;
+                node_update[level_index]->levels[level_index].next_node_address_ptr =
+                                                            node_to_delete->levels[level_index].next_node_address_ptr;
+            }
+            else
+            {
+                node_update[level_index]->levels[level_index].span -= 1u;
+            }
+        }
+
+        if(list->tail_node_ptr == node_to_delete)
+        {
+            list->tail_node_ptr = (list->header_node_ptr == node_update[0]) ? NULL : node_update[0];
+        }
+        while((list->level_count > 1u) &&
+              (NULL == list->header_node_ptr->levels[list->level_count - 1u].next_node_address_ptr))
+        {
+            list->level_count = list->level_count - 1u;
+        }
+
+        free(node_to_delete);
+        list->element_count = list->element_count - 1;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  skiplist_delete_all
+*
+** Purpose:
+*  This function frees all the element nodes of the list and leaves it empty. The header node is kept, so the list
+*  can still be used.
+*
+** Input Parameters:
+*  - list: skiplist_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list was already empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t skiplist_delete_all(skiplist_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct skiplist_node_t* node_current = list->header_node_ptr->levels[0].next_node_address_ptr;
+    struct skiplist_node_t* node_tofree = NULL;
+
+    if(NULL != node_current)
+    {
+        while(NULL != node_current)
+        {
+            node_tofree  = node_current;
+            node_current = node_current->levels[0].next_node_address_ptr;
+            free(node_tofree);
+        }
+        header_reset(list);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  skiplist_destroy
+*
+** Purpose:
+*  This function frees all the nodes of the list, including the header node. The list has to be initialized again
+*  before it can be used.
+*
+** Input Parameters:
+*  - list: skiplist_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - None.
+*********************************************************************************************************************/
+void skiplist_destroy(skiplist_t* list)
+{
+    if(NULL != list->header_node_ptr)
+    {
+        (void)skiplist_delete_all(list);
+        free(list->header_node_ptr);
+        list->header_node_ptr = NULL;
+    }
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  skiplist_size
+*
+** Purpose:
+*  Returns the number of elements currently in the list.
+*
+** Input Parameters:
+*  - list: skiplist_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - size_t
+*    Number of elements.
+*********************************************************************************************************************/
+size_t skiplist_size(skiplist_t* list)
+{
+    return list->element_count;
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+static struct skiplist_node_t* node_create(unsigned int level_count, int new_data)
+{
+    struct skiplist_node_t* node_new = (struct skiplist_node_t*)malloc(sizeof(struct skiplist_node_t) +
+                                                                  (level_count * sizeof(struct skiplist_level_t)));
+    unsigned int level_index = 0;
+
+    if(NULL != node_new)
+    {
+        node_new->data = new_data;
+        node_new->level_count = level_count;
+        for(level_index = 0u; level_index < level_count; level_index++)
+        {
+            node_new->levels[level_index].next_node_address_ptr = NULL;
+            node_new->levels[level_index].span = 0u;
+        }
+    }
+
+    return node_new;
+}
+
+/** Returns a level from 1 to SKIPLIST_MAX_LEVEL, every level being 4 times less likely than the one below it **/
+static unsigned int level_random(skiplist_t* list)
+{
+    unsigned int random_value = list->random_state;
+    unsigned int level_new = 1u;
+
+    /** xorshift32 generator **/
+    random_value ^= random_value << 13;
+    random_value ^= random_value >> 17;
+    random_value ^= random_value << 5;
+    list->random_state = random_value;
+
+    while((level_new < SKIPLIST_MAX_LEVEL) && (0u == (random_value & 3u)))
+    {
+        level_new = level_new + 1u;
+        random_value = random_value >> 2;
+    }
+
+    return level_new;
+}
+
+static void header_reset(skiplist_t* list)
+{
+    unsigned int level_index = 0;
+
+    for(level_index = 0u; level_index < SKIPLIST_MAX_LEVEL; level_index++)
+    {
+        list->header_node_ptr->levels[level_index].next_node_address_ptr = NULL;
+        list->header_node_ptr->levels[level_index].span = 0u;
+    }
+    list->tail_node_ptr = NULL;
+    list->element_count = 0u;
+    list->level_count   = 1u;
+}
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
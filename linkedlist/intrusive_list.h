@@ -0,0 +1,125 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: intrusive_list.h
+* File Description: This file contains the public interfaces, datatypes, and other information of the intrusive link-
+* edlist function library.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef INTRUSIVE_LIST_H_INCLUDED
+#define INTRUSIVE_LIST_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Macros >>
+*********************************************************************************************************************/
+/** Returns the address of the object of type "type" whose link field "member" is at address "link_ptr" **/
+#define INTRUSIVE_LIST_CONTAINER_OF(link_ptr, type, member) \
+    ((type*)(void*)((char*)(link_ptr) - offsetof(type, member)))
+
+/** Iterates "link_ptr" over all the links of a list, from the first to the last one. The link the iteration is at
+    must not be deleted inside the loop. **/
+#define INTRUSIVE_LIST_FOR_EACH(link_ptr, list) \
+    for((link_ptr) = intrusive_list_first(list); NULL != (link_ptr); (link_ptr) = intrusive_list_next(link_ptr))
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Datatype Name:
+*  intrusive_link_t
+*
+** Description:
+*  This is a structure datatype that is embedded by the caller in its own records, so the records are linked to each
+*  other directly. The list never allocates, copies or frees a record, the caller owns the storage of every record,
+*  and a record stays in place (array element, arena slot...) while it is linked.
+*
+** Datatype Elements:
+*  [1] next_link_address_ptr: intrusive_link_t*
+*      Stores address of the link embedded in the next record.
+*********************************************************************************************************************/
+struct intrusive_link_t
+{
+    struct intrusive_link_t* next_link_address_ptr;
+};
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  intrusive_list_t
+*
+** Description:
+*  This is a structure datatype that will be used as a handle for an intrusive linkedlist.
+*
+** Datatype Elements:
+*  [1] head_link_ptr: struct intrusive_link_t*
+*      Stores address of the first link, or NULL if the list is empty.
+*  [2] tail_link_ptr: struct intrusive_link_t*
+*      Stores address of the last link, or NULL if the list is empty.
+*  [3] link_count: size_t
+*      Stores the number of records currently linked in the list.
+*
+** Use Example: Link records stored in an array:
+*  Step 1: Embed a link in the record type:
+*          typedef struct { int id; struct intrusive_link_t link; } record_t;
+*          record_t records[8];
+*  Step 2: Create the handle, initialize it and link the records:
+*          intrusive_list_t my_list;
+*          intrusive_list_init(&my_list);
+*          intrusive_list_insert_end(&my_list, &records[0].link);
+*  Step 3: Reach the records back from their links:
+*          struct intrusive_link_t* link_current;
+*          INTRUSIVE_LIST_FOR_EACH(link_current, &my_list)
+*          {
+*              record_t* record_ptr = INTRUSIVE_LIST_CONTAINER_OF(link_current, record_t, link);
+*          }
+*********************************************************************************************************************/
+typedef struct
+{
+    struct intrusive_link_t* head_link_ptr;
+    struct intrusive_link_t* tail_link_ptr;
+    size_t link_count;
+} intrusive_list_t;
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+extern linkedlist_std_ret_t      intrusive_list_init(intrusive_list_t* list);
+extern linkedlist_std_ret_t      intrusive_list_insert_end(intrusive_list_t* list, struct intrusive_link_t* link_new);
+extern linkedlist_std_ret_t      intrusive_list_insert_index(intrusive_list_t* list, size_t link_index,
+                                                             struct intrusive_link_t* link_new);
+extern linkedlist_std_ret_t      intrusive_list_get_end(intrusive_list_t* list, struct intrusive_link_t** link_current);
+extern linkedlist_std_ret_t      intrusive_list_get_index(intrusive_list_t* list, size_t link_index,
+                                                          struct intrusive_link_t** link_current);
+extern linkedlist_std_ret_t      intrusive_list_delete_end(intrusive_list_t* list);
+extern linkedlist_std_ret_t      intrusive_list_delete_index(intrusive_list_t* list, size_t link_index);
+extern linkedlist_std_ret_t      intrusive_list_delete_all(intrusive_list_t* list);
+extern size_t                    intrusive_list_size(intrusive_list_t* list);
+extern struct intrusive_link_t*  intrusive_list_first(intrusive_list_t* list);
+extern struct intrusive_link_t*  intrusive_list_next(struct intrusive_link_t* link_current);
+
+#endif /** INTRUSIVE_LIST_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -28,11 +28,27 @@
 /*********************************************************************************************************************
                                                << Public Constants >>
 *********************************************************************************************************************/
+/** Number of run bins used by linkedlist_sort(), enough for any number of nodes a size_t can count **/
+#define LINKEDLIST_SORT_BINS   (sizeof(size_t) * 8u)
+
+/** Number of nodes between two skip pointers of the jump table kept by LINKEDLIST_TRAVERSAL_JUMP. It can be changed at
+    compile time, a smaller interval makes the table larger and the walk from a skip pointer shorter. **/
+#ifndef LINKEDLIST_JUMP_INTERVAL
+#define LINKEDLIST_JUMP_INTERVAL   32u
+#endif
+
+/** Number of list segments LINKEDLIST_TRAVERSAL_JUMP walks at the same time during a full traversal, so that many
+    node reads are in flight instead of one **/
+#ifndef LINKEDLIST_JUMP_LANES
+#define LINKEDLIST_JUMP_LANES   8u
+#endif
 
 
 /*********************************************************************************************************************
                                                << Public Data Types >>
 *********************************************************************************************************************/
+struct linkedlist_pool_t; /** Defined in linkedlist_pool.h **/
+
 /*********************************************************************************************************************
 ** Datatype Name:
 *  node_t
@@ -81,6 +97,123 @@ typedef enum
     LINKEDLIST_OP_FAIL = 1
 } linkedlist_std_ret_t;
 
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_traversal_t
+*
+** Description:
+*  This is an ENUM datatype that will be used for selecting how the handle based functions walk through a list.
+*  Walking through a list is a chain of dependent memory reads, which is slow once the list is much larger than the
+*  cache. Each list can use its own traversal mode, see linkedlist_traversal_set().
+*
+** Datatype Elements:
+*  [1] LINKEDLIST_TRAVERSAL_PLAIN
+*      Follows the next node addresses one at a time. This is the default mode.
+*  [2] LINKEDLIST_TRAVERSAL_PREFETCH
+*      Asks the processor to fetch the next node while the current one is being worked on, by linkedlist_for_each()
+*      and linkedlist_handle_delete_all(). Helps when there is work to do on every node.
+*  [3] LINKEDLIST_TRAVERSAL_JUMP
+*      Keeps a table holding every LINKEDLIST_JUMP_INTERVAL-th node. Reading a node by index walks from the closest
+*      skip pointer before it, and full traversals walk LINKEDLIST_JUMP_LANES segments of the list at the same time.
+*      The table is rebuilt by the first read after the list was changed, appending or deleting the last node keeps
+*      it up to date.
+*********************************************************************************************************************/
+typedef enum
+{
+    LINKEDLIST_TRAVERSAL_PLAIN = 0,
+    LINKEDLIST_TRAVERSAL_PREFETCH = 1,
+    LINKEDLIST_TRAVERSAL_JUMP = 2
+} linkedlist_traversal_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_t
+*
+** Description:
+*  This is a structure datatype that will be used as a handle for a linkedlist. Unlike the head node based functions,
+*  the handle keeps track of the last node and of the number of nodes, so appending a node or reading the last node
+*  doesn't need to iterate through the whole list.
+*
+** Datatype Elements:
+*  [1] head_node_ptr: struct node_t*
+*      Stores address of the first linkedlist node, or NULL if the list is empty.
+*  [2] tail_node_ptr: struct node_t*
+*      Stores address of the last linkedlist node, or NULL if the list is empty.
+*  [3] node_count: size_t
+*      Stores the number of nodes currently in the list. Node counts and indexes of the handle based functions are
+*      all size_t, so a list isn't limited to 65535 nodes the way the unsigned short based indexes of the head node
+*      based functions used to be.
+*  [4] node_pool_ptr: struct linkedlist_pool_t*
+*      Stores address of the node pool the list takes its nodes from, or NULL if nodes are allocated one by one using
+*      malloc(). See linkedlist_pool.h.
+*  [5] traversal_mode: linkedlist_traversal_t
+*      Stores how the list is walked through, see linkedlist_traversal_t.
+*  [6] jump_table_ptr: struct node_t**
+*      Stores address of the jump table used by LINKEDLIST_TRAVERSAL_JUMP, or NULL if the list has none.
+*  [7] jump_table_count: size_t
+*      Stores the number of skip pointers in the jump table, 0 if the table has to be rebuilt.
+*  [8] jump_table_capacity: size_t
+*      Stores the number of skip pointers the jump table has room for.
+*
+** Use Example: Create a linkedlist handle and append to it:
+*  Step 1: Create the handle and initialize it:
+*          linkedlist_t my_list;
+*          linkedlist_handle_init(&my_list);
+*  Step 2: Append data to the end of the list:
+*          linkedlist_handle_insert_end(&my_list, 7);
+*  Step 3: Free all the nodes once the list is no longer needed:
+*          linkedlist_handle_delete_all(&my_list);
+*********************************************************************************************************************/
+typedef struct
+{
+    struct node_t* head_node_ptr;
+    struct node_t* tail_node_ptr;
+    size_t node_count;
+    struct linkedlist_pool_t* node_pool_ptr;
+    linkedlist_traversal_t traversal_mode;
+    struct node_t** jump_table_ptr;
+    size_t jump_table_count;
+    size_t jump_table_capacity;
+} linkedlist_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_cursor_t
+*
+** Description:
+*  This is a structure datatype that will be used for walking through a linkedlist one node at a time. A cursor
+*  remembers the node it is at and the node before it, so a full pass over the list is O(n), and nodes can be
+*  inserted or erased at the cursor without iterating through the list again.
+*
+** Datatype Elements:
+*  [1] list_ptr: linkedlist_t*
+*      Stores address of the list handle the cursor walks through, or NULL if the cursor walks through a head node
+*      based list, see linkedlist_cursor_init_chain().
+*  [2] node_previous_ptr: struct node_t*
+*      Stores address of the node before the cursor node, or NULL if the cursor is at the first node.
+*  [3] node_current_ptr: struct node_t*
+*      Stores address of the cursor node, or NULL if the cursor went past the last node.
+*  [4] node_index: size_t
+*      Stores the index of the cursor node.
+*
+** Use Example: Sum all the data of a list:
+*  linkedlist_cursor_t my_cursor;
+*  int data = 0, sum = 0;
+*  linkedlist_cursor_init(&my_cursor, &my_list);
+*  while(LINKEDLIST_OP_SUCCESS == linkedlist_cursor_peek(&my_cursor, &data))
+*  {
+*      sum = sum + data;
+*      linkedlist_cursor_next(&my_cursor);
+*  }
+*********************************************************************************************************************/
+typedef struct
+{
+    linkedlist_t* list_ptr;
+    struct node_t* node_previous_ptr;
+    struct node_t* node_current_ptr;
+    size_t node_index;
+} linkedlist_cursor_t;
+
 /*********************************************************************************************************************
                                           << Public Variable Declarations >>
 *********************************************************************************************************************/
@@ -90,12 +223,83 @@ typedef enum
                                            << Public Function Declarations >>
 *********************************************************************************************************************/
 extern linkedlist_std_ret_t  linkedlist_insert_end(struct node_t* head_node, int new_data);
-extern linkedlist_std_ret_t  linkedlist_insert_index(struct node_t* head_node, unsigned short node_index, int new_data);
+extern linkedlist_std_ret_t  linkedlist_insert_index(struct node_t* head_node, size_t node_index, int new_data);
 extern linkedlist_std_ret_t  linkedlist_get_end(struct node_t* head_node, int* current_data);
-extern linkedlist_std_ret_t  linkedlist_get_index(struct node_t* head_node, unsigned short node_index, int* current_data);
+extern linkedlist_std_ret_t  linkedlist_get_index(struct node_t* head_node, size_t node_index, int* current_data);
 extern linkedlist_std_ret_t  linkedlist_delete_end(struct node_t* head_node);
-extern linkedlist_std_ret_t  linkedlist_delete_index(struct node_t* head_node, unsigned short node_index);
+extern linkedlist_std_ret_t  linkedlist_delete_index(struct node_t* head_node, size_t node_index);
 extern linkedlist_std_ret_t  linkedlist_delete_all(struct node_t* head_node);
+
+/** Handle based functions **/
+extern linkedlist_std_ret_t  linkedlist_handle_init(linkedlist_t* list);
+extern linkedlist_std_ret_t  linkedlist_handle_insert_end(linkedlist_t* list, int new_data);
+extern linkedlist_std_ret_t  linkedlist_handle_insert_index(linkedlist_t* list, size_t node_index, int new_data);
+extern linkedlist_std_ret_t  linkedlist_handle_get_end(linkedlist_t* list, int* current_data);
+extern linkedlist_std_ret_t  linkedlist_handle_get_index(linkedlist_t* list, size_t node_index, int* current_data);
+/** Deleting the last node takes O(n): nodes don't link back, so the node before it is searched for from the first
+    node, or from the closest skip pointer with LINKEDLIST_TRAVERSAL_JUMP. dlinkedlist_delete_end() takes O(1). **/
+extern linkedlist_std_ret_t  linkedlist_handle_delete_end(linkedlist_t* list);
+extern linkedlist_std_ret_t  linkedlist_handle_delete_index(linkedlist_t* list, size_t node_index);
+extern linkedlist_std_ret_t  linkedlist_handle_delete_all(linkedlist_t* list);
+extern size_t                linkedlist_handle_size(linkedlist_t* list);
+extern linkedlist_std_ret_t  linkedlist_handle_pool_set(linkedlist_t* list, struct linkedlist_pool_t* pool);
+/** Bulk functions. The nodes of a range are allocated at once only if the list takes them from a node pool **/
+extern linkedlist_std_ret_t  linkedlist_insert_range(linkedlist_t* list, size_t node_index, const int* data_array,
+                                                     size_t data_count);
+extern linkedlist_std_ret_t  linkedlist_append_array(linkedlist_t* list, const int* data_array, size_t data_count);
+extern linkedlist_std_ret_t  linkedlist_delete_range(linkedlist_t* list, size_t node_index, size_t node_count);
+extern linkedlist_std_ret_t  linkedlist_truncate(linkedlist_t* list, size_t new_node_count);
+
+/** Cursor functions **/
+extern linkedlist_std_ret_t  linkedlist_cursor_init(linkedlist_cursor_t* cursor, linkedlist_t* list);
+extern linkedlist_std_ret_t  linkedlist_cursor_init_chain(linkedlist_cursor_t* cursor, struct node_t* head_node);
+extern linkedlist_std_ret_t  linkedlist_cursor_next(linkedlist_cursor_t* cursor);
+extern linkedlist_std_ret_t  linkedlist_cursor_peek(linkedlist_cursor_t* cursor, int* current_data);
+extern linkedlist_std_ret_t  linkedlist_cursor_insert_after(linkedlist_cursor_t* cursor, int new_data);
+extern linkedlist_std_ret_t  linkedlist_cursor_erase(linkedlist_cursor_t* cursor);
+
+/** Sort functions **/
+extern linkedlist_std_ret_t  linkedlist_sort(linkedlist_t* list);
+extern linkedlist_std_ret_t  linkedlist_merge(linkedlist_t* list, linkedlist_t* list_source);
+extern linkedlist_std_ret_t  linkedlist_dedup(linkedlist_t* list);
+
+/** Locality functions **/
+extern linkedlist_std_ret_t  linkedlist_compact(linkedlist_t* list);
+extern double                linkedlist_stride_average(linkedlist_t* list);
+extern linkedlist_std_ret_t  linkedlist_compact_if_fragmented(linkedlist_t* list, double stride_threshold);
+
+/** Traversal functions **/
+extern linkedlist_std_ret_t  linkedlist_traversal_set(linkedlist_t* list, linkedlist_traversal_t traversal_mode);
+extern linkedlist_std_ret_t  linkedlist_for_each(linkedlist_t* list, void (*visit_function)(int data, void* context),
+                                                 void* context);
+extern linkedlist_std_ret_t  linkedlist_split_points(linkedlist_t* list, size_t split_count,
+                                                     struct node_t** split_nodes);
+
+/** Search functions **/
+extern linkedlist_std_ret_t  linkedlist_index_of(linkedlist_t* list, int data, size_t* node_index);
+extern linkedlist_std_ret_t  linkedlist_count_of(linkedlist_t* list, int data, size_t* match_count);
+extern linkedlist_std_ret_t  linkedlist_contains(linkedlist_t* list, int data);
+
+/** Splice functions, moving nodes between lists without copying them. linkedlist_split() and linkedlist_splice()
+    walk both lists up to the indexes and then the range, O(node_index + source_index + node_count), only moves from
+    or to the ends of the lists skip the walks. linkedlist_splice_cursor() starts at the nodes of two cursors, so it
+    only walks the range, O(node_count), or nothing when the range goes up to the end of the source list. **/
+extern linkedlist_std_ret_t  linkedlist_concat(linkedlist_t* list, linkedlist_t* list_source);
+extern linkedlist_std_ret_t  linkedlist_split(linkedlist_t* list, size_t node_index, linkedlist_t* list_tail);
+extern linkedlist_std_ret_t  linkedlist_splice(linkedlist_t* list, size_t node_index, linkedlist_t* list_source,
+                                               size_t source_index, size_t node_count);
+extern linkedlist_std_ret_t  linkedlist_splice_cursor(linkedlist_cursor_t* cursor, linkedlist_cursor_t* source_cursor,
+                                                      size_t node_count);
+extern linkedlist_std_ret_t  linkedlist_reverse(linkedlist_t* list);
+
+/** Array functions, copying the data between a list and a contiguous array **/
+extern linkedlist_std_ret_t  linkedlist_to_array(linkedlist_t* list, int* data_array);
+extern linkedlist_std_ret_t  linkedlist_to_chunks(linkedlist_t* list, int* chunk_buffer, size_t chunk_size,
+                                                  linkedlist_std_ret_t (*chunk_function)(const int* data_array,
+                                                                                         size_t data_count,
+                                                                                         void* context),
+                                                  void* context);
+extern linkedlist_std_ret_t  linkedlist_from_array(linkedlist_t* list, const int* data_array, size_t data_count);
 #endif /** LINKEDLIST_H_INCLUDED **/
 /*********************************************************************************************************************
                                                << End of File >>
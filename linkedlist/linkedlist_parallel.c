@@ -0,0 +1,625 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: linkedlist_parallel.c
+* File Description: This file contains the implementation of the linkedlist parallel reductions.
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#include "linkedlist_parallel.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/*********************************************************************************************************************
+                                         << Private Macros >>
+*********************************************************************************************************************/
+/** Maximum number of parts of one reduction **/
+#define PARALLEL_PARTS_MAX   (LINKEDLIST_PARALLEL_MAX_THREADS * LINKEDLIST_PARALLEL_PARTS_PER_THREAD)
+
+/** Number of nodes find_first visits between two checks whether a part before it already found a match **/
+#define PARALLEL_CANCEL_INTERVAL   1024u
+
+/*********************************************************************************************************************
+                                         << Private Data Types >>
+*********************************************************************************************************************/
+typedef enum
+{
+    PARALLEL_SUM = 0,
+    PARALLEL_MIN,
+    PARALLEL_MAX,
+    PARALLEL_COUNT_IF,
+    PARALLEL_FIND_FIRST
+} parallel_op_t;
+
+/** Shared by all the parts of one reduction **/
+typedef struct
+{
+    parallel_op_t reduce_op;
+    int (*predicate_function)(int data, void* context);
+    void* context;
+    atomic_size_t found_index; /** Smallest matching index found so far, SIZE_MAX if none **/
+} parallel_job_t;
+
+/** One part of the list, and its result once reduced **/
+typedef struct
+{
+    parallel_job_t* job_ptr;
+    struct node_t* first_node;
+    size_t first_index;
+    size_t node_count;
+    long long data_sum;
+    int data_min;
+    int data_max;
+    size_t match_count;
+    size_t match_index; /** SIZE_MAX if the part has no match **/
+} parallel_part_t;
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static void* pool_thread(void* pool_arg);
+static linkedlist_std_ret_t parallel_reduce(linkedlist_thread_pool_t* pool, linkedlist_t* list, parallel_job_t* job,
+                                            parallel_part_t* result);
+static void part_reduce(void* task_array, size_t task_index);
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_thread_pool_init
+*
+** Purpose:
+*  This function starts the threads of a thread pool, which then wait for work.
+*
+** Input Parameters:
+*  - pool: linkedlist_thread_pool_t*
+*    A pointer to the pool handle.
+*  - thread_count: size_t
+*    Number of threads, from 1 up to LINKEDLIST_PARALLEL_MAX_THREADS.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: invalid thread count, or the threads couldn't be started.
+*********************************************************************************************************************/
+linkedlist_std_ret_t linkedlist_thread_pool_init(linkedlist_thread_pool_t* pool, size_t thread_count)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    size_t thread_index = 0;
+
+    if((NULL != pool) && (0u != thread_count) && (thread_count <= LINKEDLIST_PARALLEL_MAX_THREADS))
+    {
+        pool->thread_count  = 0;
+        pool->task_function = NULL;
+        pool->task_array    = NULL;
+        pool->task_count    = 0;
+        pool->task_next     = 0;
+        pool->task_finished = 0;
+        pool->pool_stop     = 0;
+        pthread_mutex_init(&pool->pool_lock, NULL);
+        pthread_cond_init(&pool->work_ready, NULL);
+        pthread_cond_init(&pool->work_done, NULL);
+
+        for(thread_index = 0; thread_index < thread_count; thread_index++)
+        {
+            if(0 == pthread_create(&pool->thread_ids[pool->thread_count], NULL, pool_thread, pool))
+            {
+                pool->thread_count = pool->thread_count + 1;
+            }
+        }
+
+        if(thread_count == pool->thread_count)
+        {
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+        else
+        {
+            (void)linkedlist_thread_pool_destroy(pool);
+        }
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_thread_pool_run
+*
+** Purpose:
+*  This function runs a batch of tasks on the pool threads, and returns once all of them are finished. Every task is
+*  run exactly once, by whichever thread is free first.
+*
+** Input Parameters:
+*  - pool: linkedlist_thread_pool_t*
+*    A pointer to the pool handle.
+*  - task_function: void (*)(void* task_array, size_t task_index)
+*    Function running one task, called with task_array and the index of the task.
+*  - task_array: void*
+*    Address of the tasks, only given to task_function.
+*  - task_count: size_t
+*    Number of tasks.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: invalid pool or task function.
+*********************************************************************************************************************/
+linkedlist_std_ret_t linkedlist_thread_pool_run(linkedlist_thread_pool_t* pool,
+                                                void (*task_function)(void* task_array, size_t task_index),
+                                                void* task_array, size_t task_count)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if((NULL != pool) && (NULL != task_function) && (0u != pool->thread_count))
+    {
+        pthread_mutex_lock(&pool->pool_lock);
+        pool->task_function = task_function;
+        pool->task_array    = task_array;
+        pool->task_count    = task_count;
+        pool->task_next     = 0;
+        pool->task_finished = 0;
+        pthread_cond_broadcast(&pool->work_ready);
+        while(pool->task_finished < pool->task_count)
+        {
+            pthread_cond_wait(&pool->work_done, &pool->pool_lock);
+        }
+        pool->task_count = 0;
+        pool->task_next  = 0;
+        pthread_mutex_unlock(&pool->pool_lock);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_thread_pool_destroy
+*
+** Purpose:
+*  This function ends the threads of a thread pool and waits for them.
+*
+** Input Parameters:
+*  - pool: linkedlist_thread_pool_t*
+*    A pointer to the pool handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: invalid pool.
+*********************************************************************************************************************/
+linkedlist_std_ret_t linkedlist_thread_pool_destroy(linkedlist_thread_pool_t* pool)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    size_t thread_index = 0;
+
+    if(NULL != pool)
+    {
+        pthread_mutex_lock(&pool->pool_lock);
+        pool->pool_stop = 1;
+        pthread_cond_broadcast(&pool->work_ready);
+        pthread_mutex_unlock(&pool->pool_lock);
+
+        for(thread_index = 0; thread_index < pool->thread_count; thread_index++)
+        {
+            pthread_join(pool->thread_ids[thread_index], NULL);
+        }
+        pool->thread_count = 0;
+        pthread_cond_destroy(&pool->work_done);
+        pthread_cond_destroy(&pool->work_ready);
+        pthread_mutex_destroy(&pool->pool_lock);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_parallel_sum
+*
+** Purpose:
+*  This function adds up all the data of a list, using the pool threads.
+*
+** Input Parameters:
+*  - pool: linkedlist_thread_pool_t*
+*    A pointer to the pool handle, or NULL to reduce the list on the calling thread.
+*  - list: linkedlist_t*
+*    A pointer to the list handle.
+*  - data_sum: long long*
+*    A pointer to a variable to hold the sum, 0 for an empty list.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: invalid list or pointer.
+*********************************************************************************************************************/
+linkedlist_std_ret_t linkedlist_parallel_sum(linkedlist_thread_pool_t* pool, linkedlist_t* list,
+                                             long long* data_sum)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    parallel_job_t job = {PARALLEL_SUM, NULL, NULL, SIZE_MAX};
+    parallel_part_t result;
+
+    if((NULL != data_sum) && (LINKEDLIST_OP_SUCCESS == parallel_reduce(pool, list, &job, &result)))
+    {
+        *data_sum = result.data_sum;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_parallel_min
+*
+** Purpose:
+*  This function finds the smallest data of a list, using the pool threads.
+*
+** Input Parameters:
+*  - pool: linkedlist_thread_pool_t*
+*    A pointer to the pool handle, or NULL to reduce the list on the calling thread.
+*  - list: linkedlist_t*
+*    A pointer to the list handle.
+*  - data_min: int*
+*    A pointer to a variable to hold the smallest data.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: invalid list or pointer, or empty list.
+*********************************************************************************************************************/
+linkedlist_std_ret_t linkedlist_parallel_min(linkedlist_thread_pool_t* pool, linkedlist_t* list, int* data_min)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    parallel_job_t job = {PARALLEL_MIN, NULL, NULL, SIZE_MAX};
+    parallel_part_t result;
+
+    if((NULL != data_min) && (NULL != list) && (0u != list->node_count) &&
+       (LINKEDLIST_OP_SUCCESS == parallel_reduce(pool, list, &job, &result)))
+    {
+        *data_min = result.data_min;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_parallel_max
+*
+** Purpose:
+*  This function finds the largest data of a list, using the pool threads.
+*
+** Input Parameters:
+*  - pool: linkedlist_thread_pool_t*
+*    A pointer to the pool handle, or NULL to reduce the list on the calling thread.
+*  - list: linkedlist_t*
+*    A pointer to the list handle.
+*  - data_max: int*
+*    A pointer to a variable to hold the largest data.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: invalid list or pointer, or empty list.
+*********************************************************************************************************************/
+linkedlist_std_ret_t linkedlist_parallel_max(linkedlist_thread_pool_t* pool, linkedlist_t* list, int* data_max)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    parallel_job_t job = {PARALLEL_MAX, NULL, NULL, SIZE_MAX};
+    parallel_part_t result;
+
+    if((NULL != data_max) && (NULL != list) && (0u != list->node_count) &&
+       (LINKEDLIST_OP_SUCCESS == parallel_reduce(pool, list, &job, &result)))
+    {
+        *data_max = result.data_max;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_parallel_count_if
+*
+** Purpose:
+*  This function counts the data of a list a predicate holds for, using the pool threads. The predicate is called
+*  from several threads at the same time, in no particular order.
+*
+** Input Parameters:
+*  - pool: linkedlist_thread_pool_t*
+*    A pointer to the pool handle, or NULL to reduce the list on the calling thread.
+*  - list: linkedlist_t*
+*    A pointer to the list handle.
+*  - predicate_function: int (*)(int data, void* context)
+*    Function returning non zero for the data to count.
+*  - context: void*
+*    Given to predicate_function with every data.
+*  - match_count: size_t*
+*    A pointer to a variable to hold the number of data counted.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: invalid list, function or pointer.
+*********************************************************************************************************************/
+linkedlist_std_ret_t linkedlist_parallel_count_if(linkedlist_thread_pool_t* pool, linkedlist_t* list,
+                                                  int (*predicate_function)(int data, void* context),
+                                                  void* context, size_t* match_count)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    parallel_job_t job = {PARALLEL_COUNT_IF, predicate_function, context, SIZE_MAX};
+    parallel_part_t result;
+
+    if((NULL != match_count) && (NULL != predicate_function) &&
+       (LINKEDLIST_OP_SUCCESS == parallel_reduce(pool, list, &job, &result)))
+    {
+        *match_count = result.match_count;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_parallel_find_first
+*
+** Purpose:
+*  This function finds the index of the first data of a list a predicate holds for, using the pool threads. The
+*  predicate is called from several threads at the same time, in no particular order, and may be called for data
+*  after the first match. Parts after a found match stop early.
+*
+** Input Parameters:
+*  - pool: linkedlist_thread_pool_t*
+*    A pointer to the pool handle, or NULL to search the list on the calling thread.
+*  - list: linkedlist_t*
+*    A pointer to the list handle.
+*  - predicate_function: int (*)(int data, void* context)
+*    Function returning non zero for the data searched for.
+*  - context: void*
+*    Given to predicate_function with every data.
+*  - node_index: size_t*
+*    A pointer to a variable to hold the index of the first match.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: invalid list, function or pointer, or no data matches.
+*********************************************************************************************************************/
+linkedlist_std_ret_t linkedlist_parallel_find_first(linkedlist_thread_pool_t* pool, linkedlist_t* list,
+                                                    int (*predicate_function)(int data, void* context),
+                                                    void* context, size_t* node_index)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    parallel_job_t job = {PARALLEL_FIND_FIRST, predicate_function, context, SIZE_MAX};
+    parallel_part_t result;
+
+    if((NULL != node_index) && (NULL != predicate_function) &&
+       (LINKEDLIST_OP_SUCCESS == parallel_reduce(pool, list, &job, &result)) && (SIZE_MAX != result.match_index))
+    {
+        *node_index = result.match_index;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+/** Runs the tasks of the pool until the pool is destroyed **/
+static void* pool_thread(void* pool_arg)
+{
+    linkedlist_thread_pool_t* pool = (linkedlist_thread_pool_t*)pool_arg;
+    size_t task_index = 0;
+
+    pthread_mutex_lock(&pool->pool_lock);
+    while(0 == pool->pool_stop)
+    {
+        if(pool->task_next < pool->task_count)
+        {
+            task_index = pool->task_next;
+            pool->task_next = pool->task_next + 1;
+            pthread_mutex_unlock(&pool->pool_lock);
+
+            pool->task_function(pool->task_array, task_index);
+
+            pthread_mutex_lock(&pool->pool_lock);
+            pool->task_finished = pool->task_finished + 1;
+            if(pool->task_finished == pool->task_count)
+            {
+                pthread_cond_signal(&pool->work_done);
+            }
+        }
+        else
+        {
+            pthread_cond_wait(&pool->work_ready, &pool->pool_lock);
+        }
+    }
+    pthread_mutex_unlock(&pool->pool_lock);
+
+    return NULL;
+}
+
+/** Cuts the list into parts, reduces every part on the pool threads and combines the results of the parts in list
+    order, so the result is the same as the one of a single pass. **/
+static linkedlist_std_ret_t parallel_reduce(linkedlist_thread_pool_t* pool, linkedlist_t* list, parallel_job_t* job,
+                                            parallel_part_t* result)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    parallel_part_t parts[PARALLEL_PARTS_MAX];
+    struct node_t* split_nodes[PARALLEL_PARTS_MAX];
+    size_t part_count = LINKEDLIST_PARALLEL_PARTS_PER_THREAD;
+    size_t part_index = 0;
+
+    if(NULL != list)
+    {
+        if(NULL != pool)
+        {
+            part_count = pool->thread_count * LINKEDLIST_PARALLEL_PARTS_PER_THREAD;
+        }
+        if(part_count > (list->node_count / LINKEDLIST_PARALLEL_PART_MIN))
+        {
+            part_count = list->node_count / LINKEDLIST_PARALLEL_PART_MIN;
+        }
+        if((0u == part_count) && (0u != list->node_count))
+        {
+            part_count = 1;
+        }
+
+        result->data_sum    = 0;
+        result->data_min    = 0;
+        result->data_max    = 0;
+        result->match_count = 0;
+        result->match_index = SIZE_MAX;
+        if((0u == part_count) || (LINKEDLIST_OP_SUCCESS == linkedlist_split_points(list, part_count, split_nodes)))
+        {
+            for(part_index = 0; part_index < part_count; part_index++)
+            {
+                parts[part_index].job_ptr     = job;
+                parts[part_index].first_node  = split_nodes[part_index];
+                parts[part_index].first_index = (part_index * list->node_count) / part_count;
+                parts[part_index].node_count  = (((part_index + 1u) * list->node_count) / part_count) -
+                                                parts[part_index].first_index;
+            }
+
+            if((NULL != pool) && (1u < part_count))
+            {
+                (void)linkedlist_thread_pool_run(pool, part_reduce, parts, part_count);
+            }
+            else
+            {
+                for(part_index = 0; part_index < part_count; part_index++)
+                {
+                    part_reduce(parts, part_index);
+                }
+            }
+
+            for(part_index = 0; part_index < part_count; part_index++)
+            {
+                if((0u == part_index) || (parts[part_index].data_min < result->data_min))
+                {
+                    result->data_min = parts[part_index].data_min;
+                }
+                if((0u == part_index) || (parts[part_index].data_max > result->data_max))
+                {
+                    result->data_max = parts[part_index].data_max;
+                }
+                if((SIZE_MAX == result->match_index) && (SIZE_MAX != parts[part_index].match_index))
+                {
+                    result->match_index = parts[part_index].match_index;
+                }
+                result->data_sum    = result->data_sum + parts[part_index].data_sum;
+                result->match_count = result->match_count + parts[part_index].match_count;
+            }
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+    }
+
+    return ret_val;
+}
+
+/** Reduces one part of the list, only the result of the job operation is set. The partial results are kept in local
+    variables and only stored at the end, so the threads don't write to the same cache lines all the time. **/
+static void part_reduce(void* task_array, size_t task_index)
+{
+    parallel_part_t* part = &((parallel_part_t*)task_array)[task_index];
+    parallel_job_t* job = part->job_ptr;
+    struct node_t* node_current = part->first_node;
+    long long data_sum = 0;
+    int data_min = node_current->data;
+    int data_max = node_current->data;
+    size_t match_count = 0;
+    size_t match_index = SIZE_MAX;
+    size_t found_index = 0;
+    size_t loop_cntr = 0;
+
+    if(PARALLEL_SUM == job->reduce_op)
+    {
+        for(loop_cntr = 0; loop_cntr < part->node_count; loop_cntr++)
+        {
+            data_sum = data_sum + node_current->data;
+            node_current = node_current->next_node_address_ptr;
+        }
+    }
+    else if(PARALLEL_MIN == job->reduce_op)
+    {
+        for(loop_cntr = 0; loop_cntr < part->node_count; loop_cntr++)
+        {
+            data_min = (node_current->data < data_min) ? node_current->data : data_min;
+            node_current = node_current->next_node_address_ptr;
+        }
+    }
+    else if(PARALLEL_MAX == job->reduce_op)
+    {
+        for(loop_cntr = 0; loop_cntr < part->node_count; loop_cntr++)
+        {
+            data_max = (node_current->data > data_max) ? node_current->data : data_max;
+            node_current = node_current->next_node_address_ptr;
+        }
+    }
+    else if(PARALLEL_COUNT_IF == job->reduce_op)
+    {
+        for(loop_cntr = 0; loop_cntr < part->node_count; loop_cntr++)
+        {
+            if(0 != job->predicate_function(node_current->data, job->context))
+            {
+                match_count = match_count + 1;
+            }
+            node_current = node_current->next_node_address_ptr;
+        }
+    }
+    else
+    {
+        /** Stops at the first match of the part, or once a part before this one has found a match **/
+        for(loop_cntr = 0; (loop_cntr < part->node_count) && (SIZE_MAX == match_index); loop_cntr++)
+        {
+            if((0u == (loop_cntr % PARALLEL_CANCEL_INTERVAL)) &&
+               (atomic_load_explicit(&job->found_index, memory_order_relaxed) < part->first_index))
+            {
+                loop_cntr = part->node_count;
+            }
+            else if(0 != job->predicate_function(node_current->data, job->context))
+            {
+                match_index = part->first_index + loop_cntr;
+            }
+            else
+            {
+                node_current = node_current->next_node_address_ptr;
+            }
+        }
+
+        /** Lowers the shared smallest index, unless another part already found a smaller one **/
+        found_index = atomic_load_explicit(&job->found_index, memory_order_relaxed);
+        while((match_index < found_index) &&
+              (0 == atomic_compare_exchange_weak(&job->found_index, &found_index, match_index)))
+        {
+            /** found_index now holds the index another part stored, compare again **/
+        }
+    }
+
+    part->data_sum    = data_sum;
+    part->data_min    = data_min;
+    part->data_max    = data_max;
+    part->match_count = match_count;
+    part->match_index = match_index;
+}
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,138 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: linkedlist_parallel.h
+* File Description: This file contains the public interfaces, datatypes, and other information of the linkedlist
+* parallel reductions. A list is cut into parts at its split points, and the parts are reduced by the threads of a
+* thread pool. It requires a C11 compiler with atomics support and POSIX threads.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef LINKEDLIST_PARALLEL_H_INCLUDED
+#define LINKEDLIST_PARALLEL_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/** Maximum number of threads of a thread pool **/
+#define LINKEDLIST_PARALLEL_MAX_THREADS   64u
+
+/** Number of parts a list is cut into per pool thread. More parts than threads keep all the threads busy when some
+    parts take longer than others, e.g. because their nodes aren't in the cache. **/
+#define LINKEDLIST_PARALLEL_PARTS_PER_THREAD   4u
+
+/** Minimum number of nodes of a part, smaller lists are cut into fewer parts so starting a part costs much less than
+    reducing it. A list shorter than this is reduced by the calling thread alone. **/
+#ifndef LINKEDLIST_PARALLEL_PART_MIN
+#define LINKEDLIST_PARALLEL_PART_MIN   16384u
+#endif
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_thread_pool_t
+*
+** Description:
+*  This is a structure datatype that will be used as a handle for a pool of threads, started once and reused by all
+*  the parallel reductions. A pool runs one batch of tasks at a time, so it must only be used by one thread at a time.
+*
+** Datatype Elements:
+*  [1] thread_ids: pthread_t[LINKEDLIST_PARALLEL_MAX_THREADS]
+*      Stores the ids of the pool threads.
+*  [2] thread_count: size_t
+*      Stores the number of pool threads.
+*  [3] pool_lock: pthread_mutex_t
+*      Protects all the elements below.
+*  [4] work_ready: pthread_cond_t
+*      Signaled when a batch of tasks is started, or when the pool is destroyed.
+*  [5] work_done: pthread_cond_t
+*      Signaled when the last task of a batch is finished.
+*  [6] task_function: void (*)(void* task_array, size_t task_index)
+*      Stores the function running one task of the current batch.
+*  [7] task_array: void*
+*      Stores address of the tasks of the current batch, given to task_function.
+*  [8] task_count: size_t
+*      Stores the number of tasks of the current batch.
+*  [9] task_next: size_t
+*      Stores the index of the next task no thread has taken yet.
+*  [10] task_finished: size_t
+*      Stores the number of finished tasks of the current batch.
+*  [11] pool_stop: int
+*      Set to 1 to make the threads end.
+*
+** Use Example: Sum a list using 4 threads:
+*  Step 1: Start the pool threads:
+*          linkedlist_thread_pool_t my_pool;
+*          linkedlist_thread_pool_init(&my_pool, 4);
+*  Step 2: Reduce as many lists as needed:
+*          linkedlist_parallel_sum(&my_pool, &my_list, &my_sum);
+*  Step 3: End the pool threads once they are no longer needed:
+*          linkedlist_thread_pool_destroy(&my_pool);
+*********************************************************************************************************************/
+typedef struct
+{
+    pthread_t thread_ids[LINKEDLIST_PARALLEL_MAX_THREADS];
+    size_t thread_count;
+    pthread_mutex_t pool_lock;
+    pthread_cond_t work_ready;
+    pthread_cond_t work_done;
+    void (*task_function)(void* task_array, size_t task_index);
+    void* task_array;
+    size_t task_count;
+    size_t task_next;
+    size_t task_finished;
+    int pool_stop;
+} linkedlist_thread_pool_t;
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+/** Thread pool functions **/
+extern linkedlist_std_ret_t  linkedlist_thread_pool_init(linkedlist_thread_pool_t* pool, size_t thread_count);
+extern linkedlist_std_ret_t  linkedlist_thread_pool_run(linkedlist_thread_pool_t* pool,
+                                                        void (*task_function)(void* task_array, size_t task_index),
+                                                        void* task_array, size_t task_count);
+extern linkedlist_std_ret_t  linkedlist_thread_pool_destroy(linkedlist_thread_pool_t* pool);
+
+/** Reduction functions, the list must not be changed while they run **/
+extern linkedlist_std_ret_t  linkedlist_parallel_sum(linkedlist_thread_pool_t* pool, linkedlist_t* list,
+                                                     long long* data_sum);
+extern linkedlist_std_ret_t  linkedlist_parallel_min(linkedlist_thread_pool_t* pool, linkedlist_t* list,
+                                                     int* data_min);
+extern linkedlist_std_ret_t  linkedlist_parallel_max(linkedlist_thread_pool_t* pool, linkedlist_t* list,
+                                                     int* data_max);
+extern linkedlist_std_ret_t  linkedlist_parallel_count_if(linkedlist_thread_pool_t* pool, linkedlist_t* list,
+                                                          int (*predicate_function)(int data, void* context),
+                                                          void* context, size_t* match_count);
+extern linkedlist_std_ret_t  linkedlist_parallel_find_first(linkedlist_thread_pool_t* pool, linkedlist_t* list,
+                                                            int (*predicate_function)(int data, void* context),
+                                                            void* context, size_t* node_index);
+
+#endif /** LINKEDLIST_PARALLEL_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
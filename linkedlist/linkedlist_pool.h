@@ -0,0 +1,161 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: linkedlist_pool.h
+* File Description: This file contains the public interfaces, datatypes, and other information of the linkedlist node
+* pool, a fixed-size node allocator that can be attached to a linkedlist handle.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef LINKEDLIST_POOL_H_INCLUDED
+#define LINKEDLIST_POOL_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/** Number of nodes carved from every slab if no size is given at initialization **/
+#define LINKEDLIST_POOL_DEFAULT_SLAB_NODES   4096u
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_pool_slab_t
+*
+** Description:
+*  This is a structure datatype that is placed at the start of every block of memory the pool allocates. The nodes of
+*  the slab are stored right after it.
+*
+** Datatype Elements:
+*  [1] next_slab_ptr: struct linkedlist_pool_slab_t*
+*      Stores address of the next slab of the pool.
+*  [2] slab_node_count: size_t
+*      Stores the number of nodes the slab holds.
+*  [3] nodes: struct node_t[]
+*      The nodes of the slab.
+*********************************************************************************************************************/
+struct linkedlist_pool_slab_t
+{
+    struct linkedlist_pool_slab_t* next_slab_ptr;
+    size_t slab_node_count;
+    struct node_t nodes[];
+};
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_pool_t
+*
+** Description:
+*  This is a structure datatype that will be used for creating a node pool. Nodes are carved one after the other from
+*  large slabs, and freed nodes are kept on a free list to be recycled by the next allocation. Slabs are only returned
+*  to the system when the pool is destroyed.
+*
+** Datatype Elements:
+*  [1] first_slab_ptr: struct linkedlist_pool_slab_t*
+*      Stores address of the first slab of the pool.
+*  [2] current_slab_ptr: struct linkedlist_pool_slab_t*
+*      Stores address of the slab new nodes are currently carved from.
+*  [3] current_slab_used: size_t
+*      Stores the number of nodes already carved from the current slab.
+*  [4] slab_node_count: size_t
+*      Stores the number of nodes of every newly allocated slab.
+*  [5] free_list_ptr: struct node_t*
+*      Stores address of the first freed node. Freed nodes are linked through their next_node_address_ptr.
+*  [6] slab_count: size_t
+*      Stores the number of slabs allocated by the pool.
+*  [7] node_capacity: size_t
+*      Stores the total number of nodes of all the slabs.
+*  [8] used_node_count: size_t
+*      Stores the number of nodes currently handed out by the pool.
+*  [9] free_node_count: size_t
+*      Stores the number of nodes currently on the free list.
+*
+** Use Example: Create a pool and attach it to a linkedlist handle:
+*  Step 1: Create the pool and initialize it:
+*          linkedlist_pool_t my_pool;
+*          linkedlist_pool_init(&my_pool, LINKEDLIST_POOL_DEFAULT_SLAB_NODES);
+*  Step 2: Attach the pool to an empty list:
+*          linkedlist_handle_pool_set(&my_list, &my_pool);
+*  Step 3: Release all the memory of the pool at once once the list is no longer needed:
+*          linkedlist_pool_destroy(&my_pool);
+*********************************************************************************************************************/
+typedef struct linkedlist_pool_t
+{
+    struct linkedlist_pool_slab_t* first_slab_ptr;
+    struct linkedlist_pool_slab_t* current_slab_ptr;
+    size_t current_slab_used;
+    size_t slab_node_count;
+    struct node_t* free_list_ptr;
+    size_t slab_count;
+    size_t node_capacity;
+    size_t used_node_count;
+    size_t free_node_count;
+} linkedlist_pool_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_pool_stats_t
+*
+** Description:
+*  This is a structure datatype that will be used for reporting the occupancy of a node pool.
+*
+** Datatype Elements:
+*  [1] slab_count: size_t
+*      Number of slabs allocated by the pool.
+*  [2] node_capacity: size_t
+*      Total number of nodes of all the slabs.
+*  [3] used_node_count: size_t
+*      Number of nodes currently handed out by the pool.
+*  [4] free_node_count: size_t
+*      Number of nodes currently waiting on the free list.
+*  [5] untouched_node_count: size_t
+*      Number of nodes that have never been carved from the slabs since the pool was initialized or reset.
+*********************************************************************************************************************/
+typedef struct
+{
+    size_t slab_count;
+    size_t node_capacity;
+    size_t used_node_count;
+    size_t free_node_count;
+    size_t untouched_node_count;
+} linkedlist_pool_stats_t;
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+extern linkedlist_std_ret_t  linkedlist_pool_init(linkedlist_pool_t* pool, size_t slab_node_count);
+extern struct node_t*        linkedlist_pool_alloc(linkedlist_pool_t* pool);
+extern struct node_t*        linkedlist_pool_alloc_run(linkedlist_pool_t* pool, size_t node_count);
+extern void                  linkedlist_pool_free(linkedlist_pool_t* pool, struct node_t* node);
+extern void                  linkedlist_pool_free_chain(linkedlist_pool_t* pool, struct node_t* first_node,
+                                                        struct node_t* last_node, size_t node_count);
+extern void                  linkedlist_pool_reset(linkedlist_pool_t* pool);
+extern void                  linkedlist_pool_destroy(linkedlist_pool_t* pool);
+extern void                  linkedlist_pool_stats_get(linkedlist_pool_t* pool, linkedlist_pool_stats_t* stats);
+
+#endif /** LINKEDLIST_POOL_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
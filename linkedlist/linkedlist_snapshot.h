@@ -0,0 +1,197 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: linkedlist_snapshot.h
+* File Description: This file contains the public interfaces, datatypes, and other information of the linkedlist
+* binary snapshot format. A snapshot stores the elements of a list in a file, so the list can be rebuilt without
+* inserting its elements one by one.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef LINKEDLIST_SNAPSHOT_H_INCLUDED
+#define LINKEDLIST_SNAPSHOT_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/** First four bytes of every snapshot file, "LLSN". A file written on a machine with another byte order doesn't
+    match it, so it is rejected instead of being read wrong. **/
+#define LINKEDLIST_SNAPSHOT_MAGIC     0x4E534C4Cu
+
+/** Version of the snapshot format written by this library, files of any other version are rejected **/
+#define LINKEDLIST_SNAPSHOT_VERSION   1u
+
+/** Number of elements the snapshot writer collects before writing them to the file **/
+#define LINKEDLIST_SNAPSHOT_BUFFER    4096u
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_snapshot_ret_t
+*
+** Description:
+*  This is an ENUM datatype that will be used for the return value of the snapshot operations. The first two values
+*  are the same as the ones of linkedlist_std_ret_t, the others tell why a snapshot file was rejected.
+*
+** Datatype Elements:
+*  [1] LINKEDLIST_SNAPSHOT_OP_SUCCESS
+*      Indicates that the operation performed was successful.
+*  [2] LINKEDLIST_SNAPSHOT_OP_FAIL
+*      Indicates that the file couldn't be opened, read or written, or that memory couldn't be allocated.
+*  [3] LINKEDLIST_SNAPSHOT_BAD_FORMAT
+*      Indicates that the file isn't a snapshot, was written with another element size or byte order, or is
+*      truncated.
+*  [4] LINKEDLIST_SNAPSHOT_BAD_VERSION
+*      Indicates that the file is a snapshot of another version of the format.
+*  [5] LINKEDLIST_SNAPSHOT_BAD_CHECKSUM
+*      Indicates that the header or the elements of the file are corrupt.
+*********************************************************************************************************************/
+typedef enum
+{
+    LINKEDLIST_SNAPSHOT_OP_SUCCESS   = 0,
+    LINKEDLIST_SNAPSHOT_OP_FAIL      = 1,
+    LINKEDLIST_SNAPSHOT_BAD_FORMAT   = 2,
+    LINKEDLIST_SNAPSHOT_BAD_VERSION  = 3,
+    LINKEDLIST_SNAPSHOT_BAD_CHECKSUM = 4
+} linkedlist_snapshot_ret_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_snapshot_header_t
+*
+** Description:
+*  This is a structure datatype that describes the header at the start of every snapshot file. The header is directly
+*  followed by element_count elements of element_size bytes each, in list order. All the fields are stored in the
+*  byte order of the machine that wrote the file, and their sizes add up to 24 bytes without padding.
+*
+** Datatype Elements:
+*  [1] magic: uint32_t
+*      Stores LINKEDLIST_SNAPSHOT_MAGIC.
+*  [2] version: uint16_t
+*      Stores the version of the format, LINKEDLIST_SNAPSHOT_VERSION.
+*  [3] element_size: uint16_t
+*      Stores the size in bytes of every element, sizeof(int) of the machine that wrote the file.
+*  [4] element_count: uint64_t
+*      Stores the number of elements following the header.
+*  [5] payload_checksum: uint32_t
+*      Stores the CRC-32 of the elements.
+*  [6] header_checksum: uint32_t
+*      Stores the CRC-32 of all the header fields before it.
+*********************************************************************************************************************/
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t element_size;
+    uint64_t element_count;
+    uint32_t payload_checksum;
+    uint32_t header_checksum;
+} linkedlist_snapshot_header_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_snapshot_writer_t
+*
+** Description:
+*  This is a structure datatype that will be used for writing a snapshot one part at a time, for lists the elements
+*  can only be read from one after the other. The header is written once all the elements are known.
+*
+** Datatype Elements:
+*  [1] file_ptr: FILE*
+*      Stores the file the snapshot is written to.
+*  [2] header: linkedlist_snapshot_header_t
+*      Stores the header, updated with every element written.
+*  [3] buffer_count: size_t
+*      Stores the number of elements in the buffer, not written to the file yet.
+*  [4] buffer: int[LINKEDLIST_SNAPSHOT_BUFFER]
+*      Stores the elements not written to the file yet.
+*
+** Use Example: Write the elements of a list:
+*  linkedlist_snapshot_writer_t my_writer;
+*  linkedlist_snapshot_writer_open(&my_writer, "my_list.snap");
+*  linkedlist_snapshot_writer_put(&my_writer, my_data, my_data_count);
+*  linkedlist_snapshot_writer_close(&my_writer);
+*********************************************************************************************************************/
+typedef struct
+{
+    FILE* file_ptr;
+    linkedlist_snapshot_header_t header;
+    size_t buffer_count;
+    int buffer[LINKEDLIST_SNAPSHOT_BUFFER];
+} linkedlist_snapshot_writer_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_snapshot_map_t
+*
+** Description:
+*  This is a structure datatype that gives read only access to the elements of a checked snapshot file, which is
+*  mapped to memory instead of being read.
+*
+** Datatype Elements:
+*  [1] data_ptr: const int*
+*      Stores address of the first element, or NULL if the snapshot is empty.
+*  [2] element_count: size_t
+*      Stores the number of elements.
+*  [3] mapping_ptr: void*
+*      Stores address of the whole mapped file.
+*  [4] mapping_size: size_t
+*      Stores the size of the whole mapped file.
+*
+** Use Example: Sum the elements of a snapshot without building a list:
+*  linkedlist_snapshot_map_t my_map;
+*  if(LINKEDLIST_SNAPSHOT_OP_SUCCESS == linkedlist_snapshot_map(&my_map, "my_list.snap"))
+*  {
+*      for(i = 0; i < my_map.element_count; i++) sum = sum + my_map.data_ptr[i];
+*      linkedlist_snapshot_unmap(&my_map);
+*  }
+*********************************************************************************************************************/
+typedef struct
+{
+    const int* data_ptr;
+    size_t element_count;
+    void* mapping_ptr;
+    size_t mapping_size;
+} linkedlist_snapshot_map_t;
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+extern linkedlist_snapshot_ret_t  linkedlist_snapshot_writer_open(linkedlist_snapshot_writer_t* writer,
+                                                                  const char* file_path);
+extern linkedlist_snapshot_ret_t  linkedlist_snapshot_writer_put(linkedlist_snapshot_writer_t* writer,
+                                                                 const int* data_array, size_t data_count);
+extern linkedlist_snapshot_ret_t  linkedlist_snapshot_writer_close(linkedlist_snapshot_writer_t* writer);
+extern linkedlist_snapshot_ret_t  linkedlist_snapshot_map(linkedlist_snapshot_map_t* map, const char* file_path);
+extern void                       linkedlist_snapshot_unmap(linkedlist_snapshot_map_t* map);
+extern linkedlist_snapshot_ret_t  linkedlist_snapshot_write(linkedlist_t* list, const char* file_path);
+extern linkedlist_snapshot_ret_t  linkedlist_snapshot_load(linkedlist_t* list, const char* file_path);
+
+#endif /** LINKEDLIST_SNAPSHOT_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
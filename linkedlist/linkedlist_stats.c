@@ -0,0 +1,278 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: linkedlist_stats.c
+* File Description: This file contains the implementation of the linkedlist instrumentation.
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#define _POSIX_C_SOURCE 200809L
+#include "linkedlist_stats.h"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/*********************************************************************************************************************
+                                  << Public Variable Definitions >>
+*********************************************************************************************************************/
+linkedlist_stats_t linkedlist_stats_global;
+_Thread_local unsigned long long linkedlist_stats_nodes = 0; /** Nodes visited by the thread so far, never reset **/
+
+/*********************************************************************************************************************
+                                  << Private Variable Definitions >>
+*********************************************************************************************************************/
+static pthread_mutex_t stats_lock = PTHREAD_MUTEX_INITIALIZER; /** Guards linkedlist_stats_global **/
+
+static const char* const stats_op_names[LINKEDLIST_STATS_OP_COUNT] =
+{
+    "linkedlist_insert_end",
+    "linkedlist_insert_index",
+    "linkedlist_get_end",
+    "linkedlist_get_index",
+    "linkedlist_delete_end",
+    "linkedlist_delete_index",
+    "linkedlist_delete_all",
+    "linkedlist_handle_insert_end",
+    "linkedlist_handle_insert_index",
+    "linkedlist_handle_get_end",
+    "linkedlist_handle_get_index",
+    "linkedlist_handle_delete_end",
+    "linkedlist_handle_delete_all",
+    "linkedlist_insert_range",
+    "linkedlist_delete_range",
+    "linkedlist_sort",
+    "linkedlist_merge",
+    "linkedlist_dedup",
+    "linkedlist_compact",
+    "linkedlist_for_each",
+    "linkedlist_index_of",
+    "linkedlist_count_of",
+    "linkedlist_concat",
+    "linkedlist_split",
+    "linkedlist_splice",
+    "linkedlist_splice_cursor",
+    "linkedlist_reverse",
+    "linkedlist_to_array",
+    "linkedlist_to_chunks",
+    "linkedlist_from_array",
+};
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_stats_get
+*
+** Purpose:
+*  This function copies all the linkedlist counters.
+*
+** Input Parameters:
+*  - stats: linkedlist_stats_t*
+*    A pointer to the structure the counters are copied to.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the library was built without LINKEDLIST_STATS_ENABLE, all the copied counters are 0.
+*********************************************************************************************************************/
+linkedlist_std_ret_t linkedlist_stats_get(linkedlist_stats_t* stats)
+{
+    pthread_mutex_lock(&stats_lock);
+    *stats = linkedlist_stats_global;
+    pthread_mutex_unlock(&stats_lock);
+
+    return (1 == LINKEDLIST_STATS_ENABLE) ? LINKEDLIST_OP_SUCCESS : LINKEDLIST_OP_FAIL;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_stats_reset
+*
+** Purpose:
+*  This function sets all the linkedlist counters back to 0, e.g. to only count a part of a program.
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void linkedlist_stats_reset(void)
+{
+    pthread_mutex_lock(&stats_lock);
+    memset(&linkedlist_stats_global, 0, sizeof(linkedlist_stats_global));
+    pthread_mutex_unlock(&stats_lock);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_stats_dump_json
+*
+** Purpose:
+*  This function writes all the linkedlist counters to a file as one JSON object, with one member per function named
+*  after the function.
+*
+** Input Parameters:
+*  - file_ptr: FILE*
+*    File the counters are written to, e.g. stdout.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the file couldn't be written.
+*********************************************************************************************************************/
+linkedlist_std_ret_t linkedlist_stats_dump_json(FILE* file_ptr)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_SUCCESS;
+    linkedlist_stats_t stats_copy;
+    const linkedlist_stats_entry_t* entry = NULL;
+    size_t op_index = 0;
+    size_t bin_index = 0;
+
+    /** The counters are written from a copy, so the lock isn't held while the file is written **/
+    (void)linkedlist_stats_get(&stats_copy);
+    fprintf(file_ptr, "{\n  \"enabled\": %s,\n  \"alloc_count\": %llu,\n  \"free_count\": %llu,\n  \"operations\": {",
+            (1 == LINKEDLIST_STATS_ENABLE) ? "true" : "false", stats_copy.alloc_count, stats_copy.free_count);
+    for(op_index = 0; op_index < LINKEDLIST_STATS_OP_COUNT; op_index++)
+    {
+        entry = &stats_copy.op_entries[op_index];
+        fprintf(file_ptr, "%s\n    \"%s\": {\"calls\": %llu, \"nodes_traversed\": %llu, \"latency_total_ns\": %llu, "
+                "\"latency_histogram_log2_ns\": [", (0u == op_index) ? "" : ",", stats_op_names[op_index],
+                entry->call_count, entry->nodes_traversed, entry->latency_total_ns);
+        for(bin_index = 0; bin_index < LINKEDLIST_STATS_HISTOGRAM_BINS; bin_index++)
+        {
+            fprintf(file_ptr, "%s%llu", (0u == bin_index) ? "" : ", ", entry->latency_histogram[bin_index]);
+        }
+        fprintf(file_ptr, "]}");
+    }
+    fprintf(file_ptr, "\n  }\n}\n");
+
+    if(0 != ferror(file_ptr))
+    {
+        ret_val = LINKEDLIST_OP_FAIL;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_stats_op_name
+*
+** Purpose:
+*  This function returns the name of a counted function, as used by linkedlist_stats_dump_json().
+*
+** Input Parameters:
+*  - stats_op: linkedlist_stats_op_t
+*    Counted function.
+*
+** Return Value:
+*  - const char*
+*    Name of the function, or NULL if stats_op isn't a counted function.
+*********************************************************************************************************************/
+const char* linkedlist_stats_op_name(linkedlist_stats_op_t stats_op)
+{
+    return ((unsigned int)stats_op < LINKEDLIST_STATS_OP_COUNT) ? stats_op_names[stats_op] : NULL;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_stats_time_now
+*
+** Purpose:
+*  This function returns a monotonic time stamp, used by LINKEDLIST_STATS_BEGIN().
+*
+** Input Parameters:
+*  - void
+*
+** Return Value:
+*  - unsigned long long
+*    Time stamp in nanoseconds.
+*********************************************************************************************************************/
+unsigned long long linkedlist_stats_time_now(void)
+{
+    struct timespec time_stamp;
+
+    clock_gettime(CLOCK_MONOTONIC, &time_stamp);
+    return ((unsigned long long)time_stamp.tv_sec * 1000000000ull) + (unsigned long long)time_stamp.tv_nsec;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_stats_record
+*
+** Purpose:
+*  This function adds one call to the counters of a function, used by LINKEDLIST_STATS_END().
+*
+** Input Parameters:
+*  - stats_op: linkedlist_stats_op_t
+*    Function that was called.
+*  - time_start: unsigned long long
+*    Time stamp taken when the call started.
+*  - nodes_start: unsigned long long
+*    Value of linkedlist_stats_nodes when the call started.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void linkedlist_stats_record(linkedlist_stats_op_t stats_op, unsigned long long time_start,
+                             unsigned long long nodes_start)
+{
+    linkedlist_stats_entry_t* entry = &linkedlist_stats_global.op_entries[stats_op];
+    unsigned long long latency_ns = linkedlist_stats_time_now() - time_start;
+    unsigned long long latency_bound = latency_ns;
+    size_t bin_index = 0;
+
+    /** The bin is the position of the highest set bit of the latency **/
+    while((latency_bound > 1u) && (bin_index < (LINKEDLIST_STATS_HISTOGRAM_BINS - 1u)))
+    {
+        latency_bound = latency_bound >> 1;
+        bin_index = bin_index + 1;
+    }
+
+    pthread_mutex_lock(&stats_lock);
+    entry->call_count       = entry->call_count + 1;
+    entry->nodes_traversed  = entry->nodes_traversed + (linkedlist_stats_nodes - nodes_start);
+    entry->latency_total_ns = entry->latency_total_ns + latency_ns;
+    entry->latency_histogram[bin_index] = entry->latency_histogram[bin_index] + 1;
+    pthread_mutex_unlock(&stats_lock);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  linkedlist_stats_memory
+*
+** Purpose:
+*  This function adds allocated and freed nodes to the counters, used by LINKEDLIST_STATS_ALLOC() and
+*  LINKEDLIST_STATS_FREE().
+*
+** Input Parameters:
+*  - alloc_count: unsigned long long
+*    Number of nodes allocated.
+*  - free_count: unsigned long long
+*    Number of nodes freed.
+*
+** Return Value:
+*  - void
+*********************************************************************************************************************/
+void linkedlist_stats_memory(unsigned long long alloc_count, unsigned long long free_count)
+{
+    pthread_mutex_lock(&stats_lock);
+    linkedlist_stats_global.alloc_count = linkedlist_stats_global.alloc_count + alloc_count;
+    linkedlist_stats_global.free_count  = linkedlist_stats_global.free_count + free_count;
+    pthread_mutex_unlock(&stats_lock);
+}
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
@@ -0,0 +1,198 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: linkedlist_stats.h
+* File Description: This file contains the public interfaces, datatypes, and other information of the linkedlist
+* instrumentation. Counting is compiled into linkedlist.c only if LINKEDLIST_STATS_ENABLE is set to 1, otherwise all
+* the counting macros expand to nothing.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef LINKEDLIST_STATS_H_INCLUDED
+#define LINKEDLIST_STATS_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/** Set to 1 at compile time, e.g. -DLINKEDLIST_STATS_ENABLE=1, to count the linkedlist operations. The switch must be
+    the same for every file including this header. **/
+#ifndef LINKEDLIST_STATS_ENABLE
+#define LINKEDLIST_STATS_ENABLE   0
+#endif
+
+/** Number of latency histogram bins, bin i counts the calls that took from 2^i up to 2^(i+1) nanoseconds. Bin 0 also
+    counts the calls that took less than 1 ns, the last bin also counts all the longer calls. **/
+#define LINKEDLIST_STATS_HISTOGRAM_BINS   32u
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_stats_op_t
+*
+** Description:
+*  This is an ENUM datatype that names every counted linkedlist function. Functions that only call another one, like
+*  linkedlist_handle_delete_index(), linkedlist_append_array() or linkedlist_contains(), are counted as the function
+*  they call. Calls made by one counted function to another are counted for both.
+*
+** Datatype Elements:
+*  [1] LINKEDLIST_STATS_INSERT_END ... LINKEDLIST_STATS_DELETE_ALL
+*      Head node based functions.
+*  [2] LINKEDLIST_STATS_HANDLE_INSERT_END ... LINKEDLIST_STATS_FROM_ARRAY
+*      Handle based functions.
+*  [3] LINKEDLIST_STATS_OP_COUNT
+*      Number of counted functions.
+*********************************************************************************************************************/
+typedef enum
+{
+    LINKEDLIST_STATS_INSERT_END = 0,
+    LINKEDLIST_STATS_INSERT_INDEX,
+    LINKEDLIST_STATS_GET_END,
+    LINKEDLIST_STATS_GET_INDEX,
+    LINKEDLIST_STATS_DELETE_END,
+    LINKEDLIST_STATS_DELETE_INDEX,
+    LINKEDLIST_STATS_DELETE_ALL,
+    LINKEDLIST_STATS_HANDLE_INSERT_END,
+    LINKEDLIST_STATS_HANDLE_INSERT_INDEX,
+    LINKEDLIST_STATS_HANDLE_GET_END,
+    LINKEDLIST_STATS_HANDLE_GET_INDEX,
+    LINKEDLIST_STATS_HANDLE_DELETE_END,
+    LINKEDLIST_STATS_HANDLE_DELETE_ALL,
+    LINKEDLIST_STATS_INSERT_RANGE,
+    LINKEDLIST_STATS_DELETE_RANGE,
+    LINKEDLIST_STATS_SORT,
+    LINKEDLIST_STATS_MERGE,
+    LINKEDLIST_STATS_DEDUP,
+    LINKEDLIST_STATS_COMPACT,
+    LINKEDLIST_STATS_FOR_EACH,
+    LINKEDLIST_STATS_INDEX_OF,
+    LINKEDLIST_STATS_COUNT_OF,
+    LINKEDLIST_STATS_CONCAT,
+    LINKEDLIST_STATS_SPLIT,
+    LINKEDLIST_STATS_SPLICE,
+    LINKEDLIST_STATS_SPLICE_CURSOR,
+    LINKEDLIST_STATS_REVERSE,
+    LINKEDLIST_STATS_TO_ARRAY,
+    LINKEDLIST_STATS_TO_CHUNKS,
+    LINKEDLIST_STATS_FROM_ARRAY,
+    LINKEDLIST_STATS_OP_COUNT
+} linkedlist_stats_op_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_stats_entry_t
+*
+** Description:
+*  This is a structure datatype that holds the counters of one linkedlist function.
+*
+** Datatype Elements:
+*  [1] call_count: unsigned long long
+*      Stores the number of calls.
+*  [2] nodes_traversed: unsigned long long
+*      Stores the number of nodes visited by all the calls, divide by call_count for the nodes visited per call.
+*  [3] latency_total_ns: unsigned long long
+*      Stores the time taken by all the calls, in nanoseconds.
+*  [4] latency_histogram: unsigned long long[LINKEDLIST_STATS_HISTOGRAM_BINS]
+*      Stores the number of calls per latency bin, see LINKEDLIST_STATS_HISTOGRAM_BINS.
+*********************************************************************************************************************/
+typedef struct
+{
+    unsigned long long call_count;
+    unsigned long long nodes_traversed;
+    unsigned long long latency_total_ns;
+    unsigned long long latency_histogram[LINKEDLIST_STATS_HISTOGRAM_BINS];
+} linkedlist_stats_entry_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  linkedlist_stats_t
+*
+** Description:
+*  This is a structure datatype that holds all the linkedlist counters. The counters are shared by all the lists of
+*  the program and updated under one lock, so lists can be used by several threads at once, e.g. readers sharing
+*  the lock of a CustomArray. Every thread counts the nodes it visits on its own.
+*
+** Datatype Elements:
+*  [1] alloc_count: unsigned long long
+*      Stores the number of nodes allocated, with malloc() or from a node pool.
+*  [2] free_count: unsigned long long
+*      Stores the number of nodes freed, or given back to a node pool.
+*  [3] op_entries: linkedlist_stats_entry_t[LINKEDLIST_STATS_OP_COUNT]
+*      Stores the counters of every function, indexed by linkedlist_stats_op_t.
+*
+** Use Example: Print the nodes visited per call of linkedlist_handle_get_index():
+*  linkedlist_stats_t my_stats;
+*  linkedlist_stats_get(&my_stats);
+*  printf("%llu\n", my_stats.op_entries[LINKEDLIST_STATS_HANDLE_GET_INDEX].nodes_traversed /
+*                   my_stats.op_entries[LINKEDLIST_STATS_HANDLE_GET_INDEX].call_count);
+*********************************************************************************************************************/
+typedef struct
+{
+    unsigned long long alloc_count;
+    unsigned long long free_count;
+    linkedlist_stats_entry_t op_entries[LINKEDLIST_STATS_OP_COUNT];
+} linkedlist_stats_t;
+
+/*********************************************************************************************************************
+                                               << Public Macros >>
+*********************************************************************************************************************/
+/** Counting macros used by linkedlist.c. LINKEDLIST_STATS_BEGIN() must follow the declarations of a function, and
+    LINKEDLIST_STATS_END() must be right before its return. **/
+#if (1 == LINKEDLIST_STATS_ENABLE)
+#define LINKEDLIST_STATS_BEGIN()         unsigned long long stats_time_start = linkedlist_stats_time_now(); \
+                                         unsigned long long stats_nodes_start = linkedlist_stats_nodes
+#define LINKEDLIST_STATS_END(stats_op)   linkedlist_stats_record((stats_op), stats_time_start, stats_nodes_start)
+#define LINKEDLIST_STATS_NODES(count)    (linkedlist_stats_nodes += (unsigned long long)(count))
+#define LINKEDLIST_STATS_ALLOC(count)    linkedlist_stats_memory((unsigned long long)(count), 0ull)
+#define LINKEDLIST_STATS_FREE(count)     linkedlist_stats_memory(0ull, (unsigned long long)(count))
+#else
+#define LINKEDLIST_STATS_BEGIN()         ((void)0)
+#define LINKEDLIST_STATS_END(stats_op)   ((void)0)
+#define LINKEDLIST_STATS_NODES(count)    ((void)0)
+#define LINKEDLIST_STATS_ALLOC(count)    ((void)0)
+#define LINKEDLIST_STATS_FREE(count)     ((void)0)
+#endif
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+/** Only meant to be used through the counting macros. The node count is per thread, a call only adds the nodes its
+    own thread visited to its counters. **/
+extern linkedlist_stats_t linkedlist_stats_global;
+extern _Thread_local unsigned long long linkedlist_stats_nodes;
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+extern linkedlist_std_ret_t  linkedlist_stats_get(linkedlist_stats_t* stats);
+extern void                  linkedlist_stats_reset(void);
+extern linkedlist_std_ret_t  linkedlist_stats_dump_json(FILE* file_ptr);
+extern const char*           linkedlist_stats_op_name(linkedlist_stats_op_t stats_op);
+
+/** Only meant to be used through the counting macros **/
+extern unsigned long long    linkedlist_stats_time_now(void);
+extern void                  linkedlist_stats_record(linkedlist_stats_op_t stats_op, unsigned long long time_start,
+                                                     unsigned long long nodes_start);
+extern void                  linkedlist_stats_memory(unsigned long long alloc_count, unsigned long long free_count);
+
+#endif /** LINKEDLIST_STATS_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
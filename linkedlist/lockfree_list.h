@@ -0,0 +1,158 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: lockfree_list.h
+* File Description: This file contains the public interfaces, datatypes, and other information of the lock-free or-
+* dered linkedlist function library. It requires a C11 compiler with atomics support.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef LOCKFREE_LIST_H_INCLUDED
+#define LOCKFREE_LIST_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/** Maximum number of threads that can use a list at the same time **/
+#ifndef LOCKFREE_LIST_MAX_THREADS
+#define LOCKFREE_LIST_MAX_THREADS         64u
+#endif
+
+/** Number of hazard pointers every thread uses while iterating: the current node and the node before it **/
+#define LOCKFREE_LIST_HAZARDS_PER_THREAD  2u
+
+/** Number of unlinked nodes a thread keeps before it frees the ones no other thread is reading **/
+#define LOCKFREE_LIST_RETIRE_THRESHOLD    (2u * LOCKFREE_LIST_MAX_THREADS * LOCKFREE_LIST_HAZARDS_PER_THREAD)
+
+/** Size in bytes of a cache line, every thread slot starts on its own cache line **/
+#define LOCKFREE_LIST_CACHE_LINE_BYTES    64u
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Datatype Name:
+*  lockfree_node_t
+*
+** Description:
+*  This is a structure datatype that will be used for creating a new lock-free list node. The lowest bit of the next
+*  node address is used as a mark: a marked node is logically deleted and is being unlinked.
+*
+** Datatype Elements:
+*  [1] key: int
+*      Stores the node key, the list is kept sorted by increasing key.
+*  [2] next_node_address: _Atomic uintptr_t
+*      Stores address of next node together with the deletion mark.
+*  [3] retired_next_ptr: lockfree_node_t*
+*      Links the node in the retired list of a thread once it was unlinked, until it can be freed safely.
+*********************************************************************************************************************/
+struct lockfree_node_t
+{
+    int key;
+    _Atomic uintptr_t next_node_address;
+    struct lockfree_node_t* retired_next_ptr;
+};
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  lockfree_list_slot_t
+*
+** Description:
+*  This is a structure datatype that stores the memory reclamation state of one thread using the list. Nodes a thread
+*  is reading are published in its hazard pointers, and unlinked nodes are only freed once no hazard pointer of any
+*  thread points to them.
+*
+** Datatype Elements:
+*  [1] hazard_node_ptr: _Atomic(lockfree_node_t*)[LOCKFREE_LIST_HAZARDS_PER_THREAD]
+*      Nodes the thread is currently reading.
+*  [2] slot_in_use: atomic_int
+*      Set while a thread is attached to the slot.
+*  [3] retired_first_ptr: lockfree_node_t*
+*      First node of the list of nodes unlinked by the thread and not freed yet.
+*  [4] retired_count: size_t
+*      Number of nodes in the retired list.
+*********************************************************************************************************************/
+typedef struct
+{
+    _Alignas(LOCKFREE_LIST_CACHE_LINE_BYTES)
+    _Atomic(struct lockfree_node_t*) hazard_node_ptr[LOCKFREE_LIST_HAZARDS_PER_THREAD];
+    atomic_int slot_in_use;
+    struct lockfree_node_t* retired_first_ptr;
+    size_t retired_count;
+} lockfree_list_slot_t;
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  lockfree_list_t
+*
+** Description:
+*  This is a structure datatype that will be used as a handle for a lock-free ordered linkedlist of unique int keys.
+*  Insert, delete and contains can be called by several threads at the same time without any lock. Every thread
+*  attaches to a slot of the list once, and passes the slot index to every operation.
+*
+** Datatype Elements:
+*  [1] head_node: struct lockfree_node_t
+*      Sentinel node placed before the first node, its key is never used.
+*  [2] element_count: atomic_size_t
+*      Stores the number of keys currently in the list.
+*  [3] thread_slots: lockfree_list_slot_t[LOCKFREE_LIST_MAX_THREADS]
+*      Reclamation state of every thread using the list.
+*
+** Use Example: Use a list from several threads:
+*  Step 1: Create the handle and initialize it, before the threads are started:
+*          static lockfree_list_t my_list;
+*          lockfree_list_init(&my_list);
+*  Step 2: In every thread, attach to a slot and use the list:
+*          size_t thread_slot;
+*          lockfree_list_thread_attach(&my_list, &thread_slot);
+*          lockfree_list_insert(&my_list, thread_slot, 7);
+*          lockfree_list_thread_detach(&my_list, thread_slot);
+*  Step 3: Free all the nodes once all the threads are done:
+*          lockfree_list_destroy(&my_list);
+*********************************************************************************************************************/
+typedef struct
+{
+    struct lockfree_node_t head_node;
+    atomic_size_t element_count;
+    lockfree_list_slot_t thread_slots[LOCKFREE_LIST_MAX_THREADS];
+} lockfree_list_t;
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+extern linkedlist_std_ret_t  lockfree_list_init(lockfree_list_t* list);
+extern linkedlist_std_ret_t  lockfree_list_thread_attach(lockfree_list_t* list, size_t* thread_slot);
+extern linkedlist_std_ret_t  lockfree_list_thread_detach(lockfree_list_t* list, size_t thread_slot);
+extern linkedlist_std_ret_t  lockfree_list_insert(lockfree_list_t* list, size_t thread_slot, int key);
+extern linkedlist_std_ret_t  lockfree_list_delete(lockfree_list_t* list, size_t thread_slot, int key);
+extern linkedlist_std_ret_t  lockfree_list_contains(lockfree_list_t* list, size_t thread_slot, int key);
+extern size_t                lockfree_list_size(lockfree_list_t* list);
+extern linkedlist_std_ret_t  lockfree_list_destroy(lockfree_list_t* list);
+
+#endif /** LOCKFREE_LIST_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
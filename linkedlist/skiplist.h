@@ -0,0 +1,141 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: skiplist.h
+* File Description: This file contains the public interfaces, datatypes, and other information of the indexable skip
+* list function library.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef SKIPLIST_H_INCLUDED
+#define SKIPLIST_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/** Maximum number of levels of a skip list node, enough for 4^32 elements **/
+#define SKIPLIST_MAX_LEVEL   32u
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Datatype Name:
+*  skiplist_level_t
+*
+** Description:
+*  This is a structure datatype that holds one level link of a skip list node.
+*
+** Datatype Elements:
+*  [1] next_node_address_ptr: struct skiplist_node_t*
+*      Stores address of the next node on this level.
+*  [2] span: size_t
+*      Stores the number of level 0 positions between the node and its next node on this level, so the index of a
+*      node is found by summing the spans on the way to it.
+*********************************************************************************************************************/
+struct skiplist_level_t
+{
+    struct skiplist_node_t* next_node_address_ptr;
+    size_t span;
+};
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  skiplist_node_t
+*
+** Description:
+*  This is a structure datatype that will be used for creating a new skip list node.
+*
+** Datatype Elements:
+*  [1] data: int
+*      Stores node data.
+*  [2] level_count: unsigned int
+*      Stores the number of levels the node is linked on.
+*  [3] levels: struct skiplist_level_t[]
+*      Stores the links of the node, one for each level.
+*********************************************************************************************************************/
+struct skiplist_node_t
+{
+    int data;
+    unsigned int level_count;
+    struct skiplist_level_t levels[];
+};
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  skiplist_t
+*
+** Description:
+*  This is a structure datatype that will be used as a handle for an indexable skip list. Elements keep the order they
+*  are inserted in, the same as in a linkedlist, and the span counts let positional access skip over whole runs of
+*  nodes, so get/insert/delete by index take expected O(log n).
+*
+** Datatype Elements:
+*  [1] header_node_ptr: struct skiplist_node_t*
+*      Stores address of the header node, which holds no data and is linked on all levels.
+*  [2] tail_node_ptr: struct skiplist_node_t*
+*      Stores address of the last node, or NULL if the list is empty.
+*  [3] element_count: size_t
+*      Stores the number of elements currently in the list.
+*  [4] level_count: unsigned int
+*      Stores the number of levels currently in use.
+*  [5] random_state: unsigned int
+*      State of the random generator used for choosing the level of new nodes.
+*
+** Use Example: Create a skip list:
+*  Step 1: Create the handle and initialize it:
+*          skiplist_t my_list;
+*          skiplist_init(&my_list);
+*  Step 2: Insert data at an index:
+*          skiplist_insert_index(&my_list, 0, 7);
+*  Step 3: Free all the nodes, including the header node, once the list is no longer needed:
+*          skiplist_destroy(&my_list);
+*********************************************************************************************************************/
+typedef struct
+{
+    struct skiplist_node_t* header_node_ptr;
+    struct skiplist_node_t* tail_node_ptr;
+    size_t element_count;
+    unsigned int level_count;
+    unsigned int random_state;
+} skiplist_t;
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+extern linkedlist_std_ret_t  skiplist_init(skiplist_t* list);
+extern linkedlist_std_ret_t  skiplist_insert_end(skiplist_t* list, int new_data);
+extern linkedlist_std_ret_t  skiplist_insert_index(skiplist_t* list, size_t element_index, int new_data);
+extern linkedlist_std_ret_t  skiplist_get_end(skiplist_t* list, int* current_data);
+extern linkedlist_std_ret_t  skiplist_get_index(skiplist_t* list, size_t element_index, int* current_data);
+extern linkedlist_std_ret_t  skiplist_delete_end(skiplist_t* list);
+extern linkedlist_std_ret_t  skiplist_delete_index(skiplist_t* list, size_t element_index);
+extern linkedlist_std_ret_t  skiplist_delete_all(skiplist_t* list);
+extern void                  skiplist_destroy(skiplist_t* list);
+extern size_t                skiplist_size(skiplist_t* list);
+
+#endif /** SKIPLIST_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
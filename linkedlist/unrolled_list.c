@@ -0,0 +1,889 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: unrolled_list.c
+* File Description: This file contains the implementation of the unrolled linkedlist datastructure.
+* License:
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                         << File Inclusions >>
+*********************************************************************************************************************/
+#include "unrolled_list.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*********************************************************************************************************************
+                                         << Private Macros >>
+*********************************************************************************************************************/
+/** Set to 0 at compile time to search the node blocks one element at a time. With GCC or Clang on x86, the blocks
+    are compared 4 elements at a time with SSE2, or 8 at a time with AVX2 if the processor running the program has
+    it. Other compilers and targets always use the element by element search. **/
+#ifndef UNROLLED_LIST_SEARCH_SIMD
+#if defined(__GNUC__) && defined(__SSE2__)
+#define UNROLLED_LIST_SEARCH_SIMD   1
+#else
+#define UNROLLED_LIST_SEARCH_SIMD   0
+#endif
+#endif
+
+#if (1 == UNROLLED_LIST_SEARCH_SIMD)
+#include <immintrin.h>
+#define UNROLLED_LIST_AVX2   __attribute__((target("avx2")))
+/** Number of nodes the count vectors are summed after at the latest. A lane counts at most one compare of every 4
+    elements of a node, so 2^24 nodes keep its 32 bit count below 2^32 for nodes of up to 1020 elements. **/
+#define UNROLLED_LIST_COUNT_FLUSH_NODES   (1u << 24)
+#endif
+
+/*********************************************************************************************************************
+                                  << Private Function Declarations >>
+*********************************************************************************************************************/
+static struct unrolled_node_t* node_create(void);
+static struct unrolled_node_t* node_find(unrolled_list_t* list, size_t element_index, size_t* element_offset,
+                                         struct unrolled_node_t** node_previous);
+static void node_unlink(unrolled_list_t* list, struct unrolled_node_t* node_previous,
+                        struct unrolled_node_t* node_to_delete);
+static size_t block_find(const int* data_block, size_t data_count, int data);
+static linkedlist_std_ret_t nodes_find(const struct unrolled_node_t* node_current, int data, size_t* element_index);
+static size_t nodes_count(const struct unrolled_node_t* node_current, int data);
+#if (1 == UNROLLED_LIST_SEARCH_SIMD)
+static linkedlist_std_ret_t nodes_find_sse2(const struct unrolled_node_t* node_current, int data,
+                                            size_t* element_index);
+static size_t nodes_count_sse2(const struct unrolled_node_t* node_current, int data);
+UNROLLED_LIST_AVX2 static linkedlist_std_ret_t nodes_find_avx2(const struct unrolled_node_t* node_current, int data,
+                                                               size_t* element_index);
+UNROLLED_LIST_AVX2 static size_t nodes_count_avx2(const struct unrolled_node_t* node_current, int data);
+#endif
+
+/*********************************************************************************************************************
+                                  << Public Function Definitions >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_init
+*
+** Purpose:
+*  This function initializes an empty unrolled list.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle to be initialized.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t unrolled_list_init(unrolled_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != list)
+    {
+        list->head_node_ptr = NULL;
+        list->tail_node_ptr = NULL;
+        list->element_count = 0;
+        list->node_count    = 0;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_insert_end
+*
+** Purpose:
+*  This function inserts an element at the end of the list. The last node is filled up before a new node is added.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*  - new_data: int
+*    Value to be stored in the new element.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: a new node couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t unrolled_list_insert_end(unrolled_list_t* list, int new_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct unrolled_node_t* node_last = list->tail_node_ptr;
+
+    if((NULL == node_last) || (UNROLLED_LIST_NODE_CAPACITY == node_last->element_count))
+    {
+        node_last = node_create();
+        if(NULL != node_last)
+        {
+            if(NULL == list->tail_node_ptr)
+            {
+                list->head_node_ptr = node_last;
+            }
+            else
+            {
+                list->tail_node_ptr->next_node_address_ptr = node_last;
+            }
+            list->tail_node_ptr = node_last;
+            list->node_count = list->node_count + 1;
+        }
+    }
+
+    if(NULL != node_last)
+    {
+        node_last->data[node_last->element_count] = new_data;
+        node_last->element_count = node_last->element_count + 1;
+        list->element_count = list->element_count + 1;
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_insert_index
+*
+** Purpose:
+*  This function inserts an element at a provided index, so the new element is found at that index afterwards. If the
+*  node holding the index is full, it is split in two halves first.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*  - element_index: size_t
+*    Index of the new element, from 0 up to and including the current number of elements.
+*  - new_data: int
+*    Value to be stored in the new element.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range, or a new node couldn't be allocated.
+*********************************************************************************************************************/
+linkedlist_std_ret_t unrolled_list_insert_index(unrolled_list_t* list, size_t element_index, int new_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct unrolled_node_t* node_current = NULL;
+    struct unrolled_node_t* node_new = NULL;
+    size_t element_offset = 0;
+    unsigned int half_count = 0;
+
+    if(element_index == list->element_count)
+    {
+        ret_val = unrolled_list_insert_end(list, new_data);
+    }
+    else if(element_index < list->element_count)
+    {
+        node_current = node_find(list, element_index, &element_offset, NULL);
+
+        if(UNROLLED_LIST_NODE_CAPACITY == node_current->element_count)
+        {
+            /** Node is full, move its upper half to a new node linked right after it **/
+            node_new = node_create();
+            if(NULL != node_new)
+            {
+                half_count = node_current->element_count / 2u;
+                node_new->element_count = node_current->element_count - half_count;
+                memcpy(node_new->data, &node_current->data[half_count], node_new->element_count * sizeof(int));
+                node_current->element_count = half_count;
+
+                node_new->next_node_address_ptr = node_current->next_node_address_ptr;
+                node_current->next_node_address_ptr = node_new;
+                if(list->tail_node_ptr == node_current)
+                {
+                    list->tail_node_ptr = node_new;
+                }
+                list->node_count = list->node_count + 1;
+
+                if(element_offset > half_count)
+                {
+                    element_offset = element_offset - half_count;
+                    node_current = node_new;
+                }
+            }
+            else
+            {
+                node_current = NULL;
+            }
+        }
+
+        if(NULL != node_current)
+        {
+            memmove(&node_current->data[element_offset + 1], &node_current->data[element_offset],
+                    (node_current->element_count - element_offset) * sizeof(int));
+            node_current->data[element_offset] = new_data;
+            node_current->element_count = node_current->element_count + 1;
+            list->element_count = list->element_count + 1;
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+    }
+    else
+    {
+        /** Index out of range **/
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_get_end
+*
+** Purpose:
+*  This function reads the last element of the list.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*  - current_data: int*
+*    Points to the variable in which the element will be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t unrolled_list_get_end(unrolled_list_t* list, int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if(NULL != list->tail_node_ptr)
+    {
+        *current_data = list->tail_node_ptr->data[list->tail_node_ptr->element_count - 1u];
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_get_index
+*
+** Purpose:
+*  This function reads the element at a provided index. Whole nodes are skipped using their fill count.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*  - element_index: size_t
+*    Index of the element to be read.
+*  - current_data: int*
+*    Points to the variable in which the element will be stored.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range.
+*********************************************************************************************************************/
+linkedlist_std_ret_t unrolled_list_get_index(unrolled_list_t* list, size_t element_index, int* current_data)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct unrolled_node_t* node_current = NULL;
+    size_t element_offset = 0;
+
+    if(element_index < list->element_count)
+    {
+        node_current = node_find(list, element_index, &element_offset, NULL);
+        *current_data = node_current->data[element_offset];
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_delete_end
+*
+** Purpose:
+*  This function deletes the last element of the list. The list only has to be iterated through when the last node
+*  becomes empty and has to be unlinked.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list is empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t unrolled_list_delete_end(unrolled_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct unrolled_node_t* node_last = list->tail_node_ptr;
+    struct unrolled_node_t* node_previous = NULL;
+
+    if(NULL != node_last)
+    {
+        node_last->element_count = node_last->element_count - 1u;
+        list->element_count = list->element_count - 1;
+
+        if(0u == node_last->element_count)
+        {
+            if(list->head_node_ptr != node_last)
+            {
+                /** Search for the node before the last node **/
+                node_previous = list->head_node_ptr;
+                while(node_previous->next_node_address_ptr != node_last)
+                {
+                    node_previous = node_previous->next_node_address_ptr;
+                }
+            }
+            node_unlink(list, node_previous, node_last);
+        }
+
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_delete_index
+*
+** Purpose:
+*  This function deletes the element at a provided index. A node that becomes empty is unlinked, and a node that
+*  becomes less than half full is merged with its next node if both fit in one node.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*  - element_index: size_t
+*    Index of the element to be deleted.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: index out of range.
+*********************************************************************************************************************/
+linkedlist_std_ret_t unrolled_list_delete_index(unrolled_list_t* list, size_t element_index)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct unrolled_node_t* node_current = NULL;
+    struct unrolled_node_t* node_previous = NULL;
+    struct unrolled_node_t* node_next = NULL;
+    size_t element_offset = 0;
+
+    if(element_index < list->element_count)
+    {
+        node_current = node_find(list, element_index, &element_offset, &node_previous);
+
+        memmove(&node_current->data[element_offset], &node_current->data[element_offset + 1],
+                (node_current->element_count - element_offset - 1u) * sizeof(int));
+        node_current->element_count = node_current->element_count - 1u;
+        list->element_count = list->element_count - 1;
+
+        node_next = node_current->next_node_address_ptr;
+        if(0u == node_current->element_count)
+        {
+            node_unlink(list, node_previous, node_current);
+        }
+        else if((node_current->element_count < (UNROLLED_LIST_NODE_CAPACITY / 2u)) && (NULL != node_next) &&
+                ((node_current->element_count + node_next->element_count) <= UNROLLED_LIST_NODE_CAPACITY))
+        {
+            /** Keep the nodes dense, pull the next node elements into this node **/
+            memcpy(&node_current->data[node_current->element_count], node_next->data,
+                   node_next->element_count * sizeof(int));
+            node_current->element_count = node_current->element_count + node_next->element_count;
+            node_unlink(list, node_current, node_next);
+        }
+        else
+        {
+            /** Node is still dense enough **/
+        }
+
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_delete_all
+*
+** Purpose:
+*  This function frees all the nodes of the list and leaves it empty.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: the list was already empty.
+*********************************************************************************************************************/
+linkedlist_std_ret_t unrolled_list_delete_all(unrolled_list_t* list)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    struct unrolled_node_t* node_current = list->head_node_ptr;
+    struct unrolled_node_t* node_tofree = NULL;
+
+    if(NULL != node_current)
+    {
+        while(NULL != node_current)
+        {
+            node_tofree  = node_current;
+            node_current = node_current->next_node_address_ptr;
+            free(node_tofree);
+        }
+        (void)unrolled_list_init(list);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_size
+*
+** Purpose:
+*  Returns the number of elements currently in the list.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - size_t
+*    Number of elements.
+*********************************************************************************************************************/
+size_t unrolled_list_size(unrolled_list_t* list)
+{
+    return list->element_count;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_memory_usage
+*
+** Purpose:
+*  Returns the number of bytes of node memory the list currently uses, not counting the allocator own overhead.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*
+** Return Value:
+*  - size_t
+*    Bytes used by the list nodes.
+*********************************************************************************************************************/
+size_t unrolled_list_memory_usage(unrolled_list_t* list)
+{
+    return list->node_count * sizeof(struct unrolled_node_t);
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_index_of
+*
+** Purpose:
+*  This function finds the index of the first element equal to the given data. The elements of every node are
+*  compared several at a time, see UNROLLED_LIST_SEARCH_SIMD.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*  - data: int
+*    Data to search for.
+*  - element_index: size_t*
+*    A pointer to a variable to hold the index of the first equal element.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL: no element is equal to data.
+*********************************************************************************************************************/
+linkedlist_std_ret_t unrolled_list_index_of(unrolled_list_t* list, int data, size_t* element_index)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if((NULL != list) && (NULL != element_index))
+    {
+        ret_val = nodes_find(list->head_node_ptr, data, element_index);
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_count_of
+*
+** Purpose:
+*  This function counts the elements equal to the given data. The elements of every node are compared several at a
+*  time, see UNROLLED_LIST_SEARCH_SIMD.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*  - data: int
+*    Data to count.
+*  - match_count: size_t*
+*    A pointer to a variable to hold the number of equal elements.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS
+*    -- LINKEDLIST_OP_FAIL
+*********************************************************************************************************************/
+linkedlist_std_ret_t unrolled_list_count_of(unrolled_list_t* list, int data, size_t* match_count)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+
+    if((NULL != list) && (NULL != match_count))
+    {
+        *match_count = nodes_count(list->head_node_ptr, data);
+        ret_val = LINKEDLIST_OP_SUCCESS;
+    }
+
+    return ret_val;
+}
+
+/*********************************************************************************************************************
+** Function Name:
+*  unrolled_list_contains
+*
+** Purpose:
+*  This function checks whether any element is equal to the given data.
+*
+** Input Parameters:
+*  - list: unrolled_list_t*
+*    A pointer to the list handle.
+*  - data: int
+*    Data to search for.
+*
+** Return Value:
+*  - linkedlist_std_ret_t
+*    -- LINKEDLIST_OP_SUCCESS: an element is equal to data.
+*    -- LINKEDLIST_OP_FAIL: no element is equal to data.
+*********************************************************************************************************************/
+linkedlist_std_ret_t unrolled_list_contains(unrolled_list_t* list, int data)
+{
+    size_t element_index = 0;
+
+    return unrolled_list_index_of(list, data, &element_index);
+}
+
+/*********************************************************************************************************************
+                                  << Private Function Definitions >>
+*********************************************************************************************************************/
+/** Nodes start on a UNROLLED_LIST_NODE_BYTES boundary, so each of them takes one cache line instead of two **/
+static struct unrolled_node_t* node_create(void)
+{
+    struct unrolled_node_t* node_new = (struct unrolled_node_t*)aligned_alloc(UNROLLED_LIST_NODE_BYTES,
+                                                                               sizeof(struct unrolled_node_t));
+
+    if(NULL != node_new)
+    {
+        node_new->next_node_address_ptr = NULL;
+        node_new->element_count = 0u;
+    }
+
+    return node_new;
+}
+
+/** Returns the node holding the element at element_index, which has to be in range, and the offset of the element
+    inside that node. If node_previous isn't NULL, it is loaded with the node before the returned node. **/
+static struct unrolled_node_t* node_find(unrolled_list_t* list, size_t element_index, size_t* element_offset,
+                                         struct unrolled_node_t** node_previous)
+{
+    struct unrolled_node_t* node_current = list->head_node_ptr;
+    struct unrolled_node_t* node_before  = NULL;
+
+    /** Skip whole nodes until the one holding the required index **/
+    while(element_index >= node_current->element_count)
+    {
+        element_index = element_index - node_current->element_count;
+        node_before   = node_current;
+        node_current  = node_current->next_node_address_ptr;
+    }
+
+    *element_offset = element_index;
+    if(NULL != node_previous)
+    {
+        *node_previous = node_before;
+    }
+
+    return node_current;
+}
+
+static void node_unlink(unrolled_list_t* list, struct unrolled_node_t* node_previous,
+                        struct unrolled_node_t* node_to_delete)
+{
+    if(NULL == node_previous)
+    {
+        list->head_node_ptr = node_to_delete->next_node_address_ptr;
+    }
+    else
+    {
+        node_previous->next_node_address_ptr = node_to_delete->next_node_address_ptr;
+    }
+
+    if(list->tail_node_ptr == node_to_delete)
+    {
+        list->tail_node_ptr = node_previous;
+    }
+
+    free(node_to_delete);
+    list->node_count = list->node_count - 1;
+}
+
+/** Returns the offset of the first element of the block equal to data, or data_count if there is none **/
+static size_t block_find(const int* data_block, size_t data_count, int data)
+{
+    size_t found_offset = data_count;
+    size_t element_offset = 0;
+
+    for(element_offset = 0; (element_offset < data_count) && (data_count == found_offset); element_offset++)
+    {
+        if(data == data_block[element_offset])
+        {
+            found_offset = element_offset;
+        }
+    }
+
+    return found_offset;
+}
+
+/** Searches the nodes from node_current on. With SIMD, the processor is checked once per search, so the program runs
+    on any x86 processor and only uses AVX2 where it is available. **/
+static linkedlist_std_ret_t nodes_find(const struct unrolled_node_t* node_current, int data, size_t* element_index)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+#if (1 == UNROLLED_LIST_SEARCH_SIMD)
+    if(0 != __builtin_cpu_supports("avx2"))
+    {
+        ret_val = nodes_find_avx2(node_current, data, element_index);
+    }
+    else
+    {
+        ret_val = nodes_find_sse2(node_current, data, element_index);
+    }
+#else
+    size_t node_first_index = 0;
+    size_t element_offset = 0;
+
+    while((NULL != node_current) && (LINKEDLIST_OP_FAIL == ret_val))
+    {
+        element_offset = block_find(node_current->data, node_current->element_count, data);
+        if(element_offset < node_current->element_count)
+        {
+            *element_index = node_first_index + element_offset;
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+        node_first_index = node_first_index + node_current->element_count;
+        node_current = node_current->next_node_address_ptr;
+    }
+#endif
+
+    return ret_val;
+}
+
+static size_t nodes_count(const struct unrolled_node_t* node_current, int data)
+{
+    size_t match_count = 0;
+#if (1 == UNROLLED_LIST_SEARCH_SIMD)
+    if(0 != __builtin_cpu_supports("avx2"))
+    {
+        match_count = nodes_count_avx2(node_current, data);
+    }
+    else
+    {
+        match_count = nodes_count_sse2(node_current, data);
+    }
+#else
+    size_t element_offset = 0;
+
+    for(; NULL != node_current; node_current = node_current->next_node_address_ptr)
+    {
+        for(element_offset = 0; element_offset < node_current->element_count; element_offset++)
+        {
+            match_count = match_count + ((data == node_current->data[element_offset]) ? 1u : 0u);
+        }
+    }
+#endif
+
+    return match_count;
+}
+
+#if (1 == UNROLLED_LIST_SEARCH_SIMD)
+/** Compares the elements of a node 4 at a time and merges all the compare results, the node is only searched element
+    by element once it is known to hold the data. The data of a node doesn't start on a 16 byte boundary, so the
+    loads are unaligned. **/
+static linkedlist_std_ret_t nodes_find_sse2(const struct unrolled_node_t* node_current, int data,
+                                            size_t* element_index)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    __m128i data_vector = _mm_set1_epi32(data);
+    __m128i match_vector;
+    size_t node_first_index = 0;
+    size_t element_offset = 0;
+
+    while((NULL != node_current) && (LINKEDLIST_OP_FAIL == ret_val))
+    {
+        match_vector = _mm_setzero_si128();
+        for(element_offset = 0; (element_offset + 4u) <= node_current->element_count; element_offset += 4u)
+        {
+            match_vector = _mm_or_si128(match_vector, _mm_cmpeq_epi32(
+                               _mm_loadu_si128((const __m128i*)&node_current->data[element_offset]), data_vector));
+        }
+
+        if((0 != _mm_movemask_epi8(match_vector)) ||
+           (node_current->element_count - element_offset) != block_find(&node_current->data[element_offset],
+                                                                        node_current->element_count - element_offset,
+                                                                        data))
+        {
+            *element_index = node_first_index + block_find(node_current->data, node_current->element_count, data);
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+        node_first_index = node_first_index + node_current->element_count;
+        node_current = node_current->next_node_address_ptr;
+    }
+
+    return ret_val;
+}
+
+/** Every equal element subtracts -1 from its lane of the count vector. The lanes accumulate over the nodes and are
+    added to the count every UNROLLED_LIST_COUNT_FLUSH_NODES nodes and at the end, before they can overflow. **/
+static size_t nodes_count_sse2(const struct unrolled_node_t* node_current, int data)
+{
+    __m128i data_vector = _mm_set1_epi32(data);
+    __m128i count_vector = _mm_setzero_si128();
+    unsigned int count_lanes[4];
+    size_t match_count = 0;
+    size_t element_offset = 0;
+    size_t flush_cntr = 0;
+
+    for(; NULL != node_current; node_current = node_current->next_node_address_ptr)
+    {
+        for(element_offset = 0; (element_offset + 4u) <= node_current->element_count; element_offset += 4u)
+        {
+            count_vector = _mm_sub_epi32(count_vector, _mm_cmpeq_epi32(
+                               _mm_loadu_si128((const __m128i*)&node_current->data[element_offset]), data_vector));
+        }
+        for(; element_offset < node_current->element_count; element_offset++)
+        {
+            match_count = match_count + ((data == node_current->data[element_offset]) ? 1u : 0u);
+        }
+
+        flush_cntr = flush_cntr + 1u;
+        if((UNROLLED_LIST_COUNT_FLUSH_NODES == flush_cntr) || (NULL == node_current->next_node_address_ptr))
+        {
+            _mm_storeu_si128((__m128i*)count_lanes, count_vector);
+            match_count = match_count + count_lanes[0] + count_lanes[1] + count_lanes[2] + count_lanes[3];
+            count_vector = _mm_setzero_si128();
+            flush_cntr = 0;
+        }
+    }
+
+    return match_count;
+}
+
+/** Same as nodes_find_sse2() 8 elements at a time, then 4. The SSE2 functions aren't called for the rest of a node:
+    their instructions are encoded without AVX, and mixing both encodings stalls many processors. **/
+UNROLLED_LIST_AVX2 static linkedlist_std_ret_t nodes_find_avx2(const struct unrolled_node_t* node_current, int data,
+                                                               size_t* element_index)
+{
+    linkedlist_std_ret_t ret_val = LINKEDLIST_OP_FAIL;
+    __m256i data_vector = _mm256_set1_epi32(data);
+    __m256i match_vector;
+    __m128i match_half;
+    size_t node_first_index = 0;
+    size_t element_offset = 0;
+
+    while((NULL != node_current) && (LINKEDLIST_OP_FAIL == ret_val))
+    {
+        match_vector = _mm256_setzero_si256();
+        for(element_offset = 0; (element_offset + 8u) <= node_current->element_count; element_offset += 8u)
+        {
+            match_vector = _mm256_or_si256(match_vector, _mm256_cmpeq_epi32(
+                               _mm256_loadu_si256((const __m256i*)&node_current->data[element_offset]), data_vector));
+        }
+        match_half = _mm_or_si128(_mm256_castsi256_si128(match_vector), _mm256_extracti128_si256(match_vector, 1));
+        if((element_offset + 4u) <= node_current->element_count)
+        {
+            match_half = _mm_or_si128(match_half, _mm_cmpeq_epi32(
+                             _mm_loadu_si128((const __m128i*)&node_current->data[element_offset]),
+                             _mm256_castsi256_si128(data_vector)));
+            element_offset = element_offset + 4u;
+        }
+
+        if((0 != _mm_movemask_epi8(match_half)) ||
+           (node_current->element_count - element_offset) != block_find(&node_current->data[element_offset],
+                                                                        node_current->element_count - element_offset,
+                                                                        data))
+        {
+            *element_index = node_first_index + block_find(node_current->data, node_current->element_count, data);
+            ret_val = LINKEDLIST_OP_SUCCESS;
+        }
+        node_first_index = node_first_index + node_current->element_count;
+        node_current = node_current->next_node_address_ptr;
+    }
+
+    return ret_val;
+}
+
+UNROLLED_LIST_AVX2 static size_t nodes_count_avx2(const struct unrolled_node_t* node_current, int data)
+{
+    __m256i data_vector = _mm256_set1_epi32(data);
+    __m256i count_vector = _mm256_setzero_si256();
+    __m128i count_half = _mm_setzero_si128();
+    unsigned int count_lanes[4];
+    size_t match_count = 0;
+    size_t element_offset = 0;
+    size_t flush_cntr = 0;
+
+    for(; NULL != node_current; node_current = node_current->next_node_address_ptr)
+    {
+        for(element_offset = 0; (element_offset + 8u) <= node_current->element_count; element_offset += 8u)
+        {
+            count_vector = _mm256_sub_epi32(count_vector, _mm256_cmpeq_epi32(
+                               _mm256_loadu_si256((const __m256i*)&node_current->data[element_offset]), data_vector));
+        }
+        if((element_offset + 4u) <= node_current->element_count)
+        {
+            count_half = _mm_sub_epi32(count_half, _mm_cmpeq_epi32(
+                             _mm_loadu_si128((const __m128i*)&node_current->data[element_offset]),
+                             _mm256_castsi256_si128(data_vector)));
+            element_offset = element_offset + 4u;
+        }
+        for(; element_offset < node_current->element_count; element_offset++)
+        {
+            match_count = match_count + ((data == node_current->data[element_offset]) ? 1u : 0u);
+        }
+
+        /** Same flush as nodes_count_sse2(), the two halves of the 8 lane vector are added to the 4 lane one first **/
+        flush_cntr = flush_cntr + 1u;
+        if((UNROLLED_LIST_COUNT_FLUSH_NODES == flush_cntr) || (NULL == node_current->next_node_address_ptr))
+        {
+            count_half = _mm_add_epi32(count_half, _mm_add_epi32(_mm256_castsi256_si128(count_vector),
+                                                                 _mm256_extracti128_si256(count_vector, 1)));
+            _mm_storeu_si128((__m128i*)count_lanes, count_half);
+            match_count = match_count + count_lanes[0] + count_lanes[1] + count_lanes[2] + count_lanes[3];
+            count_vector = _mm256_setzero_si256();
+            count_half = _mm_setzero_si128();
+            flush_cntr = 0;
+        }
+    }
+
+    return match_count;
+}
+#endif
+
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/
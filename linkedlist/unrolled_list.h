@@ -0,0 +1,123 @@
+/*********************************************************************************************************************
+* File Information:
+* Author : Alsayed Alsisi
+* Date   : Wednesday, July 10, 2024
+* Version: 1.0
+* Contact: alsayed.alsisi@gmail.com
+* File Name: unrolled_list.h
+* File Description: This file contains the public interfaces, datatypes, and other information of the unrolled link-
+* edlist function library.
+* License:
+*********************************************************************************************************************/
+
+
+
+/*********************************************************************************************************************
+                                               << Header Guard >>
+*********************************************************************************************************************/
+#ifndef UNROLLED_LIST_H_INCLUDED
+#define UNROLLED_LIST_H_INCLUDED
+
+
+/*********************************************************************************************************************
+                                               << File Inclusions >>
+*********************************************************************************************************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include "linkedlist.h"
+
+/*********************************************************************************************************************
+                                               << Public Constants >>
+*********************************************************************************************************************/
+/** Size in bytes every unrolled node is made to fit in, one cache line on most targets **/
+#define UNROLLED_LIST_NODE_BYTES      64u
+
+/** Number of elements every unrolled node can hold, what is left of the node after the link and the fill count **/
+#define UNROLLED_LIST_NODE_CAPACITY   ((UNROLLED_LIST_NODE_BYTES - sizeof(void*) - sizeof(unsigned int)) / sizeof(int))
+
+/*********************************************************************************************************************
+                                               << Public Data Types >>
+*********************************************************************************************************************/
+/*********************************************************************************************************************
+** Datatype Name:
+*  unrolled_node_t
+*
+** Description:
+*  This is a structure datatype that will be used for creating a new unrolled linkedlist node. Each node stores a
+*  block of elements instead of a single one, so one link and one cache line serve several elements.
+*
+** Datatype Elements:
+*  [1] next_node_address_ptr: unrolled_node_t*
+*      Stores address of next unrolled node.
+*  [2] element_count: unsigned int
+*      Stores the number of elements currently used in the node data block.
+*  [3] data: int[UNROLLED_LIST_NODE_CAPACITY]
+*      Stores node data. Only the first element_count elements are valid.
+*********************************************************************************************************************/
+struct unrolled_node_t
+{
+    struct unrolled_node_t* next_node_address_ptr;
+    unsigned int element_count;
+    int data[UNROLLED_LIST_NODE_CAPACITY];
+};
+
+/*********************************************************************************************************************
+** Datatype Name:
+*  unrolled_list_t
+*
+** Description:
+*  This is a structure datatype that will be used as a handle for an unrolled linkedlist.
+*
+** Datatype Elements:
+*  [1] head_node_ptr: struct unrolled_node_t*
+*      Stores address of the first node, or NULL if the list is empty.
+*  [2] tail_node_ptr: struct unrolled_node_t*
+*      Stores address of the last node, or NULL if the list is empty.
+*  [3] element_count: size_t
+*      Stores the number of elements currently in the list.
+*  [4] node_count: size_t
+*      Stores the number of nodes currently allocated for the list.
+*
+** Use Example: Create an unrolled linkedlist:
+*  Step 1: Create the handle and initialize it:
+*          unrolled_list_t my_list;
+*          unrolled_list_init(&my_list);
+*  Step 2: Append data to the end of the list:
+*          unrolled_list_insert_end(&my_list, 7);
+*  Step 3: Free all the nodes once the list is no longer needed:
+*          unrolled_list_delete_all(&my_list);
+*********************************************************************************************************************/
+typedef struct
+{
+    struct unrolled_node_t* head_node_ptr;
+    struct unrolled_node_t* tail_node_ptr;
+    size_t element_count;
+    size_t node_count;
+} unrolled_list_t;
+
+/*********************************************************************************************************************
+                                          << Public Variable Declarations >>
+*********************************************************************************************************************/
+
+
+/*********************************************************************************************************************
+                                           << Public Function Declarations >>
+*********************************************************************************************************************/
+extern linkedlist_std_ret_t  unrolled_list_init(unrolled_list_t* list);
+extern linkedlist_std_ret_t  unrolled_list_insert_end(unrolled_list_t* list, int new_data);
+extern linkedlist_std_ret_t  unrolled_list_insert_index(unrolled_list_t* list, size_t element_index, int new_data);
+extern linkedlist_std_ret_t  unrolled_list_get_end(unrolled_list_t* list, int* current_data);
+extern linkedlist_std_ret_t  unrolled_list_get_index(unrolled_list_t* list, size_t element_index, int* current_data);
+extern linkedlist_std_ret_t  unrolled_list_delete_end(unrolled_list_t* list);
+extern linkedlist_std_ret_t  unrolled_list_delete_index(unrolled_list_t* list, size_t element_index);
+extern linkedlist_std_ret_t  unrolled_list_delete_all(unrolled_list_t* list);
+extern size_t                unrolled_list_size(unrolled_list_t* list);
+extern size_t                unrolled_list_memory_usage(unrolled_list_t* list);
+extern linkedlist_std_ret_t  unrolled_list_index_of(unrolled_list_t* list, int data, size_t* element_index);
+extern linkedlist_std_ret_t  unrolled_list_count_of(unrolled_list_t* list, int data, size_t* match_count);
+extern linkedlist_std_ret_t  unrolled_list_contains(unrolled_list_t* list, int data);
+
+#endif /** UNROLLED_LIST_H_INCLUDED **/
+/*********************************************************************************************************************
+                                               << End of File >>
+*********************************************************************************************************************/